@@ -33,10 +33,22 @@
 
 #include <CoreFoundation/CoreFoundation.h>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <functional>
+
+#ifdef __has_include
+#if __has_include( <version> )
+#include <version>
+#endif
+#endif
+
+#ifdef __cpp_lib_span
+#include <span>
+#endif
 
 /*
  * Disable warnings about class members not having DLL-interface.
@@ -57,6 +69,14 @@
 #define CFPP_EXPORT     
 #endif
 
+/*
+ * zlib ships with Apple platforms. Elsewhere, define CFPP_ZLIB and link
+ * against zlib to enable compression, or define CFPP_NO_ZLIB to opt out.
+ */
+#if defined( __APPLE__ ) && !defined( CFPP_ZLIB ) && !defined( CFPP_NO_ZLIB )
+#define CFPP_ZLIB
+#endif
+
 #include <CF++/CFPP-Type.hpp>
 #include <CF++/CFPP-PropertyListBase.hpp>
 #include <CF++/CFPP-PropertyListType.hpp>
@@ -67,16 +87,28 @@
 #include <CF++/CFPP-Boolean.hpp>
 #include <CF++/CFPP-Number.hpp>
 #include <CF++/CFPP-String.hpp>
+#include <CF++/CFPP-StringBuilder.hpp>
+#include <CF++/CFPP-StaticString.hpp>
 #include <CF++/CFPP-URL.hpp>
 #include <CF++/CFPP-Data.hpp>
+#include <CF++/CFPP-DataWriter.hpp>
+#include <CF++/CFPP-DataReader.hpp>
 #include <CF++/CFPP-Date.hpp>
 #include <CF++/CFPP-Array.hpp>
+#include <CF++/CFPP-ArrayView.hpp>
+#include <CF++/CFPP-ArrayIndex.hpp>
+#include <CF++/CFPP-Parallel.hpp>
+#include <CF++/CFPP-Packed.hpp>
 #include <CF++/CFPP-Pair.hpp>
 #include <CF++/CFPP-Dictionary.hpp>
 #include <CF++/CFPP-Error.hpp>
 #include <CF++/CFPP-UUID.hpp>
 #include <CF++/CFPP-ReadStream.hpp>
 #include <CF++/CFPP-WriteStream.hpp>
+#include <CF++/CFPP-InflateStream.hpp>
+#include <CF++/CFPP-DeflateStream.hpp>
+#include <CF++/CFPP-CRC32C.hpp>
+#include <CF++/CFPP-XXH3.hpp>
 #include <CF++/CFPP-PropertyListType-Definition.hpp>
 #include <CF++/CFPP-Object.hpp>
 
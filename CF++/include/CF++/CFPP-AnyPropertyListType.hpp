@@ -39,7 +39,11 @@ namespace CF
     {
         public:
             
-            static AnyPropertyListType FromPropertyList( const std::string & path );
+            /*
+             * With map, a regular file is memory-mapped rather than read.
+             * It must then not be truncated while being parsed.
+             */
+            static AnyPropertyListType FromPropertyList( const std::string & path, bool map = false );
             static AnyPropertyListType FromPropertyListString( const std::string & plist );
             static AnyPropertyListType FromPropertyListData( const Data & plist );
             
@@ -32,6 +32,8 @@
 #define CFPP_ARRAY_HPP
 
 #include <vector>
+#include <iterator>
+#include <type_traits>
 
 namespace CF
 {
@@ -49,8 +51,68 @@ namespace CF
             Array( std::initializer_list< CFTypeRef > value );
             Array( Array && value ) noexcept;
             
+            template< typename I, typename = typename std::iterator_traits< I >::iterator_category >
+            Array( I first, I last );
+            
+            template< typename T >
+            Array( const std::vector< T > & value );
+            
             ~Array() override;
             
+            /*
+             * Copies share the underlying CFArray, which is only copied on the
+             * first mutating call. Borrow retains an existing object, Adopt
+             * takes over a +1 reference (e.g. from a Create function).
+             * A shared CFMutableArray changed elsewhere remains visible until
+             * this object is mutated.
+             */
+            static Array Borrow( CFArrayRef value );
+            static Array Adopt( CFArrayRef value );
+            
+            /*
+             * Converts every element first (CFTypeRef, CF::Type subclasses,
+             * strings, numbers and booleans), then creates the array with a
+             * single CFArrayCreate call. Every element is kept in place:
+             * NULL values and failed conversions (invalid UTF-8 or an
+             * invalid CF::Type) are stored as kCFNull.
+             */
+            template< typename R >
+            static Array FromRange( const R & range );
+            
+            template< typename I >
+            static Array FromRange( I first, I last );
+            
+            /*
+             * Reads all values with a single CFArrayGetValues call. Raw CF
+             * pointers are borrowed from the array and are not retained.
+             */
+            template< typename T >
+            std::vector< T > ToVector() const;
+            
+            /*
+             * Unboxes CFNumber values in a single pass, without wrappers
+             * (see CF::Packed for reductions). Other values are stored as 0,
+             * and numbers that don't convert exactly (eg 3.7 as SInt64) are
+             * stored converted. The index of the first value of either kind
+             * is written to mismatch (kCFNotFound if there is none).
+             */
+            std::vector< double > ToPackedDoubles( CFIndex * mismatch = nullptr ) const;
+            std::vector< SInt64 > ToPackedInt64( CFIndex * mismatch = nullptr )   const;
+            
+            /*
+             * Boxes packed values into CFNumbers, creating the array with a
+             * single CFArrayCreate call.
+             */
+            static Array FromPacked( const double * values, CFIndex count );
+            static Array FromPacked( const SInt64 * values, CFIndex count );
+            static Array FromPacked( const std::vector< double > & values );
+            static Array FromPacked( const std::vector< SInt64 > & values );
+            
+            #ifdef __cpp_lib_span
+            static Array FromPacked( std::span< const double > values );
+            static Array FromPacked( std::span< const SInt64 > values );
+            #endif
+            
             Array & operator =( Array value );
             Array & operator =( const AutoPointer & value );
             Array & operator =( CFTypeRef value );
@@ -68,6 +130,9 @@ namespace CF
             
             CFTypeRef operator [] ( int index ) const;
             
+            /* Detaches shared or immutable storage first, like other mutators */
+            operator CFMutableArrayRef () const override;
+            
             CFTypeID  GetTypeID()   const override;
             CFTypeRef GetCFObject() const override;
             
@@ -82,6 +147,20 @@ namespace CF
             void RemoveValueAtIndex( CFIndex index );
             void AppendArray( CFArrayRef array );
             void ExchangeValuesAtIndices( CFIndex index1, CFIndex index2 );
+            
+            /*
+             * CFArraySortValues / CFArrayBSearchValues wrappers.
+             * BinarySearch expects values sorted with the same comparator,
+             * and returns the index of a matching value or kCFNotFound.
+             * CompareStrings takes an optional CFStringCompareFlags pointer
+             * as context. Both order NULL values first, and values of another
+             * type by type ID.
+             */
+            void    Sort( CFComparatorFunction comparator, void * context = nullptr );
+            CFIndex BinarySearch( CFTypeRef value, CFComparatorFunction comparator, void * context = nullptr ) const;
+            
+            static CFComparisonResult CompareStrings( const void * value1, const void * value2, void * context );
+            static CFComparisonResult CompareNumbers( const void * value1, const void * value2, void * context );
                         
             friend void swap( Array & v1, Array & v2 ) noexcept;
             
@@ -147,8 +226,194 @@ namespace CF
             
         protected:
             
-            CFMutableArrayRef _cfObject;
+            CFMutableArrayRef GetMutableCFObject() const;
+            
+            mutable CFArrayRef _cfObject;
+            mutable bool       _mutable;
+            
+        private:
+            
+            friend class Parallel;
+            
+            static Array CopyValues( const std::vector< CFTypeRef > & values );
+            static Array AdoptValues( const std::vector< CFTypeRef > & values );
+            
+            template< typename T >
+            static CFTypeRef CopyElement( const T & value );
+            
+            template< typename T >
+            static T ConvertElement( CFTypeRef value );
     };
+    
+    #ifdef __cpp_lib_span
+    
+    inline Array Array::FromPacked( std::span< const double > values )
+    {
+        return FromPacked( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    inline Array Array::FromPacked( std::span< const SInt64 > values )
+    {
+        return FromPacked( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    #endif
+    
+    template< typename I, typename >
+    Array::Array( I first, I last ): Array( FromRange( first, last ) )
+    {}
+    
+    template< typename T >
+    Array::Array( const std::vector< T > & value ): Array( FromRange( value.begin(), value.end() ) )
+    {}
+    
+    template< typename R >
+    Array Array::FromRange( const R & range )
+    {
+        return FromRange( std::begin( range ), std::end( range ) );
+    }
+    
+    template< typename I >
+    Array Array::FromRange( I first, I last )
+    {
+        std::vector< CFTypeRef > values;
+        
+        if constexpr( std::is_base_of< std::forward_iterator_tag, typename std::iterator_traits< I >::iterator_category >::value )
+        {
+            values.reserve( static_cast< size_t >( std::distance( first, last ) ) );
+        }
+        
+        for( ; first != last; ++first )
+        {
+            CFTypeRef value = CopyElement( *( first ) );
+            
+            values.push_back( ( value == nullptr ) ? CFRetain( kCFNull ) : value );
+        }
+        
+        return AdoptValues( values );
+    }
+    
+    template< typename T >
+    std::vector< T > Array::ToVector() const
+    {
+        std::vector< CFTypeRef > values( static_cast< size_t >( this->GetCount() ) );
+        std::vector< T >         vector;
+        
+        if( values.size() == 0 )
+        {
+            return vector;
+        }
+        
+        CFArrayGetValues( this->_cfObject, CFRangeMake( 0, static_cast< CFIndex >( values.size() ) ), values.data() );
+        
+        if constexpr( std::is_same< T, CFTypeRef >::value )
+        {
+            return values;
+        }
+        else
+        {
+            vector.reserve( values.size() );
+            
+            for( CFTypeRef value: values )
+            {
+                vector.push_back( ConvertElement< T >( value ) );
+            }
+            
+            return vector;
+        }
+    }
+    
+    template< typename T >
+    CFTypeRef Array::CopyElement( const T & value )
+    {
+        if constexpr( std::is_base_of< Type, T >::value )
+        {
+            CFTypeRef cfObject = value.GetCFObject();
+            
+            return ( cfObject == nullptr ) ? nullptr : CFRetain( cfObject );
+        }
+        else if constexpr( std::is_same< T, bool >::value )
+        {
+            return CFRetain( Boolean( value ).GetCFObject() );
+        }
+        else if constexpr( std::is_floating_point< T >::value )
+        {
+            return CFRetain( Number( static_cast< double >( value ) ).GetCFObject() );
+        }
+        else if constexpr( std::is_arithmetic< T >::value && std::is_signed< T >::value )
+        {
+            return CFRetain( Number( static_cast< signed long long >( value ) ).GetCFObject() );
+        }
+        else if constexpr( std::is_arithmetic< T >::value )
+        {
+            return CFRetain( Number( static_cast< unsigned long long >( value ) ).GetCFObject() );
+        }
+        else if constexpr( std::is_convertible< T, std::string_view >::value )
+        {
+            if constexpr( std::is_pointer< T >::value )
+            {
+                if( value == nullptr )
+                {
+                    return nullptr;
+                }
+            }
+            
+            String string( ( std::string_view( value ) ) );
+            
+            return ( string.GetCFObject() == nullptr ) ? nullptr : CFRetain( string.GetCFObject() );
+        }
+        else if constexpr( std::is_convertible< T, CFTypeRef >::value )
+        {
+            CFTypeRef cfObject = value;
+            
+            return ( cfObject == nullptr ) ? nullptr : CFRetain( cfObject );
+        }
+        else
+        {
+            static_assert( sizeof( T ) == 0, "Unsupported element type for CF::Array" );
+            
+            return nullptr;
+        }
+    }
+    
+    template< typename T >
+    T Array::ConvertElement( CFTypeRef value )
+    {
+        if constexpr( std::is_base_of< Type, T >::value )
+        {
+            return T( value );
+        }
+        else if constexpr( std::is_same< T, bool >::value )
+        {
+            return Boolean( value ).GetValue();
+        }
+        else if constexpr( std::is_floating_point< T >::value )
+        {
+            return static_cast< T >( static_cast< double >( Number( value ) ) );
+        }
+        else if constexpr( std::is_arithmetic< T >::value && std::is_signed< T >::value )
+        {
+            return static_cast< T >( static_cast< signed long long >( Number( value ) ) );
+        }
+        else if constexpr( std::is_arithmetic< T >::value )
+        {
+            return static_cast< T >( static_cast< unsigned long long >( Number( value ) ) );
+        }
+        else if constexpr( std::is_same< T, std::string >::value )
+        {
+            return String( value ).GetValue();
+        }
+        else if constexpr( std::is_pointer< T >::value && std::is_convertible< T, CFTypeRef >::value && !std::is_convertible< T, std::string_view >::value )
+        {
+            return static_cast< T >( const_cast< void * >( value ) );
+        }
+        else
+        {
+            static_assert( sizeof( T ) == 0, "Unsupported element type for CF::Array" );
+            
+            return T();
+        }
+    }
 }
 
 #endif /* CFPP_ARRAY_HPP */
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-ArrayIndex.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ hashed lookup index for arrays
+ */
+
+#ifndef CFPP_ARRAY_INDEX_HPP
+#define CFPP_ARRAY_INDEX_HPP
+
+#include <unordered_map>
+
+namespace CF
+{
+    /*
+     * Hash table over the values of an array (CFHash / CFEqual), for
+     * constant time membership and index lookups.
+     * The index keeps its own copy of the array, shared until modified.
+     * Values added through AppendValue are indexed as they are appended.
+     * For duplicate values, the first index is reported.
+     */
+    class CFPP_EXPORT ArrayIndex
+    {
+        public:
+            
+            ArrayIndex();
+            ArrayIndex( const Array & array );
+            ArrayIndex( const ArrayIndex & value );
+            ArrayIndex( ArrayIndex && value ) noexcept;
+            
+            ~ArrayIndex();
+            
+            ArrayIndex & operator =( ArrayIndex value );
+            
+            const Array & GetArray()                         const;
+            CFIndex       GetCount()                         const;
+            bool          ContainsValue( CFTypeRef value )   const;
+            CFIndex       GetIndexOfValue( CFTypeRef value ) const;
+            
+            void AppendValue( CFTypeRef value );
+            
+            friend void swap( ArrayIndex & v1, ArrayIndex & v2 ) noexcept;
+            
+        private:
+            
+            class Hasher
+            {
+                public:
+                    
+                    std::size_t operator ()( CFTypeRef value ) const;
+            };
+            
+            class EqualTo
+            {
+                public:
+                    
+                    bool operator ()( CFTypeRef v1, CFTypeRef v2 ) const;
+            };
+            
+            Array                                                     _array;
+            std::unordered_map< CFTypeRef, CFIndex, Hasher, EqualTo > _indexes;
+    };
+}
+
+#endif /* CFPP_ARRAY_INDEX_HPP */
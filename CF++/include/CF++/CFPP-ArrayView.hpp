@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-ArrayView.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ statically typed array views
+ */
+
+#ifndef CFPP_ARRAY_VIEW_HPP
+#define CFPP_ARRAY_VIEW_HPP
+
+namespace CF
+{
+    /*
+     * Typed, read-only view over a CF::Array, e.g. ArrayView< CFStringRef >.
+     * Values are fetched once with CFArrayGetValues and the element types
+     * are checked once, when the view is created. Passing check = false
+     * skips the type checks for arrays already known to be valid.
+     * 
+     * Elements are borrowed: they are not retained, and stay valid as long
+     * as the view exists. Iterators are plain pointers.
+     */
+    template< typename _T_ >
+    class CFPP_EXPORT ArrayView
+    {
+        public:
+            
+            typedef const _T_ * Iterator;
+            
+            ArrayView( const Array & array, bool check = true ): _array( array ), _valid( false )
+            {
+                CFIndex  count;
+                CFTypeID typeID;
+                
+                if( this->_array.IsValid() == false )
+                {
+                    return;
+                }
+                
+                count = this->_array.GetCount();
+                
+                this->_values.resize( static_cast< size_t >( count ) );
+                
+                if( count > 0 )
+                {
+                    CFArrayGetValues( static_cast< CFArrayRef >( this->_array.GetCFObject() ), CFRangeMake( 0, count ), reinterpret_cast< const void ** >( this->_values.data() ) );
+                }
+                
+                typeID = GetElementTypeID();
+                
+                if( check && typeID != 0 )
+                {
+                    for( _T_ value: this->_values )
+                    {
+                        if( value == nullptr || CFGetTypeID( value ) != typeID )
+                        {
+                            this->_values.clear();
+                            
+                            return;
+                        }
+                    }
+                }
+                
+                this->_valid = true;
+            }
+            
+            bool IsValid() const
+            {
+                return this->_valid;
+            }
+            
+            CFIndex GetCount() const
+            {
+                return static_cast< CFIndex >( this->_values.size() );
+            }
+            
+            _T_ operator [] ( CFIndex index ) const
+            {
+                if( index < 0 || index >= this->GetCount() )
+                {
+                    return nullptr;
+                }
+                
+                return this->_values[ static_cast< size_t >( index ) ];
+            }
+            
+            const Array & GetArray() const
+            {
+                return this->_array;
+            }
+            
+            Iterator begin() const
+            {
+                return this->_values.data();
+            }
+            
+            Iterator end() const
+            {
+                return this->_values.data() + this->_values.size();
+            }
+            
+        private:
+            
+            static CFTypeID GetElementTypeID();
+            
+            Array              _array;
+            std::vector< _T_ > _values;
+            bool               _valid;
+    };
+    
+    template<> inline CFTypeID ArrayView< CFTypeRef       >::GetElementTypeID() { return 0; }
+    template<> inline CFTypeID ArrayView< CFBooleanRef    >::GetElementTypeID() { return CFBooleanGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFNumberRef     >::GetElementTypeID() { return CFNumberGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFStringRef     >::GetElementTypeID() { return CFStringGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFDateRef       >::GetElementTypeID() { return CFDateGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFDataRef       >::GetElementTypeID() { return CFDataGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFURLRef        >::GetElementTypeID() { return CFURLGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFUUIDRef       >::GetElementTypeID() { return CFUUIDGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFArrayRef      >::GetElementTypeID() { return CFArrayGetTypeID(); }
+    template<> inline CFTypeID ArrayView< CFDictionaryRef >::GetElementTypeID() { return CFDictionaryGetTypeID(); }
+}
+
+#endif /* CFPP_ARRAY_VIEW_HPP */
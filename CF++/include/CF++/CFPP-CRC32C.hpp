@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-CRC32C.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Incremental CRC-32C checksum
+ */
+
+#ifndef CFPP_CRC32C_HPP
+#define CFPP_CRC32C_HPP
+
+namespace CF
+{
+    /*
+     * CRC-32C (Castagnoli), as used by iSCSI, ext4 or LevelDB. Uses the
+     * SSE4.2 (picked at runtime) or ARMv8 CRC instructions when available,
+     * and slicing-by-8 tables otherwise. Values are stable across processes
+     * and platforms, unlike CFHash.
+     */
+    class CFPP_EXPORT CRC32C
+    {
+        public:
+            
+            CRC32C();
+            CRC32C( const CRC32C & value );
+            CRC32C( CRC32C && value ) noexcept;
+            
+            virtual ~CRC32C();
+            
+            CRC32C & operator =( CRC32C value );
+            
+            static UInt32 Compute( const Data & data );
+            static UInt32 Compute( const Data::Byte * bytes, CFIndex length );
+            
+            UInt32 GetValue() const;
+            
+            void Reset();
+            void Update( const Data & data );
+            void Update( const Data::Byte * bytes, CFIndex length );
+            
+            /*
+             * Reads an open stream up to its end.
+             * Returns false on a read error, keeping what was read so far.
+             */
+            bool Update( ReadStream & stream );
+            
+            friend void swap( CRC32C & v1, CRC32C & v2 ) noexcept;
+            
+        private:
+            
+            UInt32 _crc;
+    };
+}
+
+#endif /* CFPP_CRC32C_HPP */
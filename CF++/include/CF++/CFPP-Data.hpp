@@ -47,6 +47,29 @@ namespace CF
             
             #endif
             
+            typedef enum
+            {
+                AccessNormal        = 0x00,
+                AccessSequential    = 0x01,
+                AccessRandom        = 0x02
+            }
+            Access;
+            
+            typedef enum
+            {
+                ByteOrderLittleEndian   = 0x00,
+                ByteOrderBigEndian      = 0x01
+            }
+            ByteOrder;
+            
+            typedef enum
+            {
+                CompressionZlib     = 0x00,
+                CompressionGzip     = 0x01,
+                CompressionDeflate  = 0x02
+            }
+            Compression;
+            
             Data();
             Data( CFIndex capacity );
             Data( const Data & value );
@@ -62,6 +85,51 @@ namespace CF
             
             ~Data() override;
             
+            /*
+             * Copies share the underlying CFData, which is only copied on the
+             * first mutating call. Share retains an existing object, Adopt
+             * takes over a +1 reference (e.g. from a Create function).
+             * A shared CFMutableData changed elsewhere remains visible until
+             * this object is mutated.
+             */
+            static Data Share( CFDataRef value );
+            static Data Adopt( CFDataRef value );
+            
+            /*
+             * Wraps external bytes as-is (CFDataCreateWithBytesNoCopy).
+             * Without a deallocator, the caller guarantees the bytes outlive
+             * the data. Otherwise the deallocator is called once the bytes
+             * are no longer needed. The vector overload takes ownership.
+             * The first mutating call works on a copy.
+             */
+            static Data NoCopy( const Byte * bytes, CFIndex length );
+            static Data NoCopy( const Byte * bytes, CFIndex length, CFAllocatorRef deallocator );
+            static Data NoCopy( const Byte * bytes, CFIndex length, std::function< void( const Byte *, CFIndex ) > deallocator );
+            static Data NoCopy( std::vector< Byte > && value );
+            
+            /*
+             * Maps a regular file read-only (mmap / MapViewOfFile), unmapped
+             * when the data is released. The access hint is passed on to
+             * madvise or CreateFile. The file must not be truncated while
+             * mapped. Invalid if the file cannot be mapped.
+             */
+            static Data MapFile( const std::string & path, Access access = AccessNormal );
+            static Data MapFile( const char * path, Access access = AccessNormal );
+            static Data MapFile( const URL & url, Access access = AccessNormal );
+            
+            /*
+             * Hex and Base64 (RFC 4648) codecs, with SSE2 or AVX2 kernels
+             * picked at runtime. Hex digits may be in either case. Base64
+             * decoding skips whitespace and does not require padding.
+             * Invalid input decodes to an invalid data.
+             */
+            static Data FromHex( const String & value );
+            static Data FromHex( const std::string & value );
+            static Data FromHex( const char * value );
+            static Data FromBase64( const String & value );
+            static Data FromBase64( const std::string & value );
+            static Data FromBase64( const char * value );
+            
             Data & operator =( Data value );
             Data & operator =( const AutoPointer & value );
             Data & operator =( CFTypeRef value );
@@ -73,6 +141,9 @@ namespace CF
             operator const Byte * () const;
             operator std::string  () const;
             
+            /* Detaches shared or read-only storage first, like other mutators */
+            operator CFMutableDataRef () const override;
+            
             Byte operator [] ( int index ) const;
             
             Data & operator += ( Byte value );
@@ -90,6 +161,30 @@ namespace CF
             void         GetBytes( CFRange range, Byte * bytes )                           const;
             CFRange      Find( const Data & data, CFRange range, CFDataSearchFlags flags ) const;
             
+            /*
+             * Forward searches use a first/last byte filter with SSE2 or
+             * AVX2 (picked at runtime), or memchr elsewhere.
+             * An empty pattern is never found.
+             */
+            CFRange                Find( const Data & data, CFIndex from = 0 )                               const;
+            CFRange                Find( const Byte * bytes, CFIndex length, CFIndex from = 0 )              const;
+            std::vector< CFIndex > FindAll( const Data & data, bool overlapping = false )                    const;
+            std::vector< CFIndex > FindAll( const Byte * bytes, CFIndex length, bool overlapping = false )   const;
+            
+            String ToHex( bool uppercase = false ) const;
+            String ToBase64()                      const;
+            
+            /*
+             * zlib compression, only available with CFPP_ZLIB. Decompressing
+             * accepts either a zlib or a gzip header (but not raw deflate),
+             * and reads concatenated gzip members as one in either mode,
+             * while data following a zlib or deflate stream is an error.
+             * The level goes from 0 to 9, -1 being zlib's default.
+             * Failures give an invalid data.
+             */
+            Data Compress( Compression format = CompressionZlib, int level = -1 ) const;
+            Data Decompress( Compression format = CompressionZlib )            const;
+            
             void         SetLength( CFIndex length );
             void         IncreaseLength( CFIndex extraLength );
             void         AppendBytes( const Byte * bytes, CFIndex length );
@@ -98,20 +193,25 @@ namespace CF
             
             friend void swap( Data & v1, Data & v2 ) noexcept;
             
+            /*
+             * Iterators do not retain the data, so that a live iterator does
+             * not force a copy on the next write. As with std::vector, any
+             * mutation of the Data, or its destruction, invalidates them.
+             */
             #if __cplusplus >= 201703L
             class CFPP_EXPORT Iterator
             #else
-            class CFPP_EXPORT Iterator: public std::iterator< std::bidirectional_iterator_tag, Byte >
+            class CFPP_EXPORT Iterator: public std::iterator< std::random_access_iterator_tag, Byte, ptrdiff_t, const Byte *, Byte >
             #endif
             {
                 public:
                 
                     #if __cplusplus >= 201703L
-                    using iterator_category = std::bidirectional_iterator_tag;
+                    using iterator_category = std::random_access_iterator_tag;
                     using value_type        = Byte;
                     using difference_type   = ptrdiff_t;
-                    using pointer           = Byte *;
-                    using reference         = Byte &;
+                    using pointer           = const Byte *;
+                    using reference         = Byte;
                     #endif
                     
                     Iterator();
@@ -129,17 +229,24 @@ namespace CF
                     Iterator & operator += ( CFIndex value );
                     Iterator & operator -= ( CFIndex value );
                     
-                    Iterator operator +( CFIndex value );
-                    Iterator operator -( CFIndex value );
+                    Iterator operator +( CFIndex value ) const;
+                    Iterator operator -( CFIndex value ) const;
+                    CFIndex  operator -( const Iterator & value ) const;
                     
                     bool operator == ( const Iterator & value ) const;
                     bool operator != ( const Iterator & value ) const;
+                    bool operator <  ( const Iterator & value ) const;
+                    bool operator >  ( const Iterator & value ) const;
+                    bool operator <= ( const Iterator & value ) const;
+                    bool operator >= ( const Iterator & value ) const;
                     
                     Byte operator *() const;
+                    Byte operator []( CFIndex index ) const;
                     
                     operator Byte () const;
                     
-                    friend void swap( Iterator & v1, Iterator & v2 ) noexcept;
+                    friend void     swap( Iterator & v1, Iterator & v2 ) noexcept;
+                    friend Iterator operator +( CFIndex value, const Iterator & it );
                     
                 private:
                     
@@ -153,13 +260,89 @@ namespace CF
                     const Byte * _bp;
             };
             
+            /*
+             * Aho-Corasick automaton over a set of byte patterns, built once
+             * as a full transition table and reusable for any number of
+             * searches. Reports every (possibly overlapping) occurrence,
+             * ordered by end position.
+             */
+            class CFPP_EXPORT Matcher
+            {
+                public:
+                    
+                    typedef struct
+                    {
+                        CFRange range;
+                        CFIndex pattern;
+                    }
+                    Match;
+                    
+                    Matcher();
+                    Matcher( const std::vector< Data > & patterns );
+                    Matcher( std::initializer_list< Data > patterns );
+                    Matcher( const Matcher & value );
+                    Matcher( Matcher && value ) noexcept;
+                    
+                    virtual ~Matcher();
+                    
+                    Matcher & operator =( Matcher value );
+                    
+                    CFIndex              GetPatternCount()                           const;
+                    std::vector< Match > FindAll( const Data & data )                const;
+                    std::vector< Match > FindAll( const Byte * bytes, CFIndex length ) const;
+                    
+                    friend void swap( Matcher & v1, Matcher & v2 ) noexcept;
+                    
+                private:
+                    
+                    void Build( const Data * patterns, std::size_t count );
+                    
+                    std::vector< int32_t >                _next;
+                    std::vector< int32_t >                _dict;
+                    std::vector< CFIndex >                _lengths;
+                    std::vector< std::vector< CFIndex > > _patterns;
+            };
+            
             Iterator begin() const;
             Iterator end()   const;
             
+            #ifdef __cpp_lib_span
+            
+            /*
+             * Contiguous views over the bytes, for standard and vectorized
+             * algorithms. Defined inline, as the library itself may be built
+             * without C++20. AsMutableSpan copies shared data first.
+             */
+            std::span< const Byte > AsSpan()        const;
+            std::span< Byte >       AsMutableSpan();
+            
+            #endif
+            
         private:
             
-            CFMutableDataRef _cfObject;
+            CFMutableDataRef GetMutableCFObject() const;
+            
+            mutable CFDataRef _cfObject;
+            mutable bool      _mutable;
     };
+    
+    #ifdef __cpp_lib_span
+    
+    inline std::span< const Data::Byte > Data::AsSpan() const
+    {
+        return std::span< const Byte >( this->GetBytePtr(), static_cast< std::size_t >( this->GetLength() ) );
+    }
+    
+    inline std::span< Data::Byte > Data::AsMutableSpan()
+    {
+        Byte * bytes;
+        
+        bytes = this->GetMutableBytePtr();
+        
+        return std::span< Byte >( bytes, static_cast< std::size_t >( this->GetLength() ) );
+    }
+    
+    #endif
 }
 
 #endif /* CFPP_DATA_HPP */
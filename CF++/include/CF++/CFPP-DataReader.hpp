@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-DataReader.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Binary reader over CF::Data
+ */
+
+#ifndef CFPP_DATA_READER_HPP
+#define CFPP_DATA_READER_HPP
+
+namespace CF
+{
+    /*
+     * Cursor over the bytes of a CF::Data, which is retained (not copied).
+     * Reads past the end return 0 and set a sticky failure flag, so a whole
+     * record can be checked once, either up-front with Require or after
+     * decoding with HasFailed. Slices are sub-readers over the same bytes.
+     */
+    class CFPP_EXPORT DataReader
+    {
+        public:
+            
+            DataReader();
+            DataReader( const Data & data, Data::ByteOrder order = Data::ByteOrderLittleEndian );
+            DataReader( const DataReader & value );
+            DataReader( DataReader && value ) noexcept;
+            
+            virtual ~DataReader();
+            
+            DataReader & operator =( DataReader value );
+            
+            CFIndex            GetLength()    const;
+            CFIndex            GetPosition()  const;
+            CFIndex            GetRemaining() const;
+            const Data::Byte * GetBytePtr()   const;
+            Data::ByteOrder    GetByteOrder() const;
+            bool               HasFailed()    const;
+            bool               IsAtEnd()      const;
+            
+            void SetByteOrder( Data::ByteOrder order );
+            bool SetPosition( CFIndex position );
+            bool Skip( CFIndex length );
+            bool Require( CFIndex length );
+            
+            UInt8   GetU8();
+            UInt16  GetU16();
+            UInt32  GetU32();
+            UInt64  GetU64();
+            Float32 GetF32();
+            Float64 GetF64();
+            UInt64  GetVarUInt();
+            SInt64  GetVarInt();
+            bool    GetBytes( Data::Byte * bytes, CFIndex length );
+            
+            /*
+             * Zero-copy sub-readers. GetVarSlice reads a LEB128 length first.
+             */
+            DataReader GetSlice( CFIndex length );
+            DataReader GetVarSlice();
+            
+            friend void swap( DataReader & v1, DataReader & v2 ) noexcept;
+            
+        private:
+            
+            bool Consume( CFIndex length, const Data::Byte * & bytes );
+            
+            CFDataRef          _cfObject;
+            const Data::Byte * _bytes;
+            CFIndex            _length;
+            CFIndex            _pos;
+            Data::ByteOrder    _order;
+            bool               _failed;
+    };
+}
+
+#endif /* CFPP_DATA_READER_HPP */
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-DataWriter.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Buffered binary writer producing CF::Data
+ */
+
+#ifndef CFPP_DATA_WRITER_HPP
+#define CFPP_DATA_WRITER_HPP
+
+namespace CF
+{
+    /*
+     * Bytes are collected in a local buffer with geometric growth, which is
+     * never zero-filled, and only handed to CF on Commit, trimmed to its
+     * length. Multi-byte values use the writer's byte order.
+     * A write that cannot grow the buffer is dropped and sets a sticky
+     * failure flag, checked with HasFailed and reset by Clear or Commit.
+     */
+    class CFPP_EXPORT DataWriter
+    {
+        public:
+            
+            DataWriter( Data::ByteOrder order = Data::ByteOrderLittleEndian );
+            DataWriter( CFIndex capacity, Data::ByteOrder order = Data::ByteOrderLittleEndian );
+            DataWriter( const DataWriter & value );
+            DataWriter( DataWriter && value ) noexcept;
+            
+            virtual ~DataWriter();
+            
+            DataWriter & operator =( DataWriter value );
+            
+            CFIndex         GetLength()    const;
+            CFIndex         GetCapacity()  const;
+            Data::ByteOrder GetByteOrder() const;
+            bool            HasFailed()    const;
+            
+            void SetByteOrder( Data::ByteOrder order );
+            void Reserve( CFIndex capacity );
+            void Clear();
+            
+            void PutU8( UInt8 value );
+            void PutU16( UInt16 value );
+            void PutU32( UInt32 value );
+            void PutU64( UInt64 value );
+            void PutF32( Float32 value );
+            void PutF64( Float64 value );
+            void PutBytes( const Data::Byte * bytes, CFIndex length );
+            void PutData( const Data & value );
+            
+            /*
+             * LEB128: unsigned, and signed (sign-extended, not zigzag).
+             */
+            void PutVarUInt( UInt64 value );
+            void PutVarInt( SInt64 value );
+            
+            /*
+             * Commit hands the buffer over to a new CF::Data without copying,
+             * CommitTo appends it to an existing one in a single call.
+             * After a failed write, Commit returns an invalid Data and
+             * CommitTo leaves the data unchanged.
+             * The writer is left empty either way.
+             */
+            Data Commit();
+            void CommitTo( Data & data );
+            
+            friend void swap( DataWriter & v1, DataWriter & v2 ) noexcept;
+            
+        private:
+            
+            bool Grow( CFIndex length );
+            
+            Data::Byte    * _buffer;
+            CFIndex         _capacity;
+            CFIndex         _length;
+            Data::ByteOrder _order;
+            bool            _failed;
+    };
+}
+
+#endif /* CFPP_DATA_WRITER_HPP */
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-DeflateStream.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Compressing adaptor for CF::WriteStream
+ */
+
+#ifndef CFPP_DEFLATE_STREAM_HPP
+#define CFPP_DEFLATE_STREAM_HPP
+
+struct z_stream_s;
+
+namespace CF
+{
+    /*
+     * Compresses data written to a stream, which must be open, and is left
+     * open. Compressed bytes go through a single buffer, reused for every
+     * write. Finish writes the end of the compressed data, and is called on
+     * destruction if needed. Without CFPP_ZLIB, writes always fail.
+     */
+    class CFPP_EXPORT DeflateStream
+    {
+        public:
+            
+            DeflateStream( const WriteStream & stream, Data::Compression format = Data::CompressionZlib, int level = -1 );
+            DeflateStream( const DeflateStream & value ) = delete;
+            DeflateStream( DeflateStream && value ) noexcept;
+            
+            virtual ~DeflateStream();
+            
+            DeflateStream & operator =( DeflateStream value );
+            
+            bool IsValid()    const;
+            bool IsFinished() const;
+            bool HasFailed()  const;
+            
+            /*
+             * Returns the number of bytes consumed (all of them) or -1 if the
+             * compressed data could not be written.
+             */
+            CFIndex Write( const Data::Byte * buffer, CFIndex length );
+            CFIndex Write( const Data & data );
+            
+            /*
+             * Flush writes everything compressed so far, so a reader can
+             * decompress it, at some cost in compression ratio.
+             */
+            bool Flush();
+            bool Finish();
+            
+            friend void swap( DeflateStream & v1, DeflateStream & v2 ) noexcept;
+            
+        private:
+            
+            bool _Deflate( int flush );
+            
+            WriteStream               _stream;
+            struct z_stream_s       * _z;
+            std::vector< Data::Byte > _buffer;
+            bool                      _finished;
+            bool                      _failed;
+    };
+}
+
+#endif /* CFPP_DEFLATE_STREAM_HPP */
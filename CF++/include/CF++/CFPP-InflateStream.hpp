@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-InflateStream.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Decompressing adaptor for CF::ReadStream
+ */
+
+#ifndef CFPP_INFLATE_STREAM_HPP
+#define CFPP_INFLATE_STREAM_HPP
+
+struct z_stream_s;
+struct gz_header_s;
+
+namespace CF
+{
+    /*
+     * Decompresses data read from a stream, which must be open, and is left
+     * open. The zlib and gzip formats accept either header, and concatenated
+     * gzip members are read as one in either mode, while data following a
+     * zlib or deflate stream is an error. Compressed bytes go through a
+     * single buffer, reused for every read. Without CFPP_ZLIB, reads always
+     * fail.
+     */
+    class CFPP_EXPORT InflateStream
+    {
+        public:
+            
+            InflateStream( const ReadStream & stream, Data::Compression format = Data::CompressionZlib );
+            InflateStream( const InflateStream & value ) = delete;
+            InflateStream( InflateStream && value ) noexcept;
+            
+            virtual ~InflateStream();
+            
+            InflateStream & operator =( InflateStream value );
+            
+            bool IsValid()   const;
+            bool IsAtEnd()   const;
+            bool HasFailed() const;
+            
+            /*
+             * Returns the number of decompressed bytes, 0 once the compressed
+             * data has ended, or -1 on a read error or corrupt data.
+             * The Data overload reads everything if length is 0, and gives an
+             * invalid data on failure.
+             */
+            CFIndex Read( Data::Byte * buffer, CFIndex length );
+            Data    Read( CFIndex length = 0 );
+            
+            friend void swap( InflateStream & v1, InflateStream & v2 ) noexcept;
+            
+        private:
+            
+            CFIndex _Fill();
+            
+            ReadStream                _stream;
+            struct z_stream_s       * _z;
+            struct gz_header_s      * _header;
+            std::vector< Data::Byte > _buffer;
+            bool                      _end;
+            bool                      _failed;
+    };
+}
+
+#endif /* CFPP_INFLATE_STREAM_HPP */
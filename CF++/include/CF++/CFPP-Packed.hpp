@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-Packed.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ reductions over packed numbers
+ */
+
+#ifndef CFPP_PACKED_HPP
+#define CFPP_PACKED_HPP
+
+namespace CF
+{
+    /*
+     * Reductions over packed values, e.g. from Array::ToPackedDoubles.
+     * Uses SSE2 or NEON when available. Floating point sums are computed
+     * in several lanes, so rounding may differ slightly from a sequential
+     * sum. Integer sums wrap around on overflow; integer means don't.
+     * Empty inputs give 0. Min and Max expect values without NaN.
+     */
+    class CFPP_EXPORT Packed
+    {
+        public:
+            
+            static double Sum( const double * values, CFIndex count );
+            static SInt64 Sum( const SInt64 * values, CFIndex count );
+            static double Sum( const std::vector< double > & values );
+            static SInt64 Sum( const std::vector< SInt64 > & values );
+            
+            static double Min( const double * values, CFIndex count );
+            static SInt64 Min( const SInt64 * values, CFIndex count );
+            static double Min( const std::vector< double > & values );
+            static SInt64 Min( const std::vector< SInt64 > & values );
+            
+            static double Max( const double * values, CFIndex count );
+            static SInt64 Max( const SInt64 * values, CFIndex count );
+            static double Max( const std::vector< double > & values );
+            static SInt64 Max( const std::vector< SInt64 > & values );
+            
+            static double Mean( const double * values, CFIndex count );
+            static double Mean( const SInt64 * values, CFIndex count );
+            static double Mean( const std::vector< double > & values );
+            static double Mean( const std::vector< SInt64 > & values );
+    };
+}
+
+#endif /* CFPP_PACKED_HPP */
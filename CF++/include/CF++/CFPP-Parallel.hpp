@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-Parallel.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ parallel algorithms over arrays
+ */
+
+#ifndef CFPP_PARALLEL_HPP
+#define CFPP_PARALLEL_HPP
+
+#include <mutex>
+#include <utility>
+
+namespace CF
+{
+    /*
+     * Data-parallel algorithms over CF::Array and CF::ArrayView.
+     * The index space is split into chunks, run on a small internal thread
+     * pool and on the calling thread. Calls block until all chunks are done.
+     * Small inputs and calls nested in another parallel call run on the
+     * calling thread.
+     * 
+     * Callbacks receive the array values (CFTypeRef, or the view's type),
+     * run concurrently, and must not throw.
+     * Map and Filter build their result with a single CFArrayCreate call.
+     */
+    class CFPP_EXPORT Parallel
+    {
+        public:
+            
+            /*
+             * Calls work( begin, end ) for consecutive ranges covering
+             * [ 0, count ), each at least grain long (except the last).
+             */
+            static void Run( CFIndex count, const std::function< void( CFIndex, CFIndex ) > & work, CFIndex grain = 1024 );
+            
+            /*
+             * Stable merge sort. The comparator is a CFComparatorFunction,
+             * like Array::CompareStrings and Array::CompareNumbers.
+             */
+            static void Sort( Array & array, CFComparatorFunction comparator, void * context = nullptr );
+            
+            template< typename F >
+            static void ForEach( const Array & array, F f )
+            {
+                ForEach( ArrayView< CFTypeRef >( array, false ), f );
+            }
+            
+            template< typename _T_, typename F >
+            static void ForEach( const ArrayView< _T_ > & view, F f )
+            {
+                const _T_ * values = view.begin();
+                
+                Run
+                (
+                    view.GetCount(),
+                    [ & ]( CFIndex begin, CFIndex end )
+                    {
+                        for( CFIndex i = begin; i < end; i++ )
+                        {
+                            f( values[ i ] );
+                        }
+                    }
+                );
+            }
+            
+            /*
+             * f returns a value of any type accepted by Array::FromRange.
+             * NULL results are skipped.
+             */
+            template< typename F >
+            static Array Map( const Array & array, F f )
+            {
+                return Map( ArrayView< CFTypeRef >( array, false ), f );
+            }
+            
+            template< typename _T_, typename F >
+            static Array Map( const ArrayView< _T_ > & view, F f )
+            {
+                const _T_              * values = view.begin();
+                std::vector< CFTypeRef > results( static_cast< size_t >( view.GetCount() ) );
+                
+                Run
+                (
+                    view.GetCount(),
+                    [ & ]( CFIndex begin, CFIndex end )
+                    {
+                        for( CFIndex i = begin; i < end; i++ )
+                        {
+                            results[ static_cast< size_t >( i ) ] = Array::CopyElement( f( values[ i ] ) );
+                        }
+                    }
+                );
+                
+                results.erase( std::remove( results.begin(), results.end(), nullptr ), results.end() );
+                
+                return Array::AdoptValues( results );
+            }
+            
+            template< typename F >
+            static Array Filter( const Array & array, F predicate )
+            {
+                return Filter( ArrayView< CFTypeRef >( array, false ), predicate );
+            }
+            
+            template< typename _T_, typename F >
+            static Array Filter( const ArrayView< _T_ > & view, F predicate )
+            {
+                const _T_                  * values = view.begin();
+                std::vector< unsigned char > keep( static_cast< size_t >( view.GetCount() ) );
+                std::vector< CFTypeRef >     results;
+                
+                Run
+                (
+                    view.GetCount(),
+                    [ & ]( CFIndex begin, CFIndex end )
+                    {
+                        for( CFIndex i = begin; i < end; i++ )
+                        {
+                            keep[ static_cast< size_t >( i ) ] = ( predicate( values[ i ] ) ) ? 1 : 0;
+                        }
+                    }
+                );
+                
+                results.reserve( keep.size() );
+                
+                for( size_t i = 0; i < keep.size(); i++ )
+                {
+                    if( keep[ i ] != 0 )
+                    {
+                        results.push_back( values[ i ] );
+                    }
+                }
+                
+                return Array::CopyValues( results );
+            }
+            
+            /*
+             * reduce( T, T ) must be associative. Partial results are
+             * combined in index order, starting with init.
+             * Without transform, values are converted like Array::ToVector.
+             */
+            template< typename T, typename R >
+            static T Reduce( const Array & array, T init, R reduce )
+            {
+                return Reduce( ArrayView< CFTypeRef >( array, false ), init, reduce );
+            }
+            
+            template< typename _T_, typename T, typename R >
+            static T Reduce( const ArrayView< _T_ > & view, T init, R reduce )
+            {
+                return Reduce( view, init, reduce, []( _T_ value ) { return Array::ConvertElement< T >( value ); } );
+            }
+            
+            template< typename T, typename R, typename F >
+            static T Reduce( const Array & array, T init, R reduce, F transform )
+            {
+                return Reduce( ArrayView< CFTypeRef >( array, false ), init, reduce, transform );
+            }
+            
+            template< typename _T_, typename T, typename R, typename F >
+            static T Reduce( const ArrayView< _T_ > & view, T init, R reduce, F transform )
+            {
+                const _T_                             * values = view.begin();
+                std::vector< std::pair< CFIndex, T > >  partials;
+                std::mutex                              lock;
+                
+                Run
+                (
+                    view.GetCount(),
+                    [ & ]( CFIndex begin, CFIndex end )
+                    {
+                        T partial = transform( values[ begin ] );
+                        
+                        for( CFIndex i = begin + 1; i < end; i++ )
+                        {
+                            partial = reduce( partial, transform( values[ i ] ) );
+                        }
+                        
+                        {
+                            std::lock_guard< std::mutex > l( lock );
+                            
+                            partials.emplace_back( begin, std::move( partial ) );
+                        }
+                    }
+                );
+                
+                std::sort
+                (
+                    partials.begin(),
+                    partials.end(),
+                    []( const std::pair< CFIndex, T > & p1, const std::pair< CFIndex, T > & p2 )
+                    {
+                        return p1.first < p2.first;
+                    }
+                );
+                
+                for( auto & p: partials )
+                {
+                    init = reduce( init, p.second );
+                }
+                
+                return init;
+            }
+    };
+}
+
+#endif /* CFPP_PARALLEL_HPP */
@@ -41,6 +41,15 @@ namespace CF
             
             bool ToPropertyList( const std::string & path, PropertyListFormat format = PropertyListFormatXML ) const;
             Data ToPropertyList( PropertyListFormat format = PropertyListFormatXML )                           const;
+            
+        protected:
+            
+            /*
+             * Reads a property list file, inflating gzip data. Regular files
+             * are memory-mapped only when map is set, as a file truncated
+             * while mapped raises SIGBUS.
+             */
+            static Data ReadPropertyListFile( const std::string & path, bool map );
     };
 }
 
@@ -34,31 +34,9 @@
 namespace CF
 {
     template < class T >
-    T PropertyListType< T >::FromPropertyList( const std::string & path )
+    T PropertyListType< T >::FromPropertyList( const std::string & path, bool map )
     {
-        Data        data;
-        URL         url;
-        ReadStream  stream;
-        AutoPointer ap;
-
-        if( path.length() == 0 )
-        {
-            return static_cast< CFTypeRef >( nullptr );
-        }
-
-        url = URL::FileSystemURL( path );
-        
-        if( stream.Open( url ) == false )
-        {
-            return static_cast< CFTypeRef >( nullptr );
-        }
-        
-        data = stream.Read();
-        ap   = CFPropertyListCreateWithData( static_cast< CFAllocatorRef >( nullptr ), data, 0, nullptr, nullptr );
-        
-        stream.Close();
-        
-        return ap.As< T >();
+        return FromPropertyListData( ReadPropertyListFile( path, map ) );
     }
     
     template < class T >
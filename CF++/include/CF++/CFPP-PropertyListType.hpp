@@ -40,7 +40,11 @@ namespace CF
     {
         public:
             
-            static T FromPropertyList( const std::string & path );
+            /*
+             * With map, a regular file is memory-mapped rather than read.
+             * It must then not be truncated while being parsed.
+             */
+            static T FromPropertyList( const std::string & path, bool map = false );
             static T FromPropertyListString( const std::string & plist );
             static T FromPropertyListData( const Data & plist );
     };
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-StaticString.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ immortal string keys
+ */
+
+#ifndef CFPP_STATIC_STRING_HPP
+#define CFPP_STATIC_STRING_HPP
+
+#include <atomic>
+
+namespace CF
+{
+    /*
+     * Constant UTF-8 key, resolved once to an interned CFString
+     * (see String::Intern) and cached. Can be constant-initialized:
+     * 
+     *     static const CF::StaticString key( "Name" );
+     * 
+     * The characters are not copied and must outlive the object, which
+     * is always the case for string literals.
+     */
+    class CFPP_EXPORT StaticString
+    {
+        public:
+            
+            template< std::size_t N >
+            constexpr StaticString( const char ( & value )[ N ] ):
+                _value( value ),
+                _length( N - 1 ),
+                _cfObject( nullptr )
+            {}
+            
+            constexpr StaticString( const char * value, std::size_t length ):
+                _value( value ),
+                _length( length ),
+                _cfObject( nullptr )
+            {}
+            
+            StaticString( const StaticString & value );
+            
+            StaticString & operator =( const StaticString & value );
+            
+            operator CFStringRef () const;
+            
+            CFStringRef      GetCFObject()   const;
+            std::string_view GetStringView() const;
+            
+        private:
+            
+            const char                         * _value;
+            std::size_t                          _length;
+            mutable std::atomic< CFStringRef >   _cfObject;
+    };
+    
+    namespace Literals
+    {
+        /*
+         * Each use is a new StaticString with an empty cache, so it costs
+         * an interning lookup per call. In hot paths, prefer a
+         * static const StaticString, which is resolved only once.
+         */
+        constexpr StaticString operator "" _cfs( const char * value, std::size_t length )
+        {
+            return StaticString( value, length );
+        }
+    }
+}
+
+#endif /* CFPP_STATIC_STRING_HPP */
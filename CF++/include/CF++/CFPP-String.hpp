@@ -31,8 +31,13 @@
 #ifndef CFPP_STRING_HPP
 #define CFPP_STRING_HPP
 
+#include <atomic>
+
 namespace CF
 {
+    class Data;
+    class WriteStream;
+    
     class CFPP_EXPORT String: public PropertyListType< String >
     {
         public:
@@ -46,6 +51,7 @@ namespace CF
             String( CFTypeRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding = kCFStringEncodingUTF8 );
             String( CFStringRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding = kCFStringEncodingUTF8 );
             String( const std::string & value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            String( std::string_view value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
             String( char * value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
             String( const char * value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
             String( const String & value );
@@ -53,6 +59,26 @@ namespace CF
             
             ~String() override;
             
+            /*
+             * Wraps the bytes without copying them when CoreFoundation can use
+             * them as-is (CFStringCreateWithBytesNoCopy).
+             * Without a deallocator, the caller guarantees the bytes outlive
+             * the string. Otherwise the deallocator frees them once the
+             * string no longer needs them.
+             */
+            static String NoCopy( std::string_view value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            static String NoCopy( std::string_view value, CFAllocatorRef deallocator, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            
+            /*
+             * Process-wide table of immortal UTF-8 strings, meant for keys.
+             * Intern() adds the value on first use and always returns the
+             * same CFString for equal values; GetInterned() only looks it
+             * up and returns nullptr if it was never interned.
+             * The returned strings are never released.
+             */
+            static CFStringRef Intern( std::string_view value );
+            static CFStringRef GetInterned( std::string_view value );
+            
             String & operator =( String value );
             String & operator =( const AutoPointer & value );
             String & operator =( CFTypeRef value );
@@ -66,6 +92,7 @@ namespace CF
             bool operator == ( CFTypeRef value )           const;
             bool operator == ( CFStringRef value )         const;
             bool operator == ( const std::string & value ) const;
+            bool operator == ( std::string_view value )    const;
             bool operator == ( char * value )              const;
             bool operator == ( const char * value )        const;
             
@@ -73,6 +100,7 @@ namespace CF
             bool operator != ( CFTypeRef value )           const;
             bool operator != ( CFStringRef value )         const;
             bool operator != ( const std::string & value ) const;
+            bool operator != ( std::string_view value )    const;
             bool operator != ( char * value )              const;
             bool operator != ( const char * value )        const;
             
@@ -92,33 +120,93 @@ namespace CF
             bool HasPrefix( const String & value )      const;
             bool HasPrefix( CFStringRef value )         const;
             bool HasPrefix( const std::string & value ) const;
+            bool HasPrefix( std::string_view value )    const;
+            bool HasPrefix( const char * value )        const;
             bool HasSuffix( const String & value )      const;
             bool HasSuffix( CFStringRef value )         const;
             bool HasSuffix( const std::string & value ) const;
+            bool HasSuffix( std::string_view value )    const;
+            bool HasSuffix( const char * value )        const;
+            
+            /*
+             * Three-way comparison (CFStringCompare).
+             * UTF-8 values are compared in place when no flag is set, and
+             * wrapped without copying otherwise. A NULL string compares as
+             * an empty one. With flags, a value that is not valid UTF-8 is
+             * ordered literally and never compares equal.
+             */
+            CFComparisonResult Compare( const String & value,      CFStringCompareFlags flags = 0 ) const;
+            CFComparisonResult Compare( CFStringRef value,         CFStringCompareFlags flags = 0 ) const;
+            CFComparisonResult Compare( const std::string & value, CFStringCompareFlags flags = 0 ) const;
+            CFComparisonResult Compare( std::string_view value,    CFStringCompareFlags flags = 0 ) const;
+            CFComparisonResult Compare( const char * value,        CFStringCompareFlags flags = 0 ) const;
             
             CFIndex GetLength() const;
             
+            /*
+             * 64-bit FNV-1a over the UTF-8 representation, cached.
+             * A String and a UTF-8 view of the same characters always have
+             * the same hash. The wrapped CFString is assumed immutable.
+             */
+            std::size_t        GetHash()                         const;
+            static std::size_t GetHash( std::string_view value );
+            
             std::string  GetValue( CFStringEncoding encoding = kCFStringEncodingUTF8 )        const;
             const char * GetCStringValue( CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
             
-            void SetValue( const std::string & value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            /*
+             * Borrowed views - not NUL-terminated.
+             * Backed by the CFString storage when available, otherwise by
+             * a per-thread scratch buffer (valid until the next call on the
+             * same thread) or by the caller's buffer.
+             * Two scratch-backed views alias each other, so never use two
+             * GetStringView() calls in the same expression, as in
+             * a.GetStringView() == b.GetStringView(): pass a buffer to one.
+             * The scratch buffer is sized exactly, and storage grown past
+             * 64 KiB is released by the next smaller conversion.
+             * An empty view with a nullptr data() means the conversion failed.
+             */
+            std::string_view GetStringView( CFStringEncoding encoding = kCFStringEncodingUTF8 )                                   const;
+            std::string_view GetStringView( char * buffer, CFIndex length, CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
+            
+            void SetValue( std::string_view value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            
+            /*
+             * Streaming conversion through String::Encoder, with bounded
+             * memory. Returns false if a character cannot be converted
+             * (no lossByte) or if the stream fails.
+             */
+            bool WriteTo( WriteStream & stream, CFStringEncoding encoding = kCFStringEncodingUTF8, UInt8 lossByte = 0, bool includeBOM = false ) const;
+            bool AppendTo( Data & data,         CFStringEncoding encoding = kCFStringEncodingUTF8, UInt8 lossByte = 0, bool includeBOM = false ) const;
             
             friend void swap( String & v1, String & v2 ) noexcept;
             
+            /*
+             * Cursor over the bytes of the string in a given encoding.
+             * Bytes are converted in small chunks on demand, so iterating
+             * never allocates nor converts the whole string. Jumps are O(1)
+             * for fixed-width encodings or when CoreFoundation exposes its
+             * storage. Otherwise they walk chunk by chunk, in either
+             * direction, so the cost is proportional to the distance.
+             * Distances from end() measure the whole string.
+             * Iterators retain the CFString (a single retain, no copy), so
+             * they keep iterating over the original value after the String
+             * is modified or destroyed.
+             */
             #if __cplusplus >= 201703L
             class CFPP_EXPORT Iterator
             #else
-            class CFPP_EXPORT Iterator: public std::iterator< std::bidirectional_iterator_tag, char >
+            class CFPP_EXPORT Iterator: public std::iterator< std::random_access_iterator_tag, char, ptrdiff_t, const char *, char >
             #endif
             {
                 public:
                 
                     #if __cplusplus >= 201703L
-                    using iterator_category = std::bidirectional_iterator_tag;
+                    using iterator_category = std::random_access_iterator_tag;
                     using value_type        = char;
                     using difference_type   = ptrdiff_t;
-                    using pointer           = char *;
-                    using reference         = char &;
+                    using pointer           = const char *;
+                    using reference         = char;
                     #endif
                     
                     Iterator();
@@ -136,36 +224,273 @@ namespace CF
                     Iterator & operator += ( CFIndex value );
                     Iterator & operator -= ( CFIndex value );
                     
-                    Iterator operator +( CFIndex value );
-                    Iterator operator -( CFIndex value );
+                    Iterator operator +( CFIndex value ) const;
+                    Iterator operator -( CFIndex value ) const;
+                    CFIndex  operator -( const Iterator & value ) const;
                     
                     bool operator == ( const Iterator & value ) const;
                     bool operator != ( const Iterator & value ) const;
+                    bool operator <  ( const Iterator & value ) const;
+                    bool operator >  ( const Iterator & value ) const;
+                    bool operator <= ( const Iterator & value ) const;
+                    bool operator >= ( const Iterator & value ) const;
                     
                     char operator *() const;
+                    char operator []( CFIndex index ) const;
                     
                     operator char () const;
                     
-                    friend void swap( Iterator & v1, Iterator & v2 ) noexcept;
+                    friend void     swap( Iterator & v1, Iterator & v2 ) noexcept;
+                    friend Iterator operator +( CFIndex value, const Iterator & it );
                     
                 private:
                     
                     friend class String;
                     
-                    Iterator( CFStringRef string, CFStringEncoding encoding, CFIndex length, CFIndex pos = 0 );
+                    Iterator( CFStringRef string, CFStringEncoding encoding, bool end );
+                    
+                    bool    IsAtEnd()              const;
+                    bool    Load( CFIndex pos )    const;
+                    bool    Rewind( CFIndex pos )  const;
+                    char    GetByte( CFIndex pos ) const;
+                    CFIndex GetPosition()          const;
+                    CFIndex GetByteLength()        const;
+                    void    Resolve();
                     
-                    CFStringRef             _cfObject;
-                    CFIndex                 _length;
-                    CFIndex                 _pos;
-                    std::shared_ptr< char > _cp;
+                    CFStringRef      _cfObject;
+                    CFStringEncoding _encoding;
+                    CFIndex          _characters;
+                    CFIndex          _width;
+                    const char     * _cp;
+                    CFIndex          _pos;
+                    bool             _end;
+                    mutable CFIndex  _chunkStart;
+                    mutable CFIndex  _chunkLength;
+                    mutable CFIndex  _chunkSource;
+                    mutable CFIndex  _chunkCharacters;
+                    mutable char     _chunk[ 64 ];
             };
             
             Iterator begin( CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
             Iterator end(   CFStringEncoding encoding = kCFStringEncodingUTF8 ) const;
             
+            /*
+             * Indexed access over UTF-16 code units.
+             * Reads straight from the CFString storage when it is exposed,
+             * otherwise through a small cache refilled on demand, so
+             * sequential scans are O(1) per character.
+             * Out of range indexes return 0.
+             */
+            class CFPP_EXPORT CharacterView
+            {
+                public:
+                    
+                    CharacterView();
+                    CharacterView( const String & string );
+                    CharacterView( const CharacterView & value );
+                    CharacterView( CharacterView && value ) noexcept;
+                    
+                    virtual ~CharacterView();
+                    
+                    CharacterView & operator =( CharacterView value );
+                    
+                    UniChar operator [] ( CFIndex index ) const;
+                    
+                    CFIndex         GetLength()         const;
+                    const UniChar * GetCharactersPtr()  const;
+                    
+                    friend void swap( CharacterView & v1, CharacterView & v2 ) noexcept;
+                    
+                private:
+                    
+                    CFStringRef                  _cfObject;
+                    mutable CFStringInlineBuffer _buffer;
+            };
+            
+            /*
+             * Forward iterator over Unicode code points.
+             * Surrogate pairs are combined, unpaired surrogates are reported
+             * as U+FFFD. GetIndex() is the UTF-16 offset of the current
+             * code point.
+             */
+            class CodePointView;
+            
+            class CFPP_EXPORT CodePointIterator
+            {
+                public:
+                    
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type        = UTF32Char;
+                    using difference_type   = ptrdiff_t;
+                    using pointer           = const UTF32Char *;
+                    using reference         = UTF32Char;
+                    
+                    CodePointIterator();
+                    CodePointIterator( const CodePointIterator & value );
+                    CodePointIterator( CodePointIterator && value ) noexcept;
+                    
+                    virtual ~CodePointIterator();
+                    
+                    CodePointIterator & operator =( CodePointIterator value );
+                    CodePointIterator & operator ++();
+                    CodePointIterator   operator ++( int );
+                    
+                    bool operator == ( const CodePointIterator & value ) const;
+                    bool operator != ( const CodePointIterator & value ) const;
+                    
+                    UTF32Char operator *() const;
+                    
+                    CFIndex GetIndex() const;
+                    
+                    friend void swap( CodePointIterator & v1, CodePointIterator & v2 ) noexcept;
+                    
+                private:
+                    
+                    friend class CodePointView;
+                    
+                    CodePointIterator( CFStringRef string, CFIndex pos );
+                    
+                    void Decode();
+                    
+                    CFStringRef          _cfObject;
+                    CFIndex              _length;
+                    CFIndex              _pos;
+                    CFIndex              _next;
+                    UTF32Char            _value;
+                    CFStringInlineBuffer _buffer;
+            };
+            
+            class CFPP_EXPORT CodePointView
+            {
+                public:
+                    
+                    CodePointView();
+                    CodePointView( const String & string );
+                    CodePointView( const CodePointView & value );
+                    CodePointView( CodePointView && value ) noexcept;
+                    
+                    virtual ~CodePointView();
+                    
+                    CodePointView & operator =( CodePointView value );
+                    
+                    CodePointIterator begin() const;
+                    CodePointIterator end()   const;
+                    
+                    friend void swap( CodePointView & v1, CodePointView & v2 ) noexcept;
+                    
+                private:
+                    
+                    CFStringRef _cfObject;
+            };
+            
+            /*
+             * Incremental CFStringGetBytes: each Read() converts as many
+             * whole characters as fit in the caller's buffer.
+             * Unconvertible characters are replaced by lossByte, or stop
+             * the conversion (HasFailed) if it is 0. The optional byte
+             * order mark is written before the first character for the
+             * UTF-8, UTF-16 and UTF-32 encodings.
+             */
+            class CFPP_EXPORT Encoder
+            {
+                public:
+                    
+                    Encoder();
+                    Encoder( const String & string, CFStringEncoding encoding = kCFStringEncodingUTF8, UInt8 lossByte = 0, bool includeBOM = false );
+                    Encoder( const Encoder & value );
+                    Encoder( Encoder && value ) noexcept;
+                    
+                    virtual ~Encoder();
+                    
+                    Encoder & operator =( Encoder value );
+                    
+                    CFIndex Read( UInt8 * buffer, CFIndex length );
+                    
+                    bool    IsAtEnd()     const;
+                    bool    HasFailed()   const;
+                    CFIndex GetLocation() const;
+                    
+                    friend void swap( Encoder & v1, Encoder & v2 ) noexcept;
+                    
+                private:
+                    
+                    CFStringRef      _cfObject;
+                    CFStringEncoding _encoding;
+                    UInt8            _lossByte;
+                    bool             _bom;
+                    bool             _failed;
+                    CFIndex          _location;
+                    CFIndex          _length;
+            };
+            
+            /*
+             * Transparent functors for standard containers, allowing lookups
+             * by std::string_view without building a String.
+             * Less orders by UTF-16 code units, like CFStringCompare.
+             * NULL strings are equal to each other.
+             */
+            class CFPP_EXPORT Hasher
+            {
+                public:
+                    
+                    using is_transparent = void;
+                    
+                    std::size_t operator ()( const String & value )   const;
+                    std::size_t operator ()( std::string_view value ) const;
+            };
+            
+            class CFPP_EXPORT EqualTo
+            {
+                public:
+                    
+                    using is_transparent = void;
+                    
+                    bool operator ()( const String & v1,   const String & v2 )   const;
+                    bool operator ()( const String & v1,   std::string_view v2 ) const;
+                    bool operator ()( std::string_view v1, const String & v2 )   const;
+                    bool operator ()( std::string_view v1, std::string_view v2 ) const;
+            };
+            
+            class CFPP_EXPORT Less
+            {
+                public:
+                    
+                    using is_transparent = void;
+                    
+                    bool operator ()( const String & v1,   const String & v2 )   const;
+                    bool operator ()( const String & v1,   std::string_view v2 ) const;
+                    bool operator ()( std::string_view v1, const String & v2 )   const;
+                    bool operator ()( std::string_view v1, std::string_view v2 ) const;
+            };
+            
+            CharacterView GetCharacters() const;
+            CodePointView GetCodePoints() const;
+            
         private:
             
-            CFStringRef _cfObject;
+            CFStringRef                          _cfObject;
+            mutable std::atomic< std::size_t >   _hash;
+    };
+}
+
+namespace std
+{
+    template<>
+    struct hash< CF::String >
+    {
+        std::size_t operator ()( const CF::String & value ) const
+        {
+            return value.GetHash();
+        }
+    };
+    
+    template<>
+    struct equal_to< CF::String >
+    {
+        bool operator ()( const CF::String & v1, const CF::String & v2 ) const
+        {
+            return CF::String::EqualTo()( v1, v2 );
+        }
     };
 }
 
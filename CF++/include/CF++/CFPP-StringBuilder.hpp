@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-StringBuilder.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ CFMutableStringRef builder
+ */
+
+#ifndef CFPP_STRING_BUILDER_HPP
+#define CFPP_STRING_BUILDER_HPP
+
+namespace CF
+{
+    class CFPP_EXPORT StringBuilder: public Type
+    {
+        public:
+            
+            StringBuilder();
+            StringBuilder( CFIndex capacity );
+            StringBuilder( const String & value );
+            StringBuilder( const StringBuilder & value );
+            StringBuilder( StringBuilder && value ) noexcept;
+            
+            ~StringBuilder() override;
+            
+            StringBuilder & operator =( StringBuilder value );
+            
+            StringBuilder & operator << ( const String & value );
+            StringBuilder & operator << ( CFStringRef value );
+            StringBuilder & operator << ( std::string_view value );
+            StringBuilder & operator << ( const std::string & value );
+            StringBuilder & operator << ( const char * value );
+            StringBuilder & operator << ( char value );
+            StringBuilder & operator << ( signed short value );
+            StringBuilder & operator << ( signed int value );
+            StringBuilder & operator << ( signed long value );
+            StringBuilder & operator << ( signed long long value );
+            StringBuilder & operator << ( unsigned short value );
+            StringBuilder & operator << ( unsigned int value );
+            StringBuilder & operator << ( unsigned long value );
+            StringBuilder & operator << ( unsigned long long value );
+            StringBuilder & operator << ( float value );
+            StringBuilder & operator << ( double value );
+            
+            CFTypeID  GetTypeID()   const override;
+            CFTypeRef GetCFObject() const override;
+            
+            CFIndex GetLength() const;
+            
+            void Reserve( CFIndex capacity );
+            void Clear();
+            
+            void Append( const String & value );
+            void Append( CFStringRef value );
+            void Append( std::string_view value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            void Append( const std::string & value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            void Append( const char * value, CFStringEncoding encoding = kCFStringEncodingUTF8 );
+            void Append( char value );
+            void Append( signed short value );
+            void Append( signed int value );
+            void Append( signed long value );
+            void Append( signed long long value );
+            void Append( unsigned short value );
+            void Append( unsigned int value );
+            void Append( unsigned long value );
+            void Append( unsigned long long value );
+            void Append( float value );
+            void Append( double value );
+            void AppendCharacters( const UniChar * characters, CFIndex length );
+            
+            /*
+             * Returns the built string as a compact immutable copy, releasing
+             * the builder's storage. The builder is left empty.
+             */
+            String Freeze();
+            
+            friend void swap( StringBuilder & v1, StringBuilder & v2 ) noexcept;
+            
+        private:
+            
+            CFMutableStringRef _cfObject;
+            CFIndex            _capacity;
+    };
+}
+
+#endif /* CFPP_STRING_BUILDER_HPP */
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      CFPP-XXH3.hpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Incremental XXH3 64-bit hash
+ */
+
+#ifndef CFPP_XXH3_HPP
+#define CFPP_XXH3_HPP
+
+namespace CF
+{
+    /*
+     * XXH3, 64-bit variant (xxHash 0.8), with the default secret.
+     * Non-cryptographic; values match other XXH3 implementations and are
+     * stable across processes and platforms, unlike CFHash.
+     * Input is buffered by 256-byte blocks, so updates of any size give
+     * the same value as hashing everything at once.
+     */
+    class CFPP_EXPORT XXH3
+    {
+        public:
+            
+            XXH3( UInt64 seed = 0 );
+            XXH3( const XXH3 & value );
+            XXH3( XXH3 && value ) noexcept;
+            
+            virtual ~XXH3();
+            
+            XXH3 & operator =( XXH3 value );
+            
+            static UInt64 Compute( const Data & data, UInt64 seed = 0 );
+            static UInt64 Compute( const Data::Byte * bytes, CFIndex length, UInt64 seed = 0 );
+            
+            UInt64 GetSeed()  const;
+            UInt64 GetValue() const;
+            
+            void Reset();
+            void Update( const Data & data );
+            void Update( const Data::Byte * bytes, CFIndex length );
+            
+            /*
+             * Reads an open stream up to its end.
+             * Returns false on a read error, keeping what was read so far.
+             */
+            bool Update( ReadStream & stream );
+            
+            friend void swap( XXH3 & v1, XXH3 & v2 ) noexcept;
+            
+        private:
+            
+            UInt64     _seed;
+            UInt64     _length;
+            UInt64     _acc[ 8 ];
+            CFIndex    _stripes;
+            CFIndex    _buffered;
+            Data::Byte _secret[ 192 ];
+            Data::Byte _buffer[ 256 ];
+    };
+}
+
+#endif /* CFPP_XXH3_HPP */
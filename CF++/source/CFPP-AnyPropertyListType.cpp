@@ -32,32 +32,9 @@
 
 namespace CF
 {
-    AnyPropertyListType AnyPropertyListType::FromPropertyList( const std::string & path )
+    AnyPropertyListType AnyPropertyListType::FromPropertyList( const std::string & path, bool map )
     {
-        Data                 data;
-        URL                  url;
-        ReadStream           stream;
-        AutoPointer          ap;
-        CFPropertyListFormat f;
-
-        if( path.length() == 0 )
-        {
-            return { static_cast< CFTypeRef >( nullptr ), PropertyListFormatBinary };
-        }
-
-        url = URL::FileSystemURL( path );
-        
-        if( stream.Open( url ) == false )
-        {
-            return { static_cast< CFTypeRef >( nullptr ), PropertyListFormatBinary };
-        }
-        
-        data = stream.Read();
-        ap   = CFPropertyListCreateWithData( static_cast< CFAllocatorRef >( nullptr ), data, 0, &f, nullptr );
-        
-        stream.Close();
-        
-        return { ap, ( f == kCFPropertyListBinaryFormat_v1_0 ) ? PropertyListFormatBinary : PropertyListFormatXML };
+        return FromPropertyListData( ReadPropertyListFile( path, map ) );
     }
     
     AnyPropertyListType AnyPropertyListType::FromPropertyListString( const std::string & plist )
@@ -118,9 +118,94 @@ static void __createCallbacks()
 
 #endif
 
+template< typename T >
+static std::vector< T > __ToPacked( CFArrayRef array, CFNumberType type, CFIndex * mismatch );
+template< typename T >
+static std::vector< T > __ToPacked( CFArrayRef array, CFNumberType type, CFIndex * mismatch )
+{
+    std::vector< CFTypeRef > values;
+    std::vector< T >         packed;
+    CFTypeID                 typeID;
+    CFIndex                  count;
+    bool                     exact;
+    
+    if( mismatch != nullptr )
+    {
+        *( mismatch ) = kCFNotFound;
+    }
+    
+    count = ( array == nullptr ) ? 0 : CFArrayGetCount( array );
+    
+    if( count == 0 )
+    {
+        return packed;
+    }
+    
+    values.resize( static_cast< size_t >( count ) );
+    packed.resize( static_cast< size_t >( count ) );
+    
+    CFArrayGetValues( array, CFRangeMake( 0, count ), values.data() );
+    
+    typeID = CFNumberGetTypeID();
+    
+    for( size_t i = 0; i < values.size(); i++ )
+    {
+        exact = false;
+        
+        if( values[ i ] != nullptr && CFGetTypeID( values[ i ] ) == typeID )
+        {
+            /* False for lossy conversions (eg 3.7 as SInt64), though the converted value is still stored */
+            exact = CFNumberGetValue( static_cast< CFNumberRef >( values[ i ] ), type, &( packed[ i ] ) ) ? true : false;
+        }
+        
+        if( exact == false && mismatch != nullptr && *( mismatch ) == kCFNotFound )
+        {
+            *( mismatch ) = static_cast< CFIndex >( i );
+        }
+    }
+    
+    return packed;
+}
+
+template< typename T >
+static std::vector< CFTypeRef > __FromPacked( const T * values, CFIndex count, CFNumberType type );
+template< typename T >
+static std::vector< CFTypeRef > __FromPacked( const T * values, CFIndex count, CFNumberType type )
+{
+    std::vector< CFTypeRef > numbers;
+    
+    if( values == nullptr || count <= 0 )
+    {
+        return numbers;
+    }
+    
+    numbers.reserve( static_cast< size_t >( count ) );
+    
+    for( CFIndex i = 0; i < count; i++ )
+    {
+        numbers.push_back( CFNumberCreate( static_cast< CFAllocatorRef >( nullptr ), type, values + i ) );
+    }
+    
+    return numbers;
+}
+
+static CFComparisonResult __CompareTypeIDs( const void * value1, const void * value2 );
+static CFComparisonResult __CompareTypeIDs( const void * value1, const void * value2 )
+{
+    CFTypeID typeID1 = ( value1 == nullptr ) ? 0 : CFGetTypeID( value1 );
+    CFTypeID typeID2 = ( value2 == nullptr ) ? 0 : CFGetTypeID( value2 );
+    
+    if( typeID1 == typeID2 )
+    {
+        return kCFCompareEqualTo;
+    }
+    
+    return ( typeID1 < typeID2 ) ? kCFCompareLessThan : kCFCompareGreaterThan;
+}
+
 namespace CF
 {
-    Array::Array(): _cfObject( nullptr )
+    Array::Array(): _cfObject( nullptr ), _mutable( true )
     {
         __createCallbacks();
         
@@ -132,7 +217,7 @@ namespace CF
         );
     }
     
-    Array::Array( CFIndex capacity ): _cfObject( nullptr )
+    Array::Array( CFIndex capacity ): _cfObject( nullptr ), _mutable( true )
     {
         __createCallbacks();
         
@@ -144,63 +229,43 @@ namespace CF
         );
     }
     
-    Array::Array( const Array & value ): _cfObject( nullptr )
+    Array::Array( const Array & value ): _cfObject( value._cfObject ), _mutable( value._mutable )
     {
         __createCallbacks();
         
-        if( value._cfObject != nullptr )
+        if( this->_cfObject != nullptr )
         {
-            this->_cfObject = CFArrayCreateMutableCopy
-            (
-                static_cast< CFAllocatorRef >( nullptr ),
-                CFArrayGetCount( value._cfObject ),
-                value._cfObject
-            );
+            CFRetain( this->_cfObject );
         }
     }
     
-    Array::Array( const AutoPointer & value ): _cfObject( nullptr )
+    Array::Array( const AutoPointer & value ): _cfObject( nullptr ), _mutable( false )
     {
         __createCallbacks();
         
         if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
         {
-            this->_cfObject = CFArrayCreateMutableCopy
-            (
-                static_cast< CFAllocatorRef >( nullptr ),
-                CFArrayGetCount( value ),
-                value
-            );
+            this->_cfObject = static_cast< CFArrayRef >( CFRetain( value ) );
         }
     }
     
-    Array::Array( CFTypeRef value ): _cfObject( nullptr )
+    Array::Array( CFTypeRef value ): _cfObject( nullptr ), _mutable( false )
     {
         __createCallbacks();
         
         if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
         {
-            this->_cfObject = CFArrayCreateMutableCopy
-            (
-                static_cast< CFAllocatorRef >( nullptr ),
-                CFArrayGetCount( static_cast< CFArrayRef >( value ) ),
-                static_cast< CFArrayRef >( value )
-            );
+            this->_cfObject = static_cast< CFArrayRef >( CFRetain( value ) );
         }
     }
     
-    Array::Array( CFArrayRef value ): _cfObject( nullptr )
+    Array::Array( CFArrayRef value ): _cfObject( nullptr ), _mutable( false )
     {
         __createCallbacks();
         
         if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
         {
-            this->_cfObject = CFArrayCreateMutableCopy
-            (
-                static_cast< CFAllocatorRef >( nullptr ),
-                CFArrayGetCount( value ),
-                value
-            );
+            this->_cfObject = static_cast< CFArrayRef >( CFRetain( value ) );
         }
     }
     
@@ -211,10 +276,7 @@ namespace CF
     {
         for( CFTypeRef o: value )
         {
-            if( o != nullptr )
-            {
-                CFArrayAppendValue( this->_cfObject, o );
-            }
+            this->AppendValue( o );
         }
     }
     
@@ -222,6 +284,8 @@ namespace CF
     {
         this->_cfObject = value._cfObject;
         value._cfObject = nullptr;
+        this->_mutable  = value._mutable;
+        value._mutable  = false;
     }
     
     Array::~Array()
@@ -234,6 +298,90 @@ namespace CF
         }
     }
     
+    Array Array::Borrow( CFArrayRef value )
+    {
+        return Array( value );
+    }
+    
+    Array Array::Adopt( CFArrayRef value )
+    {
+        Array array( static_cast< CFArrayRef >( nullptr ) );
+        
+        if( value == nullptr )
+        {
+            return array;
+        }
+        
+        if( CFGetTypeID( value ) != CFArrayGetTypeID() )
+        {
+            CFRelease( value );
+            
+            return array;
+        }
+        
+        array._cfObject = value;
+        
+        return array;
+    }
+    
+    Array Array::CopyValues( const std::vector< CFTypeRef > & values )
+    {
+        __createCallbacks();
+        
+        return Adopt
+        (
+            CFArrayCreate
+            (
+                static_cast< CFAllocatorRef >( nullptr ),
+                const_cast< const void ** >( values.data() ),
+                static_cast< CFIndex >( values.size() ),
+                &__callbacks
+            )
+        );
+    }
+    
+    Array Array::AdoptValues( const std::vector< CFTypeRef > & values )
+    {
+        Array array( CopyValues( values ) );
+        
+        for( CFTypeRef value: values )
+        {
+            CFRelease( value );
+        }
+        
+        return array;
+    }
+    
+    std::vector< double > Array::ToPackedDoubles( CFIndex * mismatch ) const
+    {
+        return __ToPacked< double >( this->_cfObject, kCFNumberDoubleType, mismatch );
+    }
+    
+    std::vector< SInt64 > Array::ToPackedInt64( CFIndex * mismatch ) const
+    {
+        return __ToPacked< SInt64 >( this->_cfObject, kCFNumberSInt64Type, mismatch );
+    }
+    
+    Array Array::FromPacked( const double * values, CFIndex count )
+    {
+        return AdoptValues( __FromPacked( values, count, kCFNumberDoubleType ) );
+    }
+    
+    Array Array::FromPacked( const SInt64 * values, CFIndex count )
+    {
+        return AdoptValues( __FromPacked( values, count, kCFNumberSInt64Type ) );
+    }
+    
+    Array Array::FromPacked( const std::vector< double > & values )
+    {
+        return FromPacked( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    Array Array::FromPacked( const std::vector< SInt64 > & values )
+    {
+        return FromPacked( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
     Array & Array::operator =( Array value )
     {
         swap( *( this ), value );
@@ -287,6 +435,15 @@ namespace CF
     
     Array & Array::operator << ( const char * value )
     {
+        CFStringRef s;
+        
+        s = String::GetInterned( ( value == nullptr ) ? "" : value );
+        
+        if( s != nullptr )
+        {
+            return operator <<( static_cast< CFTypeRef >( s ) );
+        }
+        
         return operator <<( String( value ) );
     }
     
@@ -305,6 +462,11 @@ namespace CF
         return this->GetValueAtIndex( static_cast< CFIndex >( index ) );
     }
     
+    Array::operator CFMutableArrayRef () const
+    {
+        return this->GetMutableCFObject();
+    }
+    
     CFTypeID Array::GetTypeID() const
     {
         return CFArrayGetTypeID();
@@ -337,10 +499,14 @@ namespace CF
     
     void Array::RemoveAllValues()
     {
-        if( this->_cfObject != nullptr )
+        CFMutableArrayRef array;
+        
+        if( this->GetCount() == 0 || ( array = this->GetMutableCFObject() ) == nullptr )
         {
-            CFArrayRemoveAllValues( this->_cfObject );
+            return;
         }
+        
+        CFArrayRemoveAllValues( array );
     }
     
     CFTypeRef Array::GetValueAtIndex( CFIndex index ) const
@@ -355,70 +521,147 @@ namespace CF
     
     void Array::SetValueAtIndex( CFTypeRef value, CFIndex index )
     {
-        if( this->_cfObject == nullptr || index > this->GetCount() || value == nullptr )
+        CFMutableArrayRef array;
+        
+        if( index > this->GetCount() || value == nullptr || ( array = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFArraySetValueAtIndex( this->_cfObject, index, value );
+        CFArraySetValueAtIndex( array, index, value );
     }
     
     void Array::InsertValueAtIndex( CFTypeRef value, CFIndex index )
     {
-        if( this->_cfObject == nullptr || index > this->GetCount() || value == nullptr )
+        CFMutableArrayRef array;
+        
+        if( index > this->GetCount() || value == nullptr || ( array = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFArrayInsertValueAtIndex( this->_cfObject, index, value );
+        CFArrayInsertValueAtIndex( array, index, value );
     }
     
     void Array::AppendValue( CFTypeRef value )
     {
-        if( this->_cfObject == nullptr || value == nullptr )
+        CFMutableArrayRef array;
+        
+        if( value == nullptr || ( array = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFArrayAppendValue( this->_cfObject, value );
+        CFArrayAppendValue( array, value );
     }
     
     void Array::RemoveValueAtIndex( CFIndex index )
     {
-        if( this->_cfObject == nullptr || index >= this->GetCount() )
+        CFMutableArrayRef array;
+        
+        if( index >= this->GetCount() || ( array = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFArrayRemoveValueAtIndex( this->_cfObject, index );
+        CFArrayRemoveValueAtIndex( array, index );
     }
     
     void Array::AppendArray( CFArrayRef array )
     {
+        CFMutableArrayRef target;
+        
         if( array == nullptr || CFGetTypeID( array ) != this->GetTypeID() )
         {
             return;
         }
         
-        if( this->_cfObject != nullptr )
+        /* Keeps the values alive if array is our own storage and gets detached */
+        CFRetain( array );
+        
+        if( ( target = this->GetMutableCFObject() ) != nullptr )
         {
             CFArrayAppendArray
             (
-                this->_cfObject,
+                target,
                 array,
                 CFRangeMake( 0, CFArrayGetCount( array ) )
             );
         }
+        
+        CFRelease( array );
     }
     
     void Array::ExchangeValuesAtIndices( CFIndex index1, CFIndex index2 )
     {
-        if( this->_cfObject == nullptr || index1 >= this->GetCount() || index2 >= this->GetCount() )
+        CFMutableArrayRef array;
+        
+        if( index1 >= this->GetCount() || index2 >= this->GetCount() || ( array = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFArrayExchangeValuesAtIndices( this->_cfObject, index1, index2 );
+        CFArrayExchangeValuesAtIndices( array, index1, index2 );
+    }
+    
+    void Array::Sort( CFComparatorFunction comparator, void * context )
+    {
+        CFMutableArrayRef array;
+        
+        if( comparator == nullptr || this->GetCount() < 2 || ( array = this->GetMutableCFObject() ) == nullptr )
+        {
+            return;
+        }
+        
+        CFArraySortValues( array, CFRangeMake( 0, CFArrayGetCount( array ) ), comparator, context );
+    }
+    
+    CFIndex Array::BinarySearch( CFTypeRef value, CFComparatorFunction comparator, void * context ) const
+    {
+        CFIndex count;
+        CFIndex index;
+        
+        count = this->GetCount();
+        
+        if( comparator == nullptr || value == nullptr || count == 0 )
+        {
+            return kCFNotFound;
+        }
+        
+        index = CFArrayBSearchValues( this->_cfObject, CFRangeMake( 0, count ), value, comparator, context );
+        
+        if( index < 0 || index >= count || comparator( CFArrayGetValueAtIndex( this->_cfObject, index ), value, context ) != kCFCompareEqualTo )
+        {
+            return kCFNotFound;
+        }
+        
+        return index;
+    }
+    
+    CFComparisonResult Array::CompareStrings( const void * value1, const void * value2, void * context )
+    {
+        CFStringCompareFlags flags;
+        
+        if( value1 == nullptr || value2 == nullptr || CFGetTypeID( value1 ) != CFStringGetTypeID() || CFGetTypeID( value2 ) != CFStringGetTypeID() )
+        {
+            return __CompareTypeIDs( value1, value2 );
+        }
+        
+        flags = ( context == nullptr ) ? 0 : *( static_cast< CFStringCompareFlags * >( context ) );
+        
+        return CFStringCompare( static_cast< CFStringRef >( value1 ), static_cast< CFStringRef >( value2 ), flags );
+    }
+    
+    CFComparisonResult Array::CompareNumbers( const void * value1, const void * value2, void * context )
+    {
+        ( void )context;
+        
+        if( value1 == nullptr || value2 == nullptr || CFGetTypeID( value1 ) != CFNumberGetTypeID() || CFGetTypeID( value2 ) != CFNumberGetTypeID() )
+        {
+            return __CompareTypeIDs( value1, value2 );
+        }
+        
+        return CFNumberCompare( static_cast< CFNumberRef >( value1 ), static_cast< CFNumberRef >( value2 ), nullptr );
     }
     
     Array::Iterator Array::begin() const
@@ -431,10 +674,44 @@ namespace CF
         return Iterator( this->_cfObject, this->GetCount(), this->GetCount() );
     }
         
+    CFMutableArrayRef Array::GetMutableCFObject() const
+    {
+        CFMutableArrayRef array;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return nullptr;
+        }
+        
+        /* Copy on first write if the object is shared or was not created mutable by us */
+        if( this->_mutable == false || CFGetRetainCount( this->_cfObject ) > 1 )
+        {
+            array = CFArrayCreateMutableCopy
+            (
+                static_cast< CFAllocatorRef >( nullptr ),
+                0,
+                this->_cfObject
+            );
+            
+            if( array == nullptr )
+            {
+                return nullptr;
+            }
+            
+            CFRelease( this->_cfObject );
+            
+            this->_cfObject = array;
+            this->_mutable  = true;
+        }
+        
+        return const_cast< CFMutableArrayRef >( this->_cfObject );
+    }
+    
     void swap( Array & v1, Array & v2 ) noexcept
     {
         using std::swap;
         
         swap( v1._cfObject, v2._cfObject );
+        swap( v1._mutable,  v2._mutable );
     }
 }
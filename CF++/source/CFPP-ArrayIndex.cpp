@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-ArrayIndex.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ hashed lookup index for arrays
+ */
+
+#include <CF++.hpp>
+
+namespace CF
+{
+    ArrayIndex::ArrayIndex(): ArrayIndex( Array() )
+    {}
+    
+    ArrayIndex::ArrayIndex( const Array & array ): _array( array )
+    {
+        std::vector< CFTypeRef > values( static_cast< size_t >( this->_array.GetCount() ) );
+        
+        if( values.size() == 0 )
+        {
+            return;
+        }
+        
+        CFArrayGetValues
+        (
+            static_cast< CFArrayRef >( this->_array.GetCFObject() ),
+            CFRangeMake( 0, static_cast< CFIndex >( values.size() ) ),
+            values.data()
+        );
+        
+        this->_indexes.reserve( values.size() );
+        
+        for( size_t i = 0; i < values.size(); i++ )
+        {
+            if( values[ i ] != nullptr )
+            {
+                this->_indexes.emplace( values[ i ], static_cast< CFIndex >( i ) );
+            }
+        }
+    }
+    
+    ArrayIndex::ArrayIndex( const ArrayIndex & value ):
+        _array( value._array ),
+        _indexes( value._indexes )
+    {}
+    
+    ArrayIndex::ArrayIndex( ArrayIndex && value ) noexcept:
+        _array( std::move( value._array ) ),
+        _indexes( std::move( value._indexes ) )
+    {}
+    
+    ArrayIndex::~ArrayIndex()
+    {}
+    
+    ArrayIndex & ArrayIndex::operator =( ArrayIndex value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    const Array & ArrayIndex::GetArray() const
+    {
+        return this->_array;
+    }
+    
+    CFIndex ArrayIndex::GetCount() const
+    {
+        return this->_array.GetCount();
+    }
+    
+    bool ArrayIndex::ContainsValue( CFTypeRef value ) const
+    {
+        return this->GetIndexOfValue( value ) != kCFNotFound;
+    }
+    
+    CFIndex ArrayIndex::GetIndexOfValue( CFTypeRef value ) const
+    {
+        std::unordered_map< CFTypeRef, CFIndex, Hasher, EqualTo >::const_iterator it;
+        
+        if( value == nullptr )
+        {
+            return kCFNotFound;
+        }
+        
+        it = this->_indexes.find( value );
+        
+        if( it == this->_indexes.end() )
+        {
+            return kCFNotFound;
+        }
+        
+        return it->second;
+    }
+    
+    void ArrayIndex::AppendValue( CFTypeRef value )
+    {
+        CFIndex count;
+        
+        if( value == nullptr )
+        {
+            return;
+        }
+        
+        count = this->_array.GetCount();
+        
+        this->_array.AppendValue( value );
+        
+        if( this->_array.GetCount() == count + 1 )
+        {
+            this->_indexes.emplace( this->_array.GetValueAtIndex( count ), count );
+        }
+    }
+    
+    void swap( ArrayIndex & v1, ArrayIndex & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._array,   v2._array );
+        swap( v1._indexes, v2._indexes );
+    }
+    
+    std::size_t ArrayIndex::Hasher::operator ()( CFTypeRef value ) const
+    {
+        return static_cast< std::size_t >( CFHash( value ) );
+    }
+    
+    bool ArrayIndex::EqualTo::operator ()( CFTypeRef v1, CFTypeRef v2 ) const
+    {
+        return ( v1 == v2 || CFEqual( v1, v2 ) ) ? true : false;
+    }
+}
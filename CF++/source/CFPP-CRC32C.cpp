@@ -0,0 +1,324 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-CRC32C.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Incremental CRC-32C checksum
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#define CFPP_CRC32C_SSE42
+#if defined( _MSC_VER )
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <nmmintrin.h>
+#elif defined( __ARM_FEATURE_CRC32 )
+#define CFPP_CRC32C_ARM
+#include <arm_acle.h>
+#endif
+
+static UInt32 __Update( UInt32 crc, const CF::Data::Byte * p, CFIndex length );
+
+#ifndef CFPP_CRC32C_ARM
+
+typedef struct
+{
+    UInt32 t[ 8 ][ 256 ];
+}
+__Tables;
+
+static const __Tables & __GetTables();
+static UInt32           __Read32( const CF::Data::Byte * p );
+static UInt32           __UpdateScalar( UInt32 crc, const CF::Data::Byte * p, CFIndex length );
+
+/* Reflected polynomial 0x82F63B78; t[ k ] advances a byte through k more zero bytes */
+static const __Tables & __GetTables()
+{
+    static const __Tables tables = []()
+    {
+        __Tables t;
+        UInt32   c;
+        unsigned i;
+        unsigned j;
+        
+        for( i = 0; i < 256; i++ )
+        {
+            c = i;
+            
+            for( j = 0; j < 8; j++ )
+            {
+                c = ( c >> 1 ) ^ ( ( c & 1 ) ? 0x82F63B78u : 0 );
+            }
+            
+            t.t[ 0 ][ i ] = c;
+        }
+        
+        for( i = 0; i < 256; i++ )
+        {
+            for( j = 1; j < 8; j++ )
+            {
+                t.t[ j ][ i ] = ( t.t[ j - 1 ][ i ] >> 8 ) ^ t.t[ 0 ][ t.t[ j - 1 ][ i ] & 0xFF ];
+            }
+        }
+        
+        return t;
+    }();
+    
+    return tables;
+}
+
+static UInt32 __Read32( const CF::Data::Byte * p )
+{
+    UInt32 v;
+    
+    memcpy( &v, p, sizeof( v ) );
+    
+    return CFSwapInt32LittleToHost( v );
+}
+
+static UInt32 __UpdateScalar( UInt32 crc, const CF::Data::Byte * p, CFIndex length )
+{
+    const __Tables & t = __GetTables();
+    UInt32           lo;
+    UInt32           hi;
+    
+    for( ; length >= 8; p += 8, length -= 8 )
+    {
+        lo  = crc ^ __Read32( p );
+        hi  = __Read32( p + 4 );
+        crc = t.t[ 7 ][ lo & 0xFF ] ^ t.t[ 6 ][ ( lo >> 8 ) & 0xFF ] ^ t.t[ 5 ][ ( lo >> 16 ) & 0xFF ] ^ t.t[ 4 ][ lo >> 24 ]
+            ^ t.t[ 3 ][ hi & 0xFF ] ^ t.t[ 2 ][ ( hi >> 8 ) & 0xFF ] ^ t.t[ 1 ][ ( hi >> 16 ) & 0xFF ] ^ t.t[ 0 ][ hi >> 24 ];
+    }
+    
+    for( ; length > 0; p++, length-- )
+    {
+        crc = t.t[ 0 ][ ( crc ^ *( p ) ) & 0xFF ] ^ ( crc >> 8 );
+    }
+    
+    return crc;
+}
+
+#endif
+
+#ifdef CFPP_CRC32C_SSE42
+
+static bool   __HasSSE42();
+static UInt32 __UpdateSSE42( UInt32 crc, const CF::Data::Byte * p, CFIndex length );
+
+static bool __HasSSE42()
+{
+    static const bool sse42 = []()
+    {
+        #ifdef _MSC_VER
+        
+        int r[ 4 ];
+        
+        __cpuid( r, 1 );
+        
+        return ( r[ 2 ] & ( 1 << 20 ) ) != 0;
+        
+        #else
+        
+        unsigned int a;
+        unsigned int b;
+        unsigned int c;
+        unsigned int d;
+        
+        if( __get_cpuid( 1, &a, &b, &c, &d ) == 0 )
+        {
+            return false;
+        }
+        
+        return ( c & ( 1u << 20 ) ) != 0;
+        
+        #endif
+    }();
+    
+    return sse42;
+}
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+__attribute__( ( target( "sse4.2" ) ) )
+#endif
+static UInt32 __UpdateSSE42( UInt32 crc, const CF::Data::Byte * p, CFIndex length )
+{
+    UInt64 c;
+    UInt64 v;
+    
+    c = crc;
+    
+    for( ; length >= 8; p += 8, length -= 8 )
+    {
+        memcpy( &v, p, sizeof( v ) );
+        
+        c = _mm_crc32_u64( c, v );
+    }
+    
+    crc = static_cast< UInt32 >( c );
+    
+    for( ; length > 0; p++, length-- )
+    {
+        crc = _mm_crc32_u8( crc, *( p ) );
+    }
+    
+    return crc;
+}
+
+#endif
+
+#ifdef CFPP_CRC32C_ARM
+
+static UInt32 __UpdateARM( UInt32 crc, const CF::Data::Byte * p, CFIndex length );
+
+static UInt32 __UpdateARM( UInt32 crc, const CF::Data::Byte * p, CFIndex length )
+{
+    uint64_t v;
+    
+    for( ; length >= 8; p += 8, length -= 8 )
+    {
+        memcpy( &v, p, sizeof( v ) );
+        
+        crc = __crc32cd( crc, v );
+    }
+    
+    for( ; length > 0; p++, length-- )
+    {
+        crc = __crc32cb( crc, *( p ) );
+    }
+    
+    return crc;
+}
+
+#endif
+
+static UInt32 __Update( UInt32 crc, const CF::Data::Byte * p, CFIndex length )
+{
+    #if defined( CFPP_CRC32C_ARM )
+    
+    return __UpdateARM( crc, p, length );
+    
+    #else
+    
+    #ifdef CFPP_CRC32C_SSE42
+    
+    if( __HasSSE42() )
+    {
+        return __UpdateSSE42( crc, p, length );
+    }
+    
+    #endif
+    
+    return __UpdateScalar( crc, p, length );
+    
+    #endif
+}
+
+namespace CF
+{
+    CRC32C::CRC32C(): _crc( 0 )
+    {}
+    
+    CRC32C::CRC32C( const CRC32C & value ): _crc( value._crc )
+    {}
+    
+    CRC32C::CRC32C( CRC32C && value ) noexcept: _crc( value._crc )
+    {
+        value._crc = 0;
+    }
+    
+    CRC32C::~CRC32C()
+    {}
+    
+    CRC32C & CRC32C::operator =( CRC32C value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    UInt32 CRC32C::Compute( const Data & data )
+    {
+        return CRC32C::Compute( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    UInt32 CRC32C::Compute( const Data::Byte * bytes, CFIndex length )
+    {
+        CRC32C crc;
+        
+        crc.Update( bytes, length );
+        
+        return crc.GetValue();
+    }
+    
+    UInt32 CRC32C::GetValue() const
+    {
+        return this->_crc;
+    }
+    
+    void CRC32C::Reset()
+    {
+        this->_crc = 0;
+    }
+    
+    void CRC32C::Update( const Data & data )
+    {
+        this->Update( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    void CRC32C::Update( const Data::Byte * bytes, CFIndex length )
+    {
+        if( bytes == nullptr || length <= 0 )
+        {
+            return;
+        }
+        
+        this->_crc = ~__Update( ~( this->_crc ), bytes, length );
+    }
+    
+    bool CRC32C::Update( ReadStream & stream )
+    {
+        std::vector< Data::Byte > buffer( 65536 );
+        CFIndex                   n;
+        
+        while( ( n = stream.Read( &( buffer[ 0 ] ), static_cast< CFIndex >( buffer.size() ) ) ) > 0 )
+        {
+            this->Update( &( buffer[ 0 ] ), n );
+        }
+        
+        return n == 0;
+    }
+    
+    void swap( CRC32C & v1, CRC32C & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._crc, v2._crc );
+    }
+}
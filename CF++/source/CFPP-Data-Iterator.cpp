@@ -44,12 +44,7 @@ namespace CF
         _length( value._length ),
         _pos( value._pos ),
         _bp( value._bp )
-    {
-        if( this->_cfObject != nullptr )
-        {
-            CFRetain( this->_cfObject );
-        }
-    }
+    {}
     
     Data::Iterator::Iterator( CFDataRef data, CFIndex length, CFIndex pos ):
         _cfObject( data ),
@@ -59,8 +54,6 @@ namespace CF
     {
         if( this->_cfObject != nullptr )
         {
-            CFRetain( this->_cfObject );
-            
             this->_bp = CFDataGetBytePtr( this->_cfObject );
         }
     }
@@ -78,12 +71,7 @@ namespace CF
     }
     
     Data::Iterator::~Iterator()
-    {
-        if( this->_cfObject != nullptr )
-        {
-            CFRelease( this->_cfObject );
-        }
-    }
+    {}
     
     Data::Iterator & Data::Iterator::operator =( Iterator value )
     {
@@ -138,7 +126,7 @@ namespace CF
         return *( this );
     }
     
-    Data::Iterator Data::Iterator::operator +( CFIndex value )
+    Data::Iterator Data::Iterator::operator +( CFIndex value ) const
     {
         Iterator i;
         
@@ -147,7 +135,7 @@ namespace CF
         return i += value;
     }
     
-    Data::Iterator Data::Iterator::operator -( CFIndex value )
+    Data::Iterator Data::Iterator::operator -( CFIndex value ) const
     {
         Iterator i;
         
@@ -156,6 +144,11 @@ namespace CF
         return i -= value;
     }
     
+    CFIndex Data::Iterator::operator -( const Iterator & value ) const
+    {
+        return this->_pos - value._pos;
+    }
+    
     bool Data::Iterator::operator == ( const Iterator & value ) const
     {
         if( this->_cfObject != value._cfObject )
@@ -181,29 +174,49 @@ namespace CF
         return !( *( this ) == value );
     }
     
+    bool Data::Iterator::operator < ( const Iterator & value ) const
+    {
+        return this->_pos < value._pos;
+    }
+    
+    bool Data::Iterator::operator > ( const Iterator & value ) const
+    {
+        return this->_pos > value._pos;
+    }
+    
+    bool Data::Iterator::operator <= ( const Iterator & value ) const
+    {
+        return this->_pos <= value._pos;
+    }
+    
+    bool Data::Iterator::operator >= ( const Iterator & value ) const
+    {
+        return this->_pos >= value._pos;
+    }
+    
     Data::Byte Data::Iterator::operator *() const
     {
-        if( this->_cfObject == nullptr )
+        /* A single unsigned comparison also rejects negative positions; _bp is set whenever _length > 0 */
+        if( static_cast< size_t >( this->_pos ) >= static_cast< size_t >( this->_length ) )
         {
             return 0;
         }
         
-        if( this->_bp == nullptr )
-        {
-            return 0;
-        }
+        return this->_bp[ this->_pos ];
+    }
+    
+    Data::Byte Data::Iterator::operator []( CFIndex index ) const
+    {
+        CFIndex pos;
         
-        if( this->_pos < 0 )
-        {
-            return 0;
-        }
+        pos = this->_pos + index;
         
-        if( this->_pos >= this->_length )
+        if( static_cast< size_t >( pos ) >= static_cast< size_t >( this->_length ) )
         {
             return 0;
         }
         
-        return this->_bp[ this->_pos ];
+        return this->_bp[ pos ];
     }
     
     Data::Iterator::operator Data::Byte () const
@@ -211,6 +224,11 @@ namespace CF
         return operator*();
     }
     
+    Data::Iterator operator +( CFIndex value, const Data::Iterator & it )
+    {
+        return it + value;
+    }
+    
     void swap( Data::Iterator & v1, Data::Iterator & v2 ) noexcept
     {
         using std::swap;
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-Data-Matcher.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Multi-pattern matcher for CF::Data
+ */
+
+#include <CF++.hpp>
+#include <deque>
+
+namespace CF
+{
+    Data::Matcher::Matcher()
+    {
+        this->Build( nullptr, 0 );
+    }
+    
+    Data::Matcher::Matcher( const std::vector< Data > & patterns )
+    {
+        this->Build( patterns.data(), patterns.size() );
+    }
+    
+    Data::Matcher::Matcher( std::initializer_list< Data > patterns )
+    {
+        this->Build( patterns.begin(), patterns.size() );
+    }
+    
+    Data::Matcher::Matcher( const Matcher & value ):
+        _next( value._next ),
+        _dict( value._dict ),
+        _lengths( value._lengths ),
+        _patterns( value._patterns )
+    {}
+    
+    Data::Matcher::Matcher( Matcher && value ) noexcept:
+        _next( std::move( value._next ) ),
+        _dict( std::move( value._dict ) ),
+        _lengths( std::move( value._lengths ) ),
+        _patterns( std::move( value._patterns ) )
+    {}
+    
+    Data::Matcher::~Matcher()
+    {}
+    
+    Data::Matcher & Data::Matcher::operator =( Matcher value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    CFIndex Data::Matcher::GetPatternCount() const
+    {
+        return static_cast< CFIndex >( this->_lengths.size() );
+    }
+    
+    std::vector< Data::Matcher::Match > Data::Matcher::FindAll( const Data & data ) const
+    {
+        return this->FindAll( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    std::vector< Data::Matcher::Match > Data::Matcher::FindAll( const Byte * bytes, CFIndex length ) const
+    {
+        std::vector< Match > matches;
+        Match                match;
+        const int32_t      * next;
+        int32_t              s;
+        int32_t              t;
+        CFIndex              i;
+        
+        if( bytes == nullptr || this->_next.empty() )
+        {
+            return matches;
+        }
+        
+        next = this->_next.data();
+        s    = 0;
+        
+        for( i = 0; i < length; i++ )
+        {
+            s = next[ ( static_cast< size_t >( s ) << 8 ) | bytes[ i ] ];
+            t = ( this->_patterns[ static_cast< size_t >( s ) ].empty() ) ? this->_dict[ static_cast< size_t >( s ) ] : s;
+            
+            for( ; t != -1; t = this->_dict[ static_cast< size_t >( t ) ] )
+            {
+                for( CFIndex p: this->_patterns[ static_cast< size_t >( t ) ] )
+                {
+                    match.range.length   = this->_lengths[ static_cast< size_t >( p ) ];
+                    match.range.location = i + 1 - match.range.length;
+                    match.pattern        = p;
+                    
+                    matches.push_back( match );
+                }
+            }
+        }
+        
+        return matches;
+    }
+    
+    void Data::Matcher::Build( const Data * patterns, std::size_t count )
+    {
+        std::vector< int32_t > fail;
+        std::deque< int32_t >  queue;
+        std::size_t            i;
+        std::size_t            c;
+        CFIndex                j;
+        CFIndex                length;
+        const Byte           * bytes;
+        int32_t                s;
+        int32_t                u;
+        int32_t                v;
+        
+        this->_next.assign( 256, -1 );
+        this->_patterns.assign( 1, std::vector< CFIndex >() );
+        this->_lengths.clear();
+        
+        /* Trie */
+        for( i = 0; i < count; i++ )
+        {
+            length = patterns[ i ].GetLength();
+            bytes  = patterns[ i ].GetBytePtr();
+            s      = 0;
+            
+            this->_lengths.push_back( length );
+            
+            if( length == 0 )
+            {
+                continue;
+            }
+            
+            for( j = 0; j < length; j++ )
+            {
+                c = ( static_cast< size_t >( s ) << 8 ) | bytes[ j ];
+                
+                if( this->_next[ c ] == -1 )
+                {
+                    this->_next[ c ] = static_cast< int32_t >( this->_patterns.size() );
+                    
+                    this->_next.resize( this->_next.size() + 256, -1 );
+                    this->_patterns.push_back( std::vector< CFIndex >() );
+                }
+                
+                s = this->_next[ c ];
+            }
+            
+            this->_patterns[ static_cast< size_t >( s ) ].push_back( static_cast< CFIndex >( i ) );
+        }
+        
+        /* Failure links, folded into a full transition table, breadth-first */
+        fail.assign( this->_patterns.size(), 0 );
+        this->_dict.assign( this->_patterns.size(), -1 );
+        
+        for( c = 0; c < 256; c++ )
+        {
+            if( this->_next[ c ] == -1 )
+            {
+                this->_next[ c ] = 0;
+            }
+            else
+            {
+                queue.push_back( this->_next[ c ] );
+            }
+        }
+        
+        while( queue.empty() == false )
+        {
+            u = queue.front();
+            
+            queue.pop_front();
+            
+            for( c = 0; c < 256; c++ )
+            {
+                v = this->_next[ ( static_cast< size_t >( u ) << 8 ) | c ];
+                s = this->_next[ ( static_cast< size_t >( fail[ static_cast< size_t >( u ) ] ) << 8 ) | c ];
+                
+                if( v == -1 )
+                {
+                    this->_next[ ( static_cast< size_t >( u ) << 8 ) | c ] = s;
+                    
+                    continue;
+                }
+                
+                fail[ static_cast< size_t >( v ) ]        = s;
+                this->_dict[ static_cast< size_t >( v ) ] = ( this->_patterns[ static_cast< size_t >( s ) ].empty() ) ? this->_dict[ static_cast< size_t >( s ) ] : s;
+                
+                queue.push_back( v );
+            }
+        }
+    }
+    
+    void swap( Data::Matcher & v1, Data::Matcher & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._next,     v2._next );
+        swap( v1._dict,     v2._dict );
+        swap( v1._lengths,  v2._lengths );
+        swap( v1._patterns, v2._patterns );
+    }
+}
@@ -29,105 +29,1504 @@
  */
 
 #include <CF++.hpp>
+#include <cstring>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __SSE2__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define CFPP_DATA_SSE2
+#if defined( _MSC_VER )
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#endif
+
+#ifdef _WIN32
+
+#include <Windows.h>
+
+static bool           __hasCFAllocatorNull = false;
+static CFAllocatorRef __cfAllocatorNull    = nullptr;
+
+static void __loadCFAllocatorNull()
+{
+    HMODULE cfModule;
+
+    if( __hasCFAllocatorNull == true )
+    {
+        return;
+    }
+
+    cfModule = GetModuleHandle( L"CoreFoundation.dll" );
+
+    if( cfModule != nullptr )
+    {
+        __hasCFAllocatorNull = true;
+        __cfAllocatorNull    = *( ( CFAllocatorRef * )GetProcAddress( cfModule, "kCFAllocatorNull" ) );
+    }
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+#ifdef CFPP_ZLIB
+#include <zlib.h>
+#endif
+
+struct __Deallocator
+{
+    std::function< void( const CF::Data::Byte *, CFIndex ) > function;
+    CFIndex                                                  length;
+};
+
+static void   __DeallocatorRelease( const void * info );
+static void * __DeallocatorAllocate( CFIndex size, CFOptionFlags hint, void * info );
+static void   __DeallocatorDeallocate( void * ptr, void * info );
+
+static void __DeallocatorRelease( const void * info )
+{
+    delete static_cast< const __Deallocator * >( info );
+}
+
+static void * __DeallocatorAllocate( CFIndex size, CFOptionFlags hint, void * info )
+{
+    ( void )size;
+    ( void )hint;
+    ( void )info;
+    
+    return nullptr;
+}
+
+static void __DeallocatorDeallocate( void * ptr, void * info )
+{
+    __Deallocator * deallocator;
+    
+    deallocator = static_cast< __Deallocator * >( info );
+    
+    if( deallocator->function )
+    {
+        deallocator->function( static_cast< const CF::Data::Byte * >( ptr ), deallocator->length );
+    }
+}
+
+#ifdef CFPP_ZLIB
+
+/*
+ * zlib output goes to a buffer from the default allocator: growing it
+ * neither zero-fills nor necessarily copies, and it is trimmed to its
+ * length in place before being handed over to the data.
+ */
+static bool     __GrowBuffer( CF::Data::Byte * & buffer, CFIndex & capacity );
+static CF::Data __AdoptBuffer( CF::Data::Byte * buffer, CFIndex length );
+
+static bool __GrowBuffer( CF::Data::Byte * & buffer, CFIndex & capacity )
+{
+    CF::Data::Byte * p;
+    
+    p = static_cast< CF::Data::Byte * >( CFAllocatorReallocate( static_cast< CFAllocatorRef >( nullptr ), buffer, capacity * 2, 0 ) );
+    
+    if( p == nullptr )
+    {
+        return false;
+    }
+    
+    buffer    = p;
+    capacity *= 2;
+    
+    return true;
+}
+
+static CF::Data __AdoptBuffer( CF::Data::Byte * buffer, CFIndex length )
+{
+    CF::Data::Byte * p;
+    CF::Data         data;
+    
+    if( length == 0 )
+    {
+        CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), buffer );
+        
+        return CF::Data();
+    }
+    
+    p      = static_cast< CF::Data::Byte * >( CFAllocatorReallocate( static_cast< CFAllocatorRef >( nullptr ), buffer, length, 0 ) );
+    buffer = ( p == nullptr ) ? buffer : p;
+    data   = CF::Data::NoCopy( buffer, length, static_cast< CFAllocatorRef >( nullptr ) );
+    
+    if( data.IsValid() == false )
+    {
+        CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), buffer );
+    }
+    
+    return data;
+}
+
+#endif
+
+static CFIndex  __Search( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl );
+static CFIndex  __SearchScalar( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl );
+
+#ifdef CFPP_DATA_SSE2
+
+static unsigned __CountTrailingZeros( unsigned mask );
+static bool     __HasAVX2();
+static CFIndex  __SearchSSE2( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl );
+static CFIndex  __SearchAVX2( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl );
+
+static unsigned __CountTrailingZeros( unsigned mask )
+{
+    #ifdef _MSC_VER
+    
+    unsigned long i;
+    
+    _BitScanForward( &i, mask );
+    
+    return static_cast< unsigned >( i );
+    
+    #else
+    
+    return static_cast< unsigned >( __builtin_ctz( mask ) );
+    
+    #endif
+}
+
+static bool __HasAVX2()
+{
+    static const bool avx2 = []()
+    {
+        #ifdef _MSC_VER
+        
+        int r[ 4 ];
+        
+        __cpuid( r, 0 );
+        
+        if( r[ 0 ] < 7 )
+        {
+            return false;
+        }
+        
+        __cpuid( r, 1 );
+        
+        /* OSXSAVE, and YMM state enabled by the OS */
+        if( ( r[ 2 ] & ( 1 << 27 ) ) == 0 || ( _xgetbv( 0 ) & 6 ) != 6 )
+        {
+            return false;
+        }
+        
+        __cpuidex( r, 7, 0 );
+        
+        return ( r[ 1 ] & ( 1 << 5 ) ) != 0;
+        
+        #else
+        
+        unsigned int a;
+        unsigned int b;
+        unsigned int c;
+        unsigned int d;
+        
+        if( __get_cpuid_max( 0, nullptr ) < 7 )
+        {
+            return false;
+        }
+        
+        __cpuid( 1, a, b, c, d );
+        
+        /* OSXSAVE, and YMM state enabled by the OS */
+        if( ( c & ( 1u << 27 ) ) == 0 )
+        {
+            return false;
+        }
+        
+        __asm__( "xgetbv" : "=a"( a ), "=d"( d ) : "c"( 0 ) );
+        
+        if( ( a & 6 ) != 6 )
+        {
+            return false;
+        }
+        
+        __cpuid_count( 7, 0, a, b, c, d );
+        
+        return ( b & ( 1u << 5 ) ) != 0;
+        
+        #endif
+    }();
+    
+    return avx2;
+}
+
+/*
+ * First/last byte filter: compares a block of candidate positions against
+ * the first and last pattern bytes at once, and only runs memcmp on the
+ * positions where both match.
+ */
+static CFIndex __SearchSSE2( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl )
+{
+    __m128i  first;
+    __m128i  last;
+    __m128i  bf;
+    __m128i  bl;
+    unsigned mask;
+    unsigned bit;
+    CFIndex  i;
+    CFIndex  r;
+    
+    first = _mm_set1_epi8( static_cast< char >( n[ 0 ] ) );
+    last  = _mm_set1_epi8( static_cast< char >( n[ nl - 1 ] ) );
+    
+    for( i = 0; i + nl - 1 + 16 <= hl; i += 16 )
+    {
+        bf   = _mm_loadu_si128( reinterpret_cast< const __m128i * >( h + i ) );
+        bl   = _mm_loadu_si128( reinterpret_cast< const __m128i * >( h + i + nl - 1 ) );
+        mask = static_cast< unsigned >( _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8( first, bf ), _mm_cmpeq_epi8( last, bl ) ) ) );
+        
+        while( mask != 0 )
+        {
+            bit = __CountTrailingZeros( mask );
+            
+            if( memcmp( h + i + bit + 1, n + 1, static_cast< size_t >( nl - 2 ) ) == 0 )
+            {
+                return i + static_cast< CFIndex >( bit );
+            }
+            
+            mask &= mask - 1;
+        }
+    }
+    
+    r = __SearchScalar( h + i, hl - i, n, nl );
+    
+    return ( r == kCFNotFound ) ? static_cast< CFIndex >( kCFNotFound ) : i + r;
+}
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+__attribute__( ( target( "avx2" ) ) )
+#endif
+static CFIndex __SearchAVX2( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl )
+{
+    __m256i  first;
+    __m256i  last;
+    __m256i  bf;
+    __m256i  bl;
+    unsigned mask;
+    unsigned bit;
+    CFIndex  i;
+    CFIndex  r;
+    
+    first = _mm256_set1_epi8( static_cast< char >( n[ 0 ] ) );
+    last  = _mm256_set1_epi8( static_cast< char >( n[ nl - 1 ] ) );
+    
+    for( i = 0; i + nl - 1 + 32 <= hl; i += 32 )
+    {
+        bf   = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( h + i ) );
+        bl   = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( h + i + nl - 1 ) );
+        mask = static_cast< unsigned >( _mm256_movemask_epi8( _mm256_and_si256( _mm256_cmpeq_epi8( first, bf ), _mm256_cmpeq_epi8( last, bl ) ) ) );
+        
+        while( mask != 0 )
+        {
+            bit = __CountTrailingZeros( mask );
+            
+            if( memcmp( h + i + bit + 1, n + 1, static_cast< size_t >( nl - 2 ) ) == 0 )
+            {
+                return i + static_cast< CFIndex >( bit );
+            }
+            
+            mask &= mask - 1;
+        }
+    }
+    
+    r = __SearchSSE2( h + i, hl - i, n, nl );
+    
+    return ( r == kCFNotFound ) ? static_cast< CFIndex >( kCFNotFound ) : i + r;
+}
+
+#endif
+
+/* memchr on the first byte; libc versions of memchr are vectorized */
+static CFIndex __SearchScalar( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl )
+{
+    const CF::Data::Byte * p;
+    const CF::Data::Byte * end;
+    
+    if( nl > hl )
+    {
+        return kCFNotFound;
+    }
+    
+    p   = h;
+    end = h + ( hl - nl ) + 1;
+    
+    while( p < end )
+    {
+        p = static_cast< const CF::Data::Byte * >( memchr( p, n[ 0 ], static_cast< size_t >( end - p ) ) );
+        
+        if( p == nullptr )
+        {
+            return kCFNotFound;
+        }
+        
+        if( p[ nl - 1 ] == n[ nl - 1 ] && memcmp( p + 1, n + 1, static_cast< size_t >( nl - 1 ) ) == 0 )
+        {
+            return p - h;
+        }
+        
+        p++;
+    }
+    
+    return kCFNotFound;
+}
+
+static CFIndex __Search( const CF::Data::Byte * h, CFIndex hl, const CF::Data::Byte * n, CFIndex nl )
+{
+    const void * p;
+    
+    if( nl <= 0 || nl > hl )
+    {
+        return kCFNotFound;
+    }
+    
+    if( nl == 1 )
+    {
+        p = memchr( h, n[ 0 ], static_cast< size_t >( hl ) );
+        
+        return ( p == nullptr ) ? static_cast< CFIndex >( kCFNotFound ) : static_cast< const CF::Data::Byte * >( p ) - h;
+    }
+    
+    #ifdef CFPP_DATA_SSE2
+    
+    if( hl - nl >= 32 && __HasAVX2() )
+    {
+        return __SearchAVX2( h, hl, n, nl );
+    }
+    
+    return __SearchSSE2( h, hl, n, nl );
+    
+    #else
+    
+    return __SearchScalar( h, hl, n, nl );
+    
+    #endif
+}
+
+static const char __hexLower[]  = "0123456789abcdef";
+static const char __hexUpper[]  = "0123456789ABCDEF";
+static const char __base64[]    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static int     __HexValue( char c );
+static int     __Base64Value( char c );
+static void    __HexEncode( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase );
+static void    __HexEncodeScalar( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase );
+static bool    __HexDecode( const char * in, CFIndex length, CF::Data::Byte * out );
+static bool    __HexDecodeScalar( const char * in, CFIndex length, CF::Data::Byte * out );
+static void    __Base64Encode( const CF::Data::Byte * in, CFIndex length, char * out );
+static void    __Base64EncodeScalar( const CF::Data::Byte * in, CFIndex length, char * out );
+static CFIndex __Base64Decode( const char * in, CFIndex length, CF::Data::Byte * out );
+static CFIndex __Base64DecodeScalar( const char * in, CFIndex length, CF::Data::Byte * out );
+static CF::Data __DataFromHex( const char * value, CFIndex length );
+static CF::Data __DataFromBase64( const char * value, CFIndex length );
+
+#ifdef CFPP_DATA_SSE2
+
+static void    __HexEncodeSSE2( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase );
+static void    __HexEncodeAVX2( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase );
+static bool    __HexDecodeSSE2( const char * in, CFIndex length, CF::Data::Byte * out );
+static bool    __HexDecodeAVX2( const char * in, CFIndex length, CF::Data::Byte * out );
+static void    __Base64EncodeAVX2( const CF::Data::Byte * in, CFIndex length, char * out );
+static CFIndex __Base64DecodeAVX2( const char * in, CFIndex length, CF::Data::Byte * out );
+
+/* Nibbles to ASCII: '0' + n, plus the gap to 'a' (or 'A') when n > 9 */
+static void __HexEncodeSSE2( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase )
+{
+    __m128i mask;
+    __m128i nine;
+    __m128i zero;
+    __m128i alpha;
+    __m128i x;
+    __m128i hi;
+    __m128i lo;
+    CFIndex i;
+    
+    mask  = _mm_set1_epi8( 0x0F );
+    nine  = _mm_set1_epi8( 9 );
+    zero  = _mm_set1_epi8( '0' );
+    alpha = _mm_set1_epi8( ( uppercase ) ? 'A' - '0' - 10 : 'a' - '0' - 10 );
+    
+    for( i = 0; i + 16 <= length; i += 16 )
+    {
+        x  = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i ) );
+        hi = _mm_and_si128( _mm_srli_epi16( x, 4 ), mask );
+        lo = _mm_and_si128( x, mask );
+        hi = _mm_add_epi8( _mm_add_epi8( hi, zero ), _mm_and_si128( _mm_cmpgt_epi8( hi, nine ), alpha ) );
+        lo = _mm_add_epi8( _mm_add_epi8( lo, zero ), _mm_and_si128( _mm_cmpgt_epi8( lo, nine ), alpha ) );
+        
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i * 2 ),      _mm_unpacklo_epi8( hi, lo ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i * 2 + 16 ), _mm_unpackhi_epi8( hi, lo ) );
+    }
+    
+    __HexEncodeScalar( in + i, length - i, out + i * 2, uppercase );
+}
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+__attribute__( ( target( "avx2" ) ) )
+#endif
+static void __HexEncodeAVX2( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase )
+{
+    __m256i mask;
+    __m256i nine;
+    __m256i zero;
+    __m256i alpha;
+    __m256i x;
+    __m256i hi;
+    __m256i lo;
+    __m256i a;
+    __m256i b;
+    CFIndex i;
+    
+    mask  = _mm256_set1_epi8( 0x0F );
+    nine  = _mm256_set1_epi8( 9 );
+    zero  = _mm256_set1_epi8( '0' );
+    alpha = _mm256_set1_epi8( ( uppercase ) ? 'A' - '0' - 10 : 'a' - '0' - 10 );
+    
+    for( i = 0; i + 32 <= length; i += 32 )
+    {
+        x  = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( in + i ) );
+        hi = _mm256_and_si256( _mm256_srli_epi16( x, 4 ), mask );
+        lo = _mm256_and_si256( x, mask );
+        hi = _mm256_add_epi8( _mm256_add_epi8( hi, zero ), _mm256_and_si256( _mm256_cmpgt_epi8( hi, nine ), alpha ) );
+        lo = _mm256_add_epi8( _mm256_add_epi8( lo, zero ), _mm256_and_si256( _mm256_cmpgt_epi8( lo, nine ), alpha ) );
+        
+        /* Unpacking works per 128-bit lane, so the halves are swapped back in order */
+        a = _mm256_unpacklo_epi8( hi, lo );
+        b = _mm256_unpackhi_epi8( hi, lo );
+        
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i * 2 ),      _mm256_permute2x128_si256( a, b, 0x20 ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i * 2 + 32 ), _mm256_permute2x128_si256( a, b, 0x31 ) );
+    }
+    
+    __HexEncodeSSE2( in + i, length - i, out + i * 2, uppercase );
+}
+
+/*
+ * Validates and converts 32 digits at once, then merges each pair of
+ * nibbles in 16-bit lanes. Any invalid digit fails the whole decode.
+ */
+static bool __HexDecodeSSE2( const char * in, CFIndex length, CF::Data::Byte * out )
+{
+    __m128i c[ 2 ];
+    __m128i d;
+    __m128i l;
+    __m128i dv;
+    __m128i lv;
+    __m128i v[ 2 ];
+    __m128i none;
+    __m128i ten;
+    __m128i six;
+    int     j;
+    CFIndex i;
+    
+    none = _mm_set1_epi8( -1 );
+    ten  = _mm_set1_epi8( 10 );
+    six  = _mm_set1_epi8( 6 );
+    
+    for( i = 0; i + 32 <= length; i += 32 )
+    {
+        c[ 0 ] = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i ) );
+        c[ 1 ] = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i + 16 ) );
+        
+        for( j = 0; j < 2; j++ )
+        {
+            d  = _mm_sub_epi8( c[ j ], _mm_set1_epi8( '0' ) );
+            l  = _mm_sub_epi8( _mm_or_si128( c[ j ], _mm_set1_epi8( 0x20 ) ), _mm_set1_epi8( 'a' ) );
+            dv = _mm_and_si128( _mm_cmpgt_epi8( d, none ), _mm_cmpgt_epi8( ten, d ) );
+            lv = _mm_and_si128( _mm_cmpgt_epi8( l, none ), _mm_cmpgt_epi8( six, l ) );
+            
+            if( _mm_movemask_epi8( _mm_or_si128( dv, lv ) ) != 0xFFFF )
+            {
+                return false;
+            }
+            
+            v[ j ] = _mm_or_si128( _mm_and_si128( dv, d ), _mm_and_si128( lv, _mm_add_epi8( l, ten ) ) );
+            v[ j ] = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( v[ j ], _mm_set1_epi16( 0x00FF ) ), 4 ), _mm_srli_epi16( v[ j ], 8 ) );
+        }
+        
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i / 2 ), _mm_packus_epi16( v[ 0 ], v[ 1 ] ) );
+    }
+    
+    return __HexDecodeScalar( in + i, length - i, out + i / 2 );
+}
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+__attribute__( ( target( "avx2" ) ) )
+#endif
+static bool __HexDecodeAVX2( const char * in, CFIndex length, CF::Data::Byte * out )
+{
+    __m256i c[ 2 ];
+    __m256i d;
+    __m256i l;
+    __m256i dv;
+    __m256i lv;
+    __m256i v[ 2 ];
+    __m256i none;
+    __m256i ten;
+    __m256i six;
+    int     j;
+    CFIndex i;
+    
+    none = _mm256_set1_epi8( -1 );
+    ten  = _mm256_set1_epi8( 10 );
+    six  = _mm256_set1_epi8( 6 );
+    
+    for( i = 0; i + 64 <= length; i += 64 )
+    {
+        c[ 0 ] = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( in + i ) );
+        c[ 1 ] = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( in + i + 32 ) );
+        
+        for( j = 0; j < 2; j++ )
+        {
+            d  = _mm256_sub_epi8( c[ j ], _mm256_set1_epi8( '0' ) );
+            l  = _mm256_sub_epi8( _mm256_or_si256( c[ j ], _mm256_set1_epi8( 0x20 ) ), _mm256_set1_epi8( 'a' ) );
+            dv = _mm256_and_si256( _mm256_cmpgt_epi8( d, none ), _mm256_cmpgt_epi8( ten, d ) );
+            lv = _mm256_and_si256( _mm256_cmpgt_epi8( l, none ), _mm256_cmpgt_epi8( six, l ) );
+            
+            if( static_cast< unsigned >( _mm256_movemask_epi8( _mm256_or_si256( dv, lv ) ) ) != 0xFFFFFFFFu )
+            {
+                return false;
+            }
+            
+            v[ j ] = _mm256_or_si256( _mm256_and_si256( dv, d ), _mm256_and_si256( lv, _mm256_add_epi8( l, ten ) ) );
+            v[ j ] = _mm256_or_si256( _mm256_slli_epi16( _mm256_and_si256( v[ j ], _mm256_set1_epi16( 0x00FF ) ), 4 ), _mm256_srli_epi16( v[ j ], 8 ) );
+        }
+        
+        /* Packing works per 128-bit lane, so the quarters are put back in order */
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i / 2 ), _mm256_permute4x64_epi64( _mm256_packus_epi16( v[ 0 ], v[ 1 ] ), 0xD8 ) );
+    }
+    
+    return __HexDecodeSSE2( in + i, length - i, out + i / 2 );
+}
+
+/*
+ * Base64 kernels after W. Mula and D. Lemire, "Faster Base64 Encoding and
+ * Decoding Using AVX2 Instructions" (2018). Encoding reads 28 bytes for
+ * each 24 it converts; decoding writes 32 bytes for each 24 it produces.
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+__attribute__( ( target( "avx2" ) ) )
+#endif
+static void __Base64EncodeAVX2( const CF::Data::Byte * in, CFIndex length, char * out )
+{
+    __m256i x;
+    __m256i i0;
+    __m256i i1;
+    __m256i r;
+    __m256i shuffle;
+    __m256i shift;
+    CFIndex i;
+    CFIndex o;
+    
+    shuffle = _mm256_setr_epi8
+    (
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+    );
+    shift = _mm256_setr_epi8
+    (
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0
+    );
+    
+    for( i = 0, o = 0; i + 28 <= length; i += 24, o += 32 )
+    {
+        /* 12 bytes per lane, split into four 6-bit indices per 3 bytes */
+        x  = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i ) ) ), _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i + 12 ) ), 1 );
+        x  = _mm256_shuffle_epi8( x, shuffle );
+        i0 = _mm256_mulhi_epu16( _mm256_and_si256( x, _mm256_set1_epi32( 0x0FC0FC00 ) ), _mm256_set1_epi32( 0x04000040 ) );
+        i1 = _mm256_mullo_epi16( _mm256_and_si256( x, _mm256_set1_epi32( 0x003F03F0 ) ), _mm256_set1_epi32( 0x01000010 ) );
+        x  = _mm256_or_si256( i0, i1 );
+        
+        /* Index ranges to ASCII offsets */
+        r = _mm256_subs_epu8( x, _mm256_set1_epi8( 51 ) );
+        r = _mm256_or_si256( r, _mm256_and_si256( _mm256_cmpgt_epi8( _mm256_set1_epi8( 26 ), x ), _mm256_set1_epi8( 13 ) ) );
+        r = _mm256_add_epi8( _mm256_shuffle_epi8( shift, r ), x );
+        
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + o ), r );
+    }
+    
+    __Base64EncodeScalar( in + i, length - i, out + o );
+}
+
+/*
+ * Stops at the first block holding anything but alphabet characters
+ * (padding, whitespace or invalid input), and hands the rest over to
+ * the scalar decoder. Blocks are a multiple of 4 characters.
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+__attribute__( ( target( "avx2" ) ) )
+#endif
+static CFIndex __Base64DecodeAVX2( const char * in, CFIndex length, CF::Data::Byte * out )
+{
+    __m256i x;
+    __m256i hi;
+    __m256i lo;
+    __m256i lutLo;
+    __m256i lutHi;
+    __m256i lutRoll;
+    __m256i shuffle;
+    __m256i permute;
+    CFIndex i;
+    CFIndex o;
+    CFIndex r;
+    
+    lutLo = _mm256_setr_epi8
+    (
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+    );
+    lutHi = _mm256_setr_epi8
+    (
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+    );
+    lutRoll = _mm256_setr_epi8
+    (
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+    );
+    shuffle = _mm256_setr_epi8
+    (
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+    );
+    permute = _mm256_setr_epi32( 0, 1, 2, 4, 5, 6, 7, 7 );
+    
+    for( i = 0, o = 0; i + 32 <= length; i += 32, o += 24 )
+    {
+        x  = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( in + i ) );
+        hi = _mm256_and_si256( _mm256_srli_epi32( x, 4 ), _mm256_set1_epi8( 0x0F ) );
+        lo = _mm256_and_si256( x, _mm256_set1_epi8( 0x0F ) );
+        
+        if( _mm256_testz_si256( _mm256_shuffle_epi8( lutLo, lo ), _mm256_shuffle_epi8( lutHi, hi ) ) == 0 )
+        {
+            break;
+        }
+        
+        /* ASCII to 6-bit values, then 4 values to 3 bytes per 32-bit lane */
+        x = _mm256_add_epi8( x, _mm256_shuffle_epi8( lutRoll, _mm256_add_epi8( _mm256_cmpeq_epi8( x, _mm256_set1_epi8( '/' ) ), hi ) ) );
+        x = _mm256_maddubs_epi16( x, _mm256_set1_epi32( 0x01400140 ) );
+        x = _mm256_madd_epi16( x, _mm256_set1_epi32( 0x00011000 ) );
+        x = _mm256_permutevar8x32_epi32( _mm256_shuffle_epi8( x, shuffle ), permute );
+        
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + o ), x );
+    }
+    
+    if( ( r = __Base64DecodeScalar( in + i, length - i, out + o ) ) < 0 )
+    {
+        return -1;
+    }
+    
+    return o + r;
+}
+
+#endif
+
+static int __HexValue( char c )
+{
+    if( c >= '0' && c <= '9' )
+    {
+        return c - '0';
+    }
+    
+    if( c >= 'a' && c <= 'f' )
+    {
+        return c - 'a' + 10;
+    }
+    
+    if( c >= 'A' && c <= 'F' )
+    {
+        return c - 'A' + 10;
+    }
+    
+    return -1;
+}
+
+static int __Base64Value( char c )
+{
+    if( c >= 'A' && c <= 'Z' )
+    {
+        return c - 'A';
+    }
+    
+    if( c >= 'a' && c <= 'z' )
+    {
+        return c - 'a' + 26;
+    }
+    
+    if( c >= '0' && c <= '9' )
+    {
+        return c - '0' + 52;
+    }
+    
+    if( c == '+' )
+    {
+        return 62;
+    }
+    
+    if( c == '/' )
+    {
+        return 63;
+    }
+    
+    return -1;
+}
+
+static void __HexEncodeScalar( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase )
+{
+    const char * digits;
+    CFIndex      i;
+    
+    digits = ( uppercase ) ? __hexUpper : __hexLower;
+    
+    for( i = 0; i < length; i++ )
+    {
+        out[ i * 2 ]     = digits[ in[ i ] >> 4 ];
+        out[ i * 2 + 1 ] = digits[ in[ i ] & 0x0F ];
+    }
+}
+
+static bool __HexDecodeScalar( const char * in, CFIndex length, CF::Data::Byte * out )
+{
+    int     hi;
+    int     lo;
+    CFIndex i;
+    
+    for( i = 0; i + 1 < length; i += 2 )
+    {
+        hi = __HexValue( in[ i ] );
+        lo = __HexValue( in[ i + 1 ] );
+        
+        if( hi < 0 || lo < 0 )
+        {
+            return false;
+        }
+        
+        out[ i / 2 ] = static_cast< CF::Data::Byte >( ( hi << 4 ) | lo );
+    }
+    
+    return true;
+}
+
+static void __Base64EncodeScalar( const CF::Data::Byte * in, CFIndex length, char * out )
+{
+    UInt32  v;
+    CFIndex i;
+    
+    for( i = 0; i + 3 <= length; i += 3 )
+    {
+        v = ( static_cast< UInt32 >( in[ i ] ) << 16 ) | ( static_cast< UInt32 >( in[ i + 1 ] ) << 8 ) | in[ i + 2 ];
+        
+        *( out++ ) = __base64[ ( v >> 18 ) & 0x3F ];
+        *( out++ ) = __base64[ ( v >> 12 ) & 0x3F ];
+        *( out++ ) = __base64[ ( v >>  6 ) & 0x3F ];
+        *( out++ ) = __base64[ v & 0x3F ];
+    }
+    
+    if( length - i == 1 )
+    {
+        v = static_cast< UInt32 >( in[ i ] ) << 16;
+        
+        *( out++ ) = __base64[ ( v >> 18 ) & 0x3F ];
+        *( out++ ) = __base64[ ( v >> 12 ) & 0x3F ];
+        *( out++ ) = '=';
+        *( out++ ) = '=';
+    }
+    else if( length - i == 2 )
+    {
+        v = ( static_cast< UInt32 >( in[ i ] ) << 16 ) | ( static_cast< UInt32 >( in[ i + 1 ] ) << 8 );
+        
+        *( out++ ) = __base64[ ( v >> 18 ) & 0x3F ];
+        *( out++ ) = __base64[ ( v >> 12 ) & 0x3F ];
+        *( out++ ) = __base64[ ( v >>  6 ) & 0x3F ];
+        *( out++ ) = '=';
+    }
+}
+
+/*
+ * Skips whitespace, and accepts missing padding. Nothing but padding and
+ * whitespace may follow the first '='. Returns the number of decoded
+ * bytes, or -1 for invalid input.
+ */
+static CFIndex __Base64DecodeScalar( const char * in, CFIndex length, CF::Data::Byte * out )
+{
+    UInt32  v;
+    int     n;
+    int     c;
+    CFIndex pad;
+    CFIndex i;
+    CFIndex o;
+    
+    v   = 0;
+    n   = 0;
+    pad = 0;
+    o   = 0;
+    
+    for( i = 0; i < length; i++ )
+    {
+        if( in[ i ] == ' ' || in[ i ] == '\t' || in[ i ] == '\r' || in[ i ] == '\n' )
+        {
+            continue;
+        }
+        
+        if( in[ i ] == '=' )
+        {
+            pad++;
+            
+            continue;
+        }
+        
+        if( pad > 0 || ( c = __Base64Value( in[ i ] ) ) < 0 )
+        {
+            return -1;
+        }
+        
+        v = ( v << 6 ) | static_cast< UInt32 >( c );
+        
+        if( ++n == 4 )
+        {
+            out[ o++ ] = static_cast< CF::Data::Byte >( v >> 16 );
+            out[ o++ ] = static_cast< CF::Data::Byte >( v >> 8 );
+            out[ o++ ] = static_cast< CF::Data::Byte >( v );
+            v          = 0;
+            n          = 0;
+        }
+    }
+    
+    if( n == 1 || ( pad > 0 && ( n == 0 || pad != 4 - n ) ) )
+    {
+        return -1;
+    }
+    
+    if( n == 2 )
+    {
+        out[ o++ ] = static_cast< CF::Data::Byte >( v >> 4 );
+    }
+    else if( n == 3 )
+    {
+        out[ o++ ] = static_cast< CF::Data::Byte >( v >> 10 );
+        out[ o++ ] = static_cast< CF::Data::Byte >( v >> 2 );
+    }
+    
+    return o;
+}
+
+static void __HexEncode( const CF::Data::Byte * in, CFIndex length, char * out, bool uppercase )
+{
+    #ifdef CFPP_DATA_SSE2
+    
+    if( length >= 32 && __HasAVX2() )
+    {
+        __HexEncodeAVX2( in, length, out, uppercase );
+    }
+    else
+    {
+        __HexEncodeSSE2( in, length, out, uppercase );
+    }
+    
+    #else
+    
+    __HexEncodeScalar( in, length, out, uppercase );
+    
+    #endif
+}
+
+static bool __HexDecode( const char * in, CFIndex length, CF::Data::Byte * out )
+{
+    #ifdef CFPP_DATA_SSE2
+    
+    if( length >= 64 && __HasAVX2() )
+    {
+        return __HexDecodeAVX2( in, length, out );
+    }
+    
+    return __HexDecodeSSE2( in, length, out );
+    
+    #else
+    
+    return __HexDecodeScalar( in, length, out );
+    
+    #endif
+}
+
+static void __Base64Encode( const CF::Data::Byte * in, CFIndex length, char * out )
+{
+    #ifdef CFPP_DATA_SSE2
+    
+    if( length >= 28 && __HasAVX2() )
+    {
+        __Base64EncodeAVX2( in, length, out );
+        
+        return;
+    }
+    
+    #endif
+    
+    __Base64EncodeScalar( in, length, out );
+}
+
+static CFIndex __Base64Decode( const char * in, CFIndex length, CF::Data::Byte * out )
+{
+    #ifdef CFPP_DATA_SSE2
+    
+    if( length >= 32 && __HasAVX2() )
+    {
+        return __Base64DecodeAVX2( in, length, out );
+    }
+    
+    #endif
+    
+    return __Base64DecodeScalar( in, length, out );
+}
+
+static CF::Data __DataFromHex( const char * value, CFIndex length )
+{
+    CF::Data data;
+    
+    if( value == nullptr || length % 2 != 0 )
+    {
+        return nullptr;
+    }
+    
+    data.SetLength( length / 2 );
+    
+    if( __HexDecode( value, length, data.GetMutableBytePtr() ) == false )
+    {
+        return nullptr;
+    }
+    
+    return data;
+}
+
+static CF::Data __DataFromBase64( const char * value, CFIndex length )
+{
+    CF::Data data;
+    CFIndex  n;
+    
+    if( value == nullptr )
+    {
+        return nullptr;
+    }
+    
+    /* Slack for the 32-byte stores of the vectorized decoder */
+    data.SetLength( ( length / 4 ) * 3 + 3 + 8 );
+    
+    if( ( n = __Base64Decode( value, length, data.GetMutableBytePtr() ) ) < 0 )
+    {
+        return nullptr;
+    }
+    
+    data.SetLength( n );
+    
+    return data;
+}
 
 namespace CF
 {
-    Data::Data(): _cfObject( nullptr )
+    Data::Data(): _cfObject( nullptr ), _mutable( true )
     {
         this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
     }
     
-    Data::Data( CFIndex capacity ): _cfObject( nullptr )
-    {
-        this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), capacity );
-    }
+    Data::Data( CFIndex capacity ): _cfObject( nullptr ), _mutable( true )
+    {
+        this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), capacity );
+    }
+    
+    Data::Data( const Data & value ): _cfObject( value._cfObject ), _mutable( value._mutable )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    Data::Data( const AutoPointer & value ): _cfObject( nullptr ), _mutable( false )
+    {
+        if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
+        {
+            this->_cfObject = static_cast< CFDataRef >( CFRetain( value ) );
+        }
+    }
+    
+    Data::Data( CFTypeRef value ): _cfObject( nullptr ), _mutable( false )
+    {
+        if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
+        {
+            this->_cfObject = static_cast< CFDataRef >( CFRetain( value ) );
+        }
+    }
+    
+    Data::Data( CFDataRef value ): _cfObject( nullptr ), _mutable( false )
+    {
+        if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
+        {
+            this->_cfObject = static_cast< CFDataRef >( CFRetain( value ) );
+        }
+    }
+    
+    Data::Data( CFStringRef value ): _cfObject( nullptr ), _mutable( true )
+    {
+        CFMutableDataRef data;
+        
+        if( value != nullptr && CFGetTypeID( value ) == CFStringGetTypeID() )
+        {
+            data = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+            
+            CFDataAppendBytes( data, reinterpret_cast< const UInt8 * >( CFStringGetCStringPtr( value, kCFStringEncodingUTF8 ) ), CFStringGetLength( value ) );
+            
+            this->_cfObject = data;
+        }
+    }
+    
+    Data::Data( std::nullptr_t ): Data( static_cast< CFTypeRef >( nullptr ) )
+    {}
+    
+    Data::Data( const std::string & value ): _cfObject( nullptr ), _mutable( true )
+    {
+        CFMutableDataRef data;
+        
+        data = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+        
+        CFDataAppendBytes( data, reinterpret_cast< const UInt8 * >( value.c_str() ), static_cast< CFIndex >( value.length() ) );
+        
+        this->_cfObject = data;
+    }
+    
+    Data::Data( const Byte * value, CFIndex length ): _cfObject( nullptr ), _mutable( true )
+    {
+        CFMutableDataRef data;
+        
+        if( value != nullptr )
+        {
+            data = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+            
+            CFDataAppendBytes( data, value, length );
+            
+            this->_cfObject = data;
+        }
+    }
+    
+    Data::Data( std::initializer_list< Byte > value ): Data( static_cast< CFIndex >( value.size() ) )
+    {
+        for( Byte b: value )
+        {
+            this->AppendBytes( &b, 1 );
+        }
+    }
+    
+    Data::Data( Data && value ) noexcept
+    {
+        this->_cfObject = value._cfObject;
+        value._cfObject = nullptr;
+        this->_mutable  = value._mutable;
+        value._mutable  = false;
+    }
+    
+    Data::~Data()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+            
+            this->_cfObject = nullptr;
+        }
+    }
+    
+    Data Data::Share( CFDataRef value )
+    {
+        return Data( value );
+    }
+    
+    Data Data::Adopt( CFDataRef value )
+    {
+        Data data( static_cast< CFDataRef >( nullptr ) );
+        
+        if( value == nullptr )
+        {
+            return data;
+        }
+        
+        if( CFGetTypeID( value ) != CFDataGetTypeID() )
+        {
+            CFRelease( value );
+            
+            return data;
+        }
+        
+        data._cfObject = value;
+        
+        return data;
+    }
+    
+    Data Data::NoCopy( const Byte * bytes, CFIndex length )
+    {
+        #ifdef _WIN32
+        
+        __loadCFAllocatorNull();
+        
+        return Data::NoCopy( bytes, length, __cfAllocatorNull );
+        
+        #else
+        
+        return Data::NoCopy( bytes, length, kCFAllocatorNull );
+        
+        #endif
+    }
+    
+    Data Data::NoCopy( const Byte * bytes, CFIndex length, CFAllocatorRef deallocator )
+    {
+        CFDataRef data;
+        
+        if( bytes == nullptr )
+        {
+            return Data();
+        }
+        
+        data = CFDataCreateWithBytesNoCopy( static_cast< CFAllocatorRef >( nullptr ), bytes, length, deallocator );
+        
+        return Data::Adopt( data );
+    }
+    
+    Data Data::NoCopy( const Byte * bytes, CFIndex length, std::function< void( const Byte *, CFIndex ) > deallocator )
+    {
+        CFAllocatorContext context;
+        CFAllocatorRef     allocator;
+        CFDataRef          data;
+        __Deallocator    * info;
+        
+        if( bytes == nullptr )
+        {
+            return Data();
+        }
+        
+        info                    = new __Deallocator();
+        info->function          = std::move( deallocator );
+        info->length            = length;
+        context.version         = 0;
+        context.info            = info;
+        context.retain          = nullptr;
+        context.release         = __DeallocatorRelease;
+        context.copyDescription = nullptr;
+        context.allocate        = __DeallocatorAllocate;
+        context.reallocate      = nullptr;
+        context.deallocate      = __DeallocatorDeallocate;
+        context.preferredSize   = nullptr;
+        
+        /* The allocator owns info, and the data owns the allocator */
+        allocator = CFAllocatorCreate( static_cast< CFAllocatorRef >( nullptr ), &context );
+        
+        if( allocator == nullptr )
+        {
+            if( info->function )
+            {
+                info->function( bytes, length );
+            }
+            
+            delete info;
+            
+            return Data();
+        }
+        
+        data = CFDataCreateWithBytesNoCopy( static_cast< CFAllocatorRef >( nullptr ), bytes, length, allocator );
+        
+        if( data == nullptr )
+        {
+            CFAllocatorDeallocate( allocator, const_cast< Byte * >( bytes ) );
+        }
+        
+        CFRelease( allocator );
+        
+        return Data::Adopt( data );
+    }
+    
+    Data Data::NoCopy( std::vector< Byte > && value )
+    {
+        const Byte * bytes;
+        CFIndex      length;
+        
+        if( value.empty() )
+        {
+            return Data();
+        }
+        
+        /* Moving a vector keeps its buffer, so bytes stays valid */
+        bytes  = value.data();
+        length = static_cast< CFIndex >( value.size() );
+        
+        return Data::NoCopy
+        (
+            bytes,
+            length,
+            [ v = std::move( value ) ]( const Byte *, CFIndex ) mutable
+            {
+                std::vector< Byte >().swap( v );
+            }
+        );
+    }
+    
+    #ifdef _WIN32
+    
+    Data Data::MapFile( const std::string & path, Access access )
+    {
+        std::wstring  wpath;
+        int           n;
+        HANDLE        file;
+        HANDLE        mapping;
+        LARGE_INTEGER size;
+        DWORD         flags;
+        const void  * p;
+        
+        if( path.length() == 0 )
+        {
+            return nullptr;
+        }
+        
+        n = MultiByteToWideChar( CP_UTF8, 0, path.c_str(), static_cast< int >( path.length() ), nullptr, 0 );
+        
+        if( n <= 0 )
+        {
+            return nullptr;
+        }
+        
+        wpath.resize( static_cast< std::size_t >( n ) );
+        MultiByteToWideChar( CP_UTF8, 0, path.c_str(), static_cast< int >( path.length() ), &( wpath[ 0 ] ), n );
+        
+        flags = FILE_ATTRIBUTE_NORMAL;
+        
+        if( access == AccessSequential )
+        {
+            flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+        }
+        else if( access == AccessRandom )
+        {
+            flags |= FILE_FLAG_RANDOM_ACCESS;
+        }
+        
+        file = CreateFileW( wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr );
+        
+        if( file == INVALID_HANDLE_VALUE )
+        {
+            return nullptr;
+        }
+        
+        if( GetFileSizeEx( file, &size ) == FALSE )
+        {
+            CloseHandle( file );
+            
+            return nullptr;
+        }
+        
+        if( size.QuadPart == 0 )
+        {
+            CloseHandle( file );
+            
+            return Data();
+        }
+        
+        mapping = CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        
+        CloseHandle( file );
+        
+        if( mapping == nullptr )
+        {
+            return nullptr;
+        }
+        
+        /* The view keeps the mapping alive */
+        p = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+        
+        CloseHandle( mapping );
+        
+        if( p == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return Data::NoCopy
+        (
+            static_cast< const Byte * >( p ),
+            static_cast< CFIndex >( size.QuadPart ),
+            []( const Byte * bytes, CFIndex )
+            {
+                UnmapViewOfFile( bytes );
+            }
+        );
+    }
+    
+    #else
     
-    Data::Data( const Data & value ): _cfObject( nullptr )
+    Data Data::MapFile( const std::string & path, Access access )
     {
-        if( value._cfObject != nullptr )
+        int         fd;
+        struct stat st;
+        void      * p;
+        std::size_t length;
+        
+        if( path.length() == 0 )
         {
-            this->_cfObject = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, value._cfObject );
+            return nullptr;
         }
-    }
-    
-    Data::Data( const AutoPointer & value ): _cfObject( nullptr )
-    {
-        if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
+        
+        fd = open( path.c_str(), O_RDONLY | O_CLOEXEC );
+        
+        if( fd < 0 )
+        {
+            return nullptr;
+        }
+        
+        if( fstat( fd, &st ) != 0 || S_ISREG( st.st_mode ) == false )
+        {
+            close( fd );
+            
+            return nullptr;
+        }
+        
+        if( st.st_size == 0 )
+        {
+            close( fd );
+            
+            return Data();
+        }
+        
+        length = static_cast< std::size_t >( st.st_size );
+        p      = mmap( nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+        
+        close( fd );
+        
+        if( p == MAP_FAILED )
+        {
+            return nullptr;
+        }
+        
+        if( access == AccessSequential )
         {
-            this->_cfObject = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, static_cast< CFDataRef >( value ) );
+            madvise( p, length, MADV_SEQUENTIAL );
         }
+        else if( access == AccessRandom )
+        {
+            madvise( p, length, MADV_RANDOM );
+        }
+        
+        return Data::NoCopy
+        (
+            static_cast< const Byte * >( p ),
+            static_cast< CFIndex >( length ),
+            []( const Byte * bytes, CFIndex n )
+            {
+                munmap( const_cast< Byte * >( bytes ), static_cast< std::size_t >( n ) );
+            }
+        );
     }
     
-    Data::Data( CFTypeRef value ): _cfObject( nullptr )
+    #endif
+    
+    Data Data::MapFile( const char * path, Access access )
     {
-        if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
+        if( path == nullptr )
         {
-            this->_cfObject = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, static_cast< CFDataRef >( value ) );
+            return nullptr;
         }
+        
+        return Data::MapFile( std::string( path ), access );
     }
     
-    Data::Data( CFDataRef value ): _cfObject( nullptr )
+    Data Data::MapFile( const URL & url, Access access )
     {
-        if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
+        char path[ 4096 ];
+        
+        if( url.IsValid() == false )
+        {
+            return nullptr;
+        }
+        
+        if( CFURLGetFileSystemRepresentation( static_cast< CFURLRef >( url.GetCFObject() ), true, reinterpret_cast< UInt8 * >( path ), sizeof( path ) ) == false )
         {
-            this->_cfObject = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, static_cast< CFDataRef >( value ) );
+            return nullptr;
         }
+        
+        return Data::MapFile( std::string( path ), access );
     }
     
-    Data::Data( CFStringRef value ): _cfObject( nullptr )
+    Data Data::FromHex( const String & value )
     {
-        if( value != nullptr && CFGetTypeID( value ) == CFStringGetTypeID() )
+        std::string s;
+        const char * cp;
+        
+        if( value.IsValid() == false )
         {
-            this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
-            
-            CFDataAppendBytes( this->_cfObject, reinterpret_cast< const UInt8 * >( CFStringGetCStringPtr( value, kCFStringEncodingUTF8 ) ), CFStringGetLength( value ) );
+            return nullptr;
         }
+        
+        if( ( cp = CFStringGetCStringPtr( static_cast< CFStringRef >( value.GetCFObject() ), kCFStringEncodingUTF8 ) ) != nullptr )
+        {
+            return __DataFromHex( cp, static_cast< CFIndex >( strlen( cp ) ) );
+        }
+        
+        s = value.GetValue();
+        
+        return __DataFromHex( s.data(), static_cast< CFIndex >( s.length() ) );
     }
     
-    Data::Data( std::nullptr_t ): Data( static_cast< CFTypeRef >( nullptr ) )
-    {}
-    
-    Data::Data( const std::string & value ): _cfObject( nullptr )
+    Data Data::FromHex( const std::string & value )
     {
-        this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
-        
-        CFDataAppendBytes( this->_cfObject, reinterpret_cast< const UInt8 * >( value.c_str() ), static_cast< CFIndex >( value.length() ) );
+        return __DataFromHex( value.data(), static_cast< CFIndex >( value.length() ) );
     }
     
-    Data::Data( const Byte * value, CFIndex length ): _cfObject( nullptr )
+    Data Data::FromHex( const char * value )
     {
-        if( value != nullptr )
+        if( value == nullptr )
         {
-            this->_cfObject = CFDataCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
-            
-            CFDataAppendBytes( this->_cfObject, value, length );
+            return nullptr;
         }
+        
+        return __DataFromHex( value, static_cast< CFIndex >( strlen( value ) ) );
     }
     
-    Data::Data( std::initializer_list< Byte > value ): Data( static_cast< CFIndex >( value.size() ) )
+    Data Data::FromBase64( const String & value )
     {
-        for( Byte b: value )
+        std::string s;
+        const char * cp;
+        
+        if( value.IsValid() == false )
+        {
+            return nullptr;
+        }
+        
+        if( ( cp = CFStringGetCStringPtr( static_cast< CFStringRef >( value.GetCFObject() ), kCFStringEncodingUTF8 ) ) != nullptr )
         {
-            CFDataAppendBytes( this->_cfObject, &b, 1 );
+            return __DataFromBase64( cp, static_cast< CFIndex >( strlen( cp ) ) );
         }
+        
+        s = value.GetValue();
+        
+        return __DataFromBase64( s.data(), static_cast< CFIndex >( s.length() ) );
     }
     
-    Data::Data( Data && value ) noexcept
+    Data Data::FromBase64( const std::string & value )
     {
-        this->_cfObject = value._cfObject;
-        value._cfObject = nullptr;
+        return __DataFromBase64( value.data(), static_cast< CFIndex >( value.length() ) );
     }
     
-    Data::~Data()
+    Data Data::FromBase64( const char * value )
     {
-        if( this->_cfObject != nullptr )
+        if( value == nullptr )
         {
-            CFRelease( this->_cfObject );
-            
-            this->_cfObject = nullptr;
+            return nullptr;
         }
+        
+        return __DataFromBase64( value, static_cast< CFIndex >( strlen( value ) ) );
     }
-          
+    
     Data & Data::operator =( Data value )
     {
         swap( *( this ), value );
@@ -189,6 +1588,11 @@ namespace CF
         return s;
     }
     
+    Data::operator CFMutableDataRef () const
+    {
+        return this->GetMutableCFObject();
+    }
+    
     Byte Data::operator [] ( int index ) const
     {
         const Byte * bytes;
@@ -205,19 +1609,16 @@ namespace CF
             
     Data & Data::operator += ( Byte value )
     {
-        if( this->_cfObject != nullptr )
-        {
-            CFDataAppendBytes( this->_cfObject, &value, 1 );
-        }
+        this->AppendBytes( &value, 1 );
         
         return *( this );
     }
     
     Data & Data::operator += ( CFStringRef value )
     {
-        if( this->_cfObject != nullptr && value != nullptr && CFGetTypeID( value ) == CFStringGetTypeID() )
+        if( value != nullptr && CFGetTypeID( value ) == CFStringGetTypeID() )
         {
-            CFDataAppendBytes( this->_cfObject, reinterpret_cast< const UInt8 * >( CFStringGetCStringPtr( value, kCFStringEncodingUTF8 ) ), CFStringGetLength( value ) );
+            this->AppendBytes( reinterpret_cast< const UInt8 * >( CFStringGetCStringPtr( value, kCFStringEncodingUTF8 ) ), CFStringGetLength( value ) );
         }
         
         return *( this );
@@ -225,9 +1626,12 @@ namespace CF
     
     Data & Data::operator += ( CFDataRef value )
     {
-        if( this->_cfObject != nullptr && value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
+        if( value != nullptr && CFGetTypeID( value ) == this->GetTypeID() )
         {
-            CFDataAppendBytes( this->_cfObject, CFDataGetBytePtr( value ), CFDataGetLength( value ) );
+            /* Keeps the bytes alive if value is our own storage and gets detached */
+            CFRetain( value );
+            this->AppendBytes( CFDataGetBytePtr( value ), CFDataGetLength( value ) );
+            CFRelease( value );
         }
         
         return *( this );
@@ -240,10 +1644,7 @@ namespace CF
     
     Data & Data::operator += ( const std::string & value )
     {
-        if( this->_cfObject != nullptr )
-        {
-            CFDataAppendBytes( this->_cfObject, reinterpret_cast< const UInt8 * >( value.c_str() ), static_cast< CFIndex >( value.length() ) );
-        }
+        this->AppendBytes( reinterpret_cast< const UInt8 * >( value.c_str() ), static_cast< CFIndex >( value.length() ) );
         
         return *( this );
     }
@@ -270,22 +1671,26 @@ namespace CF
     
     void Data::SetLength( CFIndex length )
     {
-        if( this->_cfObject == nullptr )
+        CFMutableDataRef data;
+        
+        if( ( data = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFDataSetLength( this->_cfObject, length );
+        CFDataSetLength( data, length );
     }
     
     void Data::IncreaseLength( CFIndex extraLength )
     {
-        if( this->_cfObject == nullptr )
+        CFMutableDataRef data;
+        
+        if( ( data = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFDataIncreaseLength( this->_cfObject, extraLength );
+        CFDataIncreaseLength( data, extraLength );
     }
     
     const Byte * Data::GetBytePtr() const
@@ -300,12 +1705,14 @@ namespace CF
     
     Byte * Data::GetMutableBytePtr() const
     {
-        if( this->_cfObject == nullptr )
+        CFMutableDataRef data;
+        
+        if( ( data = this->GetMutableCFObject() ) == nullptr )
         {
             return nullptr;
         }
         
-        return CFDataGetMutableBytePtr( this->_cfObject );
+        return CFDataGetMutableBytePtr( data );
     }
     
     void Data::GetBytes( CFRange range, Byte * bytes ) const
@@ -320,32 +1727,38 @@ namespace CF
     
     void Data::AppendBytes( const Byte * bytes, CFIndex length )
     {
-        if( this->_cfObject == nullptr || bytes == nullptr )
+        CFMutableDataRef data;
+        
+        if( bytes == nullptr || ( data = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFDataAppendBytes( this->_cfObject, bytes, length );
+        CFDataAppendBytes( data, bytes, length );
     }
     
     void Data::ReplaceBytes( CFRange range, const Byte * newBytes, CFIndex newLength )
     {
-        if( this->_cfObject == nullptr || newBytes == nullptr )
+        CFMutableDataRef data;
+        
+        if( newBytes == nullptr || ( data = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFDataReplaceBytes( this->_cfObject, range, newBytes, newLength );
+        CFDataReplaceBytes( data, range, newBytes, newLength );
     }
     
     void Data::DeleteBytes( CFRange range )
     {
-        if( this->_cfObject == nullptr )
+        CFMutableDataRef data;
+        
+        if( ( data = this->GetMutableCFObject() ) == nullptr )
         {
             return;
         }
         
-        CFDataDeleteBytes( this->_cfObject, range );
+        CFDataDeleteBytes( data, range );
     }
     
     CFRange Data::Find( const Data & data, CFRange range, CFDataSearchFlags flags ) const
@@ -360,7 +1773,309 @@ namespace CF
             return r;
         }
         
-        return CFDataFind( this->_cfObject, data, range, flags );
+        if( flags != 0 || data.GetLength() == 0 || range.location < 0 || range.length < 0 || range.location + range.length > this->GetLength() )
+        {
+            return CFDataFind( this->_cfObject, data, range, flags );
+        }
+        
+        r.location = __Search( this->GetBytePtr() + range.location, range.length, data.GetBytePtr(), data.GetLength() );
+        
+        if( r.location != kCFNotFound )
+        {
+            r.location += range.location;
+            r.length    = data.GetLength();
+        }
+        
+        return r;
+    }
+    
+    CFRange Data::Find( const Data & data, CFIndex from ) const
+    {
+        return this->Find( data.GetBytePtr(), data.GetLength(), from );
+    }
+    
+    CFRange Data::Find( const Byte * bytes, CFIndex length, CFIndex from ) const
+    {
+        CFRange r;
+        
+        r.location = kCFNotFound;
+        r.length   = 0;
+        
+        if( this->_cfObject == nullptr || bytes == nullptr || from < 0 || from >= this->GetLength() )
+        {
+            return r;
+        }
+        
+        r.location = __Search( this->GetBytePtr() + from, this->GetLength() - from, bytes, length );
+        
+        if( r.location != kCFNotFound )
+        {
+            r.location += from;
+            r.length    = length;
+        }
+        
+        return r;
+    }
+    
+    std::vector< CFIndex > Data::FindAll( const Data & data, bool overlapping ) const
+    {
+        return this->FindAll( data.GetBytePtr(), data.GetLength(), overlapping );
+    }
+    
+    std::vector< CFIndex > Data::FindAll( const Byte * bytes, CFIndex length, bool overlapping ) const
+    {
+        std::vector< CFIndex > offsets;
+        const Byte           * h;
+        CFIndex                hl;
+        CFIndex                pos;
+        CFIndex                i;
+        
+        if( this->_cfObject == nullptr || bytes == nullptr || length <= 0 )
+        {
+            return offsets;
+        }
+        
+        h   = this->GetBytePtr();
+        hl  = this->GetLength();
+        pos = 0;
+        
+        while( pos < hl )
+        {
+            if( ( i = __Search( h + pos, hl - pos, bytes, length ) ) == kCFNotFound )
+            {
+                break;
+            }
+            
+            offsets.push_back( pos + i );
+            
+            pos += i + ( ( overlapping ) ? 1 : length );
+        }
+        
+        return offsets;
+    }
+    
+    String Data::ToHex( bool uppercase ) const
+    {
+        CFIndex length;
+        char  * buffer;
+        
+        if( ( length = this->GetLength() ) == 0 )
+        {
+            return "";
+        }
+        
+        buffer = static_cast< char * >( CFAllocatorAllocate( static_cast< CFAllocatorRef >( nullptr ), length * 2, 0 ) );
+        
+        if( buffer == nullptr )
+        {
+            return nullptr;
+        }
+        
+        __HexEncode( this->GetBytePtr(), length, buffer, uppercase );
+        
+        return String::NoCopy( std::string_view( buffer, static_cast< std::size_t >( length * 2 ) ), static_cast< CFAllocatorRef >( nullptr ), kCFStringEncodingASCII );
+    }
+    
+    String Data::ToBase64() const
+    {
+        CFIndex length;
+        CFIndex size;
+        char  * buffer;
+        
+        if( ( length = this->GetLength() ) == 0 )
+        {
+            return "";
+        }
+        
+        size   = ( ( length + 2 ) / 3 ) * 4;
+        buffer = static_cast< char * >( CFAllocatorAllocate( static_cast< CFAllocatorRef >( nullptr ), size, 0 ) );
+        
+        if( buffer == nullptr )
+        {
+            return nullptr;
+        }
+        
+        __Base64Encode( this->GetBytePtr(), length, buffer );
+        
+        return String::NoCopy( std::string_view( buffer, static_cast< std::size_t >( size ) ), static_cast< CFAllocatorRef >( nullptr ), kCFStringEncodingASCII );
+    }
+    
+    Data Data::Compress( Compression format, int level ) const
+    {
+        #ifdef CFPP_ZLIB
+        
+        z_stream     z;
+        Byte       * out;
+        const Byte * in;
+        CFIndex      left;
+        CFIndex      capacity;
+        CFIndex      used;
+        int          r;
+        
+        if( this->IsValid() == false )
+        {
+            return nullptr;
+        }
+        
+        memset( &z, 0, sizeof( z_stream ) );
+        
+        r = deflateInit2( &z, level, Z_DEFLATED, ( format == CompressionDeflate ) ? -MAX_WBITS : ( ( format == CompressionGzip ) ? MAX_WBITS + 16 : MAX_WBITS ), 8, Z_DEFAULT_STRATEGY );
+        
+        if( r != Z_OK )
+        {
+            return nullptr;
+        }
+        
+        in       = this->GetBytePtr();
+        left     = this->GetLength();
+        used     = 0;
+        capacity = std::max< CFIndex >( 4096, left / 2 );
+        out      = static_cast< Byte * >( CFAllocatorAllocate( static_cast< CFAllocatorRef >( nullptr ), capacity, 0 ) );
+        r        = ( out == nullptr ) ? Z_MEM_ERROR : Z_OK;
+        
+        while( r == Z_OK )
+        {
+            /* avail_in and avail_out are 32 bits, feed large data in chunks */
+            if( z.avail_in == 0 && left > 0 )
+            {
+                z.next_in  = const_cast< Bytef * >( in );
+                z.avail_in = static_cast< uInt >( std::min< CFIndex >( left, 0x40000000 ) );
+                in        += z.avail_in;
+                left      -= z.avail_in;
+            }
+            
+            if( used == capacity && __GrowBuffer( out, capacity ) == false )
+            {
+                r = Z_MEM_ERROR;
+                
+                break;
+            }
+            
+            z.next_out  = out + used;
+            z.avail_out = static_cast< uInt >( std::min< CFIndex >( capacity - used, 0x40000000 ) );
+            used       += z.avail_out;
+            r           = deflate( &z, ( left == 0 ) ? Z_FINISH : Z_NO_FLUSH );
+            used       -= z.avail_out;
+        }
+        
+        deflateEnd( &z );
+        
+        if( r != Z_STREAM_END )
+        {
+            if( out != nullptr )
+            {
+                CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), out );
+            }
+            
+            return nullptr;
+        }
+        
+        return __AdoptBuffer( out, used );
+        
+        #else
+        
+        ( void )format;
+        ( void )level;
+        
+        return nullptr;
+        
+        #endif
+    }
+    
+    Data Data::Decompress( Compression format ) const
+    {
+        #ifdef CFPP_ZLIB
+        
+        z_stream     z;
+        gz_header    header;
+        Byte       * out;
+        const Byte * in;
+        CFIndex      left;
+        CFIndex      capacity;
+        CFIndex      used;
+        int          r;
+        
+        if( this->IsValid() == false )
+        {
+            return nullptr;
+        }
+        
+        memset( &z,      0, sizeof( z_stream ) );
+        memset( &header, 0, sizeof( gz_header ) );
+        
+        /* +32 detects either a zlib or a gzip header */
+        if( inflateInit2( &z, ( format == CompressionDeflate ) ? -MAX_WBITS : MAX_WBITS + 32 ) != Z_OK )
+        {
+            return nullptr;
+        }
+        
+        /* Tells gzip members, which may be followed by another one, from other streams */
+        inflateGetHeader( &z, &header );
+        
+        in       = this->GetBytePtr();
+        left     = this->GetLength();
+        used     = 0;
+        capacity = std::max< CFIndex >( 4096, left * 4 );
+        out      = static_cast< Byte * >( CFAllocatorAllocate( static_cast< CFAllocatorRef >( nullptr ), capacity, 0 ) );
+        r        = ( out == nullptr ) ? Z_MEM_ERROR : Z_OK;
+        
+        while( r == Z_OK )
+        {
+            if( z.avail_in == 0 && left > 0 )
+            {
+                z.next_in  = const_cast< Bytef * >( in );
+                z.avail_in = static_cast< uInt >( std::min< CFIndex >( left, 0x40000000 ) );
+                in        += z.avail_in;
+                left      -= z.avail_in;
+            }
+            
+            if( used == capacity && __GrowBuffer( out, capacity ) == false )
+            {
+                r = Z_MEM_ERROR;
+                
+                break;
+            }
+            
+            z.next_out  = out + used;
+            z.avail_out = static_cast< uInt >( std::min< CFIndex >( capacity - used, 0x40000000 ) );
+            used       += z.avail_out;
+            r           = inflate( &z, Z_NO_FLUSH );
+            used       -= z.avail_out;
+            
+            /* Next gzip member, nothing may follow other streams */
+            if( r == Z_STREAM_END && ( z.avail_in > 0 || left > 0 ) )
+            {
+                r = ( header.done == 1 ) ? inflateReset( &z ) : Z_DATA_ERROR;
+                
+                if( r == Z_OK )
+                {
+                    inflateGetHeader( &z, &header );
+                }
+            }
+        }
+        
+        inflateEnd( &z );
+        
+        /* Z_BUF_ERROR means the input ended before the compressed stream */
+        if( r != Z_STREAM_END )
+        {
+            if( out != nullptr )
+            {
+                CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), out );
+            }
+            
+            return nullptr;
+        }
+        
+        return __AdoptBuffer( out, used );
+        
+        #else
+        
+        ( void )format;
+        
+        return nullptr;
+        
+        #endif
     }
     
     Data::Iterator Data::begin() const
@@ -373,10 +2088,39 @@ namespace CF
         return Iterator( this->_cfObject, this->GetLength(), this->GetLength() );
     }
     
+    CFMutableDataRef Data::GetMutableCFObject() const
+    {
+        CFMutableDataRef data;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return nullptr;
+        }
+        
+        /* Copy on first write if the object is shared or was not created mutable by us */
+        if( this->_mutable == false || CFGetRetainCount( this->_cfObject ) > 1 )
+        {
+            data = CFDataCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, this->_cfObject );
+            
+            if( data == nullptr )
+            {
+                return nullptr;
+            }
+            
+            CFRelease( this->_cfObject );
+            
+            this->_cfObject = data;
+            this->_mutable  = true;
+        }
+        
+        return const_cast< CFMutableDataRef >( this->_cfObject );
+    }
+    
     void swap( Data & v1, Data & v2 ) noexcept
     {
         using std::swap;
         
         swap( v1._cfObject, v2._cfObject );
+        swap( v1._mutable,  v2._mutable );
     }
 }
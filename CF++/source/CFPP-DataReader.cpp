@@ -0,0 +1,443 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-DataReader.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Binary reader over CF::Data
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+
+namespace CF
+{
+    DataReader::DataReader():
+        _cfObject( nullptr ),
+        _bytes( nullptr ),
+        _length( 0 ),
+        _pos( 0 ),
+        _order( Data::ByteOrderLittleEndian ),
+        _failed( false )
+    {}
+    
+    DataReader::DataReader( const Data & data, Data::ByteOrder order ):
+        _cfObject( static_cast< CFDataRef >( data.GetCFObject() ) ),
+        _bytes( data.GetBytePtr() ),
+        _length( data.GetLength() ),
+        _pos( 0 ),
+        _order( order ),
+        _failed( false )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    DataReader::DataReader( const DataReader & value ):
+        _cfObject( value._cfObject ),
+        _bytes( value._bytes ),
+        _length( value._length ),
+        _pos( value._pos ),
+        _order( value._order ),
+        _failed( value._failed )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    DataReader::DataReader( DataReader && value ) noexcept:
+        _cfObject( value._cfObject ),
+        _bytes( value._bytes ),
+        _length( value._length ),
+        _pos( value._pos ),
+        _order( value._order ),
+        _failed( value._failed )
+    {
+        value._cfObject = nullptr;
+        value._bytes    = nullptr;
+        value._length   = 0;
+        value._pos      = 0;
+    }
+    
+    DataReader::~DataReader()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+        }
+    }
+    
+    DataReader & DataReader::operator =( DataReader value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    CFIndex DataReader::GetLength() const
+    {
+        return this->_length;
+    }
+    
+    CFIndex DataReader::GetPosition() const
+    {
+        return this->_pos;
+    }
+    
+    CFIndex DataReader::GetRemaining() const
+    {
+        return this->_length - this->_pos;
+    }
+    
+    const Data::Byte * DataReader::GetBytePtr() const
+    {
+        if( this->_bytes == nullptr )
+        {
+            return nullptr;
+        }
+        
+        return this->_bytes + this->_pos;
+    }
+    
+    Data::ByteOrder DataReader::GetByteOrder() const
+    {
+        return this->_order;
+    }
+    
+    bool DataReader::HasFailed() const
+    {
+        return this->_failed;
+    }
+    
+    bool DataReader::IsAtEnd() const
+    {
+        return this->_pos >= this->_length;
+    }
+    
+    void DataReader::SetByteOrder( Data::ByteOrder order )
+    {
+        this->_order = order;
+    }
+    
+    bool DataReader::SetPosition( CFIndex position )
+    {
+        if( position < 0 || position > this->_length )
+        {
+            this->_failed = true;
+            
+            return false;
+        }
+        
+        this->_pos = position;
+        
+        return true;
+    }
+    
+    bool DataReader::Skip( CFIndex length )
+    {
+        const Data::Byte * p;
+        
+        return this->Consume( length, p );
+    }
+    
+    bool DataReader::Require( CFIndex length )
+    {
+        if( length < 0 || length > this->_length - this->_pos )
+        {
+            this->_failed = true;
+            
+            return false;
+        }
+        
+        return true;
+    }
+    
+    UInt8 DataReader::GetU8()
+    {
+        const Data::Byte * p;
+        
+        if( this->Consume( 1, p ) == false )
+        {
+            return 0;
+        }
+        
+        return p[ 0 ];
+    }
+    
+    UInt16 DataReader::GetU16()
+    {
+        const Data::Byte * p;
+        
+        if( this->Consume( 2, p ) == false )
+        {
+            return 0;
+        }
+        
+        if( this->_order == Data::ByteOrderLittleEndian )
+        {
+            return static_cast< UInt16 >( p[ 0 ] | ( p[ 1 ] << 8 ) );
+        }
+        
+        return static_cast< UInt16 >( ( p[ 0 ] << 8 ) | p[ 1 ] );
+    }
+    
+    UInt32 DataReader::GetU32()
+    {
+        const Data::Byte * p;
+        UInt32             value;
+        int                i;
+        
+        if( this->Consume( 4, p ) == false )
+        {
+            return 0;
+        }
+        
+        value = 0;
+        
+        for( i = 0; i < 4; i++ )
+        {
+            value |= static_cast< UInt32 >( p[ ( this->_order == Data::ByteOrderLittleEndian ) ? i : 3 - i ] ) << ( i * 8 );
+        }
+        
+        return value;
+    }
+    
+    UInt64 DataReader::GetU64()
+    {
+        const Data::Byte * p;
+        UInt64             value;
+        int                i;
+        
+        if( this->Consume( 8, p ) == false )
+        {
+            return 0;
+        }
+        
+        value = 0;
+        
+        for( i = 0; i < 8; i++ )
+        {
+            value |= static_cast< UInt64 >( p[ ( this->_order == Data::ByteOrderLittleEndian ) ? i : 7 - i ] ) << ( i * 8 );
+        }
+        
+        return value;
+    }
+    
+    Float32 DataReader::GetF32()
+    {
+        UInt32  u;
+        Float32 f;
+        
+        u = this->GetU32();
+        
+        memcpy( &f, &u, sizeof( f ) );
+        
+        return f;
+    }
+    
+    Float64 DataReader::GetF64()
+    {
+        UInt64  u;
+        Float64 f;
+        
+        u = this->GetU64();
+        
+        memcpy( &f, &u, sizeof( f ) );
+        
+        return f;
+    }
+    
+    UInt64 DataReader::GetVarUInt()
+    {
+        UInt64     value;
+        unsigned   shift;
+        CFIndex    pos;
+        Data::Byte b;
+        
+        value = 0;
+        shift = 0;
+        pos   = this->_pos;
+        
+        while( pos < this->_length && shift < 64 )
+        {
+            b = this->_bytes[ pos++ ];
+            
+            /* The 10th byte only holds bit 63 */
+            if( shift == 63 && ( b & 0x7F ) > 1 )
+            {
+                break;
+            }
+            
+            value |= static_cast< UInt64 >( b & 0x7F ) << shift;
+            
+            if( ( b & 0x80 ) == 0 )
+            {
+                this->_pos = pos;
+                
+                return value;
+            }
+            
+            shift += 7;
+        }
+        
+        /* Truncated, overflowing, or longer than 10 bytes */
+        this->_failed = true;
+        
+        return 0;
+    }
+    
+    SInt64 DataReader::GetVarInt()
+    {
+        UInt64     value;
+        unsigned   shift;
+        CFIndex    pos;
+        Data::Byte b;
+        
+        value = 0;
+        shift = 0;
+        pos   = this->_pos;
+        
+        while( pos < this->_length && shift < 64 )
+        {
+            b = this->_bytes[ pos++ ];
+            
+            /* The 10th byte only holds bit 63, sign-extended */
+            if( shift == 63 && ( b & 0x7F ) != 0 && ( b & 0x7F ) != 0x7F )
+            {
+                break;
+            }
+            
+            value |= static_cast< UInt64 >( b & 0x7F ) << shift;
+            shift += 7;
+            
+            if( ( b & 0x80 ) == 0 )
+            {
+                if( shift < 64 && ( b & 0x40 ) != 0 )
+                {
+                    value |= ~static_cast< UInt64 >( 0 ) << shift;
+                }
+                
+                this->_pos = pos;
+                
+                return static_cast< SInt64 >( value );
+            }
+        }
+        
+        this->_failed = true;
+        
+        return 0;
+    }
+    
+    bool DataReader::GetBytes( Data::Byte * bytes, CFIndex length )
+    {
+        const Data::Byte * p;
+        
+        if( bytes == nullptr || this->Consume( length, p ) == false )
+        {
+            return false;
+        }
+        
+        if( length > 0 )
+        {
+            memcpy( bytes, p, static_cast< std::size_t >( length ) );
+        }
+        
+        return true;
+    }
+    
+    DataReader DataReader::GetSlice( CFIndex length )
+    {
+        DataReader         slice;
+        const Data::Byte * p;
+        
+        if( this->Consume( length, p ) == false )
+        {
+            slice._failed = true;
+            
+            return slice;
+        }
+        
+        slice._cfObject = this->_cfObject;
+        slice._bytes    = p;
+        slice._length   = length;
+        slice._order    = this->_order;
+        
+        if( slice._cfObject != nullptr )
+        {
+            CFRetain( slice._cfObject );
+        }
+        
+        return slice;
+    }
+    
+    DataReader DataReader::GetVarSlice()
+    {
+        UInt64     length;
+        DataReader slice;
+        
+        length = this->GetVarUInt();
+        
+        if( this->_failed || length > static_cast< UInt64 >( this->GetRemaining() ) )
+        {
+            this->_failed = true;
+            slice._failed = true;
+            
+            return slice;
+        }
+        
+        return this->GetSlice( static_cast< CFIndex >( length ) );
+    }
+    
+    bool DataReader::Consume( CFIndex length, const Data::Byte * & bytes )
+    {
+        if( length < 0 || length > this->_length - this->_pos )
+        {
+            this->_failed = true;
+            bytes         = nullptr;
+            
+            return false;
+        }
+        
+        bytes       = ( this->_bytes != nullptr ) ? this->_bytes + this->_pos : nullptr;
+        this->_pos += length;
+        
+        return true;
+    }
+    
+    void swap( DataReader & v1, DataReader & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._cfObject, v2._cfObject );
+        swap( v1._bytes,    v2._bytes );
+        swap( v1._length,   v2._length );
+        swap( v1._pos,      v2._pos );
+        swap( v1._order,    v2._order );
+        swap( v1._failed,   v2._failed );
+    }
+}
@@ -0,0 +1,398 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-DataWriter.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Buffered binary writer producing CF::Data
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+#include <limits>
+
+namespace CF
+{
+    DataWriter::DataWriter( Data::ByteOrder order ): _buffer( nullptr ), _capacity( 0 ), _length( 0 ), _order( order ), _failed( false )
+    {}
+    
+    DataWriter::DataWriter( CFIndex capacity, Data::ByteOrder order ): _buffer( nullptr ), _capacity( 0 ), _length( 0 ), _order( order ), _failed( false )
+    {
+        this->Reserve( capacity );
+    }
+    
+    DataWriter::DataWriter( const DataWriter & value ): _buffer( nullptr ), _capacity( 0 ), _length( 0 ), _order( value._order ), _failed( value._failed )
+    {
+        this->Reserve( value._length );
+        
+        if( this->_capacity >= value._length && value._length > 0 )
+        {
+            memcpy( this->_buffer, value._buffer, static_cast< std::size_t >( value._length ) );
+            
+            this->_length = value._length;
+        }
+        else if( value._length > 0 )
+        {
+            this->_failed = true;
+        }
+    }
+    
+    DataWriter::DataWriter( DataWriter && value ) noexcept:
+        _buffer( value._buffer ),
+        _capacity( value._capacity ),
+        _length( value._length ),
+        _order( value._order ),
+        _failed( value._failed )
+    {
+        value._buffer   = nullptr;
+        value._capacity = 0;
+        value._length   = 0;
+        value._failed   = false;
+    }
+    
+    DataWriter::~DataWriter()
+    {
+        if( this->_buffer != nullptr )
+        {
+            CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), this->_buffer );
+        }
+    }
+    
+    DataWriter & DataWriter::operator =( DataWriter value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    CFIndex DataWriter::GetLength() const
+    {
+        return this->_length;
+    }
+    
+    CFIndex DataWriter::GetCapacity() const
+    {
+        return this->_capacity;
+    }
+    
+    Data::ByteOrder DataWriter::GetByteOrder() const
+    {
+        return this->_order;
+    }
+    
+    bool DataWriter::HasFailed() const
+    {
+        return this->_failed;
+    }
+    
+    void DataWriter::SetByteOrder( Data::ByteOrder order )
+    {
+        this->_order = order;
+    }
+    
+    void DataWriter::Reserve( CFIndex capacity )
+    {
+        Data::Byte * buffer;
+        
+        if( capacity <= this->_capacity )
+        {
+            return;
+        }
+        
+        /* Not zero-filled, bytes past the length are never read */
+        buffer = static_cast< Data::Byte * >( CFAllocatorReallocate( static_cast< CFAllocatorRef >( nullptr ), this->_buffer, capacity, 0 ) );
+        
+        if( buffer == nullptr )
+        {
+            return;
+        }
+        
+        this->_buffer   = buffer;
+        this->_capacity = capacity;
+    }
+    
+    void DataWriter::Clear()
+    {
+        this->_length = 0;
+        this->_failed = false;
+    }
+    
+    void DataWriter::PutU8( UInt8 value )
+    {
+        if( this->_length + 1 > this->_capacity && this->Grow( 1 ) == false )
+        {
+            return;
+        }
+        
+        this->_buffer[ this->_length++ ] = value;
+    }
+    
+    void DataWriter::PutU16( UInt16 value )
+    {
+        Data::Byte * p;
+        
+        if( this->_length + 2 > this->_capacity && this->Grow( 2 ) == false )
+        {
+            return;
+        }
+        
+        p              = this->_buffer + this->_length;
+        this->_length += 2;
+        
+        if( this->_order == Data::ByteOrderLittleEndian )
+        {
+            p[ 0 ] = static_cast< Data::Byte >( value );
+            p[ 1 ] = static_cast< Data::Byte >( value >> 8 );
+        }
+        else
+        {
+            p[ 0 ] = static_cast< Data::Byte >( value >> 8 );
+            p[ 1 ] = static_cast< Data::Byte >( value );
+        }
+    }
+    
+    void DataWriter::PutU32( UInt32 value )
+    {
+        Data::Byte * p;
+        int          i;
+        
+        if( this->_length + 4 > this->_capacity && this->Grow( 4 ) == false )
+        {
+            return;
+        }
+        
+        p              = this->_buffer + this->_length;
+        this->_length += 4;
+        
+        for( i = 0; i < 4; i++ )
+        {
+            p[ ( this->_order == Data::ByteOrderLittleEndian ) ? i : 3 - i ] = static_cast< Data::Byte >( value >> ( i * 8 ) );
+        }
+    }
+    
+    void DataWriter::PutU64( UInt64 value )
+    {
+        Data::Byte * p;
+        int          i;
+        
+        if( this->_length + 8 > this->_capacity && this->Grow( 8 ) == false )
+        {
+            return;
+        }
+        
+        p              = this->_buffer + this->_length;
+        this->_length += 8;
+        
+        for( i = 0; i < 8; i++ )
+        {
+            p[ ( this->_order == Data::ByteOrderLittleEndian ) ? i : 7 - i ] = static_cast< Data::Byte >( value >> ( i * 8 ) );
+        }
+    }
+    
+    void DataWriter::PutF32( Float32 value )
+    {
+        UInt32 u;
+        
+        memcpy( &u, &value, sizeof( u ) );
+        
+        this->PutU32( u );
+    }
+    
+    void DataWriter::PutF64( Float64 value )
+    {
+        UInt64 u;
+        
+        memcpy( &u, &value, sizeof( u ) );
+        
+        this->PutU64( u );
+    }
+    
+    void DataWriter::PutBytes( const Data::Byte * bytes, CFIndex length )
+    {
+        if( bytes == nullptr || length <= 0 )
+        {
+            return;
+        }
+        
+        if( length > this->_capacity - this->_length && this->Grow( length ) == false )
+        {
+            return;
+        }
+        
+        memcpy( this->_buffer + this->_length, bytes, static_cast< std::size_t >( length ) );
+        
+        this->_length += length;
+    }
+    
+    void DataWriter::PutData( const Data & value )
+    {
+        this->PutBytes( value.GetBytePtr(), value.GetLength() );
+    }
+    
+    void DataWriter::PutVarUInt( UInt64 value )
+    {
+        Data::Byte * p;
+        
+        if( this->_length + 10 > this->_capacity && this->Grow( 10 ) == false )
+        {
+            return;
+        }
+        
+        p = this->_buffer + this->_length;
+        
+        while( value >= 0x80 )
+        {
+            *( p++ )   = static_cast< Data::Byte >( value | 0x80 );
+            value    >>= 7;
+        }
+        
+        *( p++ ) = static_cast< Data::Byte >( value );
+        
+        this->_length = p - this->_buffer;
+    }
+    
+    void DataWriter::PutVarInt( SInt64 value )
+    {
+        Data::Byte * p;
+        Data::Byte   b;
+        bool         more;
+        
+        if( this->_length + 10 > this->_capacity && this->Grow( 10 ) == false )
+        {
+            return;
+        }
+        
+        p    = this->_buffer + this->_length;
+        more = true;
+        
+        while( more )
+        {
+            b       = static_cast< Data::Byte >( value & 0x7F );
+            value >>= 7; /* Arithmetic shift, sign-extending */
+            
+            if( ( value == 0 && ( b & 0x40 ) == 0 ) || ( value == -1 && ( b & 0x40 ) != 0 ) )
+            {
+                more = false;
+            }
+            else
+            {
+                b |= 0x80;
+            }
+            
+            *( p++ ) = b;
+        }
+        
+        this->_length = p - this->_buffer;
+    }
+    
+    Data DataWriter::Commit()
+    {
+        Data::Byte * bytes;
+        CFIndex      length;
+        Data         data;
+        
+        if( this->_failed )
+        {
+            this->Clear();
+            
+            return Data( static_cast< CFDataRef >( nullptr ) );
+        }
+        
+        if( this->_length == 0 )
+        {
+            return Data();
+        }
+        
+        /* The data keeps the whole block alive, so drop the spare capacity (usually in place) */
+        bytes  = static_cast< Data::Byte * >( CFAllocatorReallocate( static_cast< CFAllocatorRef >( nullptr ), this->_buffer, this->_length, 0 ) );
+        bytes  = ( bytes == nullptr ) ? this->_buffer : bytes;
+        length = this->_length;
+        
+        this->_buffer   = nullptr;
+        this->_capacity = 0;
+        this->_length   = 0;
+        
+        data = Data::NoCopy( bytes, length, static_cast< CFAllocatorRef >( nullptr ) );
+        
+        if( data.IsValid() == false )
+        {
+            CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), bytes );
+        }
+        
+        return data;
+    }
+    
+    void DataWriter::CommitTo( Data & data )
+    {
+        if( this->_failed == false )
+        {
+            data.AppendBytes( this->_buffer, this->_length );
+        }
+        
+        this->Clear();
+    }
+    
+    bool DataWriter::Grow( CFIndex length )
+    {
+        CFIndex capacity;
+        CFIndex needed;
+        
+        if( length > std::numeric_limits< CFIndex >::max() - this->_length )
+        {
+            this->_failed = true;
+            
+            return false;
+        }
+        
+        needed   = this->_length + length;
+        capacity = ( this->_capacity < 64 ) ? 64 : this->_capacity;
+        
+        while( capacity < needed )
+        {
+            capacity = ( capacity > needed / 2 ) ? needed : capacity * 2;
+        }
+        
+        this->Reserve( capacity );
+        
+        if( this->_capacity < needed )
+        {
+            this->_failed = true;
+            
+            return false;
+        }
+        
+        return true;
+    }
+    
+    void swap( DataWriter & v1, DataWriter & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._buffer,   v2._buffer );
+        swap( v1._capacity, v2._capacity );
+        swap( v1._length,   v2._length );
+        swap( v1._order,    v2._order );
+        swap( v1._failed,   v2._failed );
+    }
+}
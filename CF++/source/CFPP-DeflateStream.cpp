@@ -0,0 +1,278 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-DeflateStream.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Compressing adaptor for CF::WriteStream
+ */
+
+#include <CF++.hpp>
+
+#ifdef CFPP_ZLIB
+#include <zlib.h>
+#endif
+
+namespace CF
+{
+    DeflateStream::DeflateStream( const WriteStream & stream, Data::Compression format, int level ):
+        _stream( stream ),
+        _z( nullptr ),
+        _finished( false ),
+        _failed( false )
+    {
+        #ifdef CFPP_ZLIB
+        
+        z_stream * z;
+        int        bits;
+        
+        if( stream.IsValid() == false )
+        {
+            return;
+        }
+        
+        z    = new z_stream();
+        bits = ( format == Data::CompressionDeflate ) ? -MAX_WBITS : ( ( format == Data::CompressionGzip ) ? MAX_WBITS + 16 : MAX_WBITS );
+        
+        if( deflateInit2( z, level, Z_DEFLATED, bits, 8, Z_DEFAULT_STRATEGY ) != Z_OK )
+        {
+            delete z;
+            
+            return;
+        }
+        
+        this->_z = z;
+        
+        this->_buffer.resize( 65536 );
+        
+        #else
+        
+        ( void )format;
+        ( void )level;
+        
+        #endif
+    }
+    
+    DeflateStream::DeflateStream( DeflateStream && value ) noexcept:
+        _stream( std::move( value._stream ) ),
+        _z( value._z ),
+        _buffer( std::move( value._buffer ) ),
+        _finished( value._finished ),
+        _failed( value._failed )
+    {
+        value._z = nullptr;
+    }
+    
+    DeflateStream::~DeflateStream()
+    {
+        #ifdef CFPP_ZLIB
+        
+        if( this->_z != nullptr )
+        {
+            this->Finish();
+            
+            deflateEnd( this->_z );
+            
+            delete this->_z;
+            
+            this->_z = nullptr;
+        }
+        
+        #endif
+    }
+    
+    DeflateStream & DeflateStream::operator =( DeflateStream value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    bool DeflateStream::IsValid() const
+    {
+        return this->_z != nullptr;
+    }
+    
+    bool DeflateStream::IsFinished() const
+    {
+        return this->_finished;
+    }
+    
+    bool DeflateStream::HasFailed() const
+    {
+        return this->_failed;
+    }
+    
+    CFIndex DeflateStream::Write( const Data::Byte * buffer, CFIndex length )
+    {
+        #ifdef CFPP_ZLIB
+        
+        CFIndex left;
+        
+        if( this->_z == nullptr || this->_finished || this->_failed )
+        {
+            return -1;
+        }
+        
+        if( buffer == nullptr || length <= 0 )
+        {
+            return -1;
+        }
+        
+        this->_z->next_in = const_cast< Bytef * >( buffer );
+        left              = length;
+        
+        /* avail_in is 32 bits, deflate advances next_in */
+        while( left > 0 )
+        {
+            this->_z->avail_in = static_cast< uInt >( std::min< CFIndex >( left, 0x40000000 ) );
+            left              -= static_cast< CFIndex >( this->_z->avail_in );
+            
+            if( this->_Deflate( Z_NO_FLUSH ) == false )
+            {
+                return -1;
+            }
+        }
+        
+        return length;
+        
+        #else
+        
+        ( void )buffer;
+        ( void )length;
+        
+        return -1;
+        
+        #endif
+    }
+    
+    CFIndex DeflateStream::Write( const Data & data )
+    {
+        return this->Write( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    bool DeflateStream::Flush()
+    {
+        #ifdef CFPP_ZLIB
+        
+        if( this->_z == nullptr || this->_finished || this->_failed )
+        {
+            return false;
+        }
+        
+        this->_z->avail_in = 0;
+        
+        return this->_Deflate( Z_SYNC_FLUSH );
+        
+        #else
+        
+        return false;
+        
+        #endif
+    }
+    
+    bool DeflateStream::Finish()
+    {
+        #ifdef CFPP_ZLIB
+        
+        if( this->_z == nullptr || this->_failed )
+        {
+            return false;
+        }
+        
+        if( this->_finished )
+        {
+            return true;
+        }
+        
+        this->_z->avail_in = 0;
+        
+        if( this->_Deflate( Z_FINISH ) == false )
+        {
+            return false;
+        }
+        
+        this->_finished = true;
+        
+        return true;
+        
+        #else
+        
+        return false;
+        
+        #endif
+    }
+    
+    bool DeflateStream::_Deflate( int flush )
+    {
+        #ifdef CFPP_ZLIB
+        
+        CFIndex n;
+        
+        /* Until deflate leaves room in the buffer, i.e. has nothing left */
+        do
+        {
+            this->_z->next_out  = &( this->_buffer[ 0 ] );
+            this->_z->avail_out = static_cast< uInt >( this->_buffer.size() );
+            
+            if( deflate( this->_z, flush ) == Z_STREAM_ERROR )
+            {
+                this->_failed = true;
+                
+                return false;
+            }
+            
+            n = static_cast< CFIndex >( this->_buffer.size() - this->_z->avail_out );
+            
+            if( n > 0 && this->_stream.WriteAll( &( this->_buffer[ 0 ] ), n ) == false )
+            {
+                this->_failed = true;
+                
+                return false;
+            }
+        }
+        while( this->_z->avail_out == 0 );
+        
+        return true;
+        
+        #else
+        
+        ( void )flush;
+        
+        return false;
+        
+        #endif
+    }
+    
+    void swap( DeflateStream & v1, DeflateStream & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._stream,   v2._stream );
+        swap( v1._z,        v2._z );
+        swap( v1._buffer,   v2._buffer );
+        swap( v1._finished, v2._finished );
+        swap( v1._failed,   v2._failed );
+    }
+}
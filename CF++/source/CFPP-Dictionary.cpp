@@ -138,6 +138,39 @@ static void __createCallbacks()
 
 #endif
 
+/* Lookup keys: the interned string when there is one, otherwise a temporary wrapping the caller's bytes */
+static CF::String __LookupKey( const char * key );
+static CF::String __LookupKey( const char * key )
+{
+    CFStringRef s;
+    
+    key = ( key == nullptr ) ? "" : key;
+    s   = CF::String::GetInterned( key );
+    
+    if( s != nullptr )
+    {
+        return s;
+    }
+    
+    return CF::String::NoCopy( key );
+}
+
+/* Stored keys: the interned string when there is one, otherwise a copy */
+static CF::String __StoredKey( const char * key );
+static CF::String __StoredKey( const char * key )
+{
+    CFStringRef s;
+    
+    s = CF::String::GetInterned( ( key == nullptr ) ? "" : key );
+    
+    if( s != nullptr )
+    {
+        return s;
+    }
+    
+    return CF::String( key );
+}
+
 namespace CF
 {
     Dictionary::Dictionary(): _cfObject( nullptr )
@@ -306,7 +339,7 @@ namespace CF
     
     CFTypeRef Dictionary::operator [] ( const char * key ) const
     {
-        return operator []( String( key ) );
+        return operator []( __LookupKey( key ) );
     }
     
     CFTypeRef Dictionary::operator [] ( const String & key ) const
@@ -336,7 +369,7 @@ namespace CF
     
     bool Dictionary::ContainsKey( const char * key ) const
     {
-        return this->ContainsKey( String( key ) );
+        return this->ContainsKey( __LookupKey( key ) );
     }
     
     bool Dictionary::ContainsKey( const String & key ) const
@@ -381,7 +414,7 @@ namespace CF
     
     CFTypeRef Dictionary::GetValue( const char * key ) const
     {
-        return this->GetValue( String( key ) );
+        return this->GetValue( __LookupKey( key ) );
     }
     
     CFTypeRef Dictionary::GetValue( const String & key ) const
@@ -401,7 +434,7 @@ namespace CF
     
     void Dictionary::AddValue( const char * key, CFTypeRef value )
     {
-        this->AddValue( String( key ), value );
+        this->AddValue( __StoredKey( key ), value );
     }
     
     void Dictionary::AddValue( const String & key, CFTypeRef value )
@@ -421,7 +454,7 @@ namespace CF
     
     void Dictionary::RemoveValue( const char * key )
     {
-        this->RemoveValue( String( key ) );
+        this->RemoveValue( __LookupKey( key ) );
     }
     
     void Dictionary::RemoveValue( const String & key )
@@ -441,7 +474,7 @@ namespace CF
     
     void Dictionary::ReplaceValue( const char * key, CFTypeRef value )
     {
-        this->ReplaceValue( String( key ), value );
+        this->ReplaceValue( __StoredKey( key ), value );
     }
     
     void Dictionary::ReplaceValue( const String & key, CFTypeRef value )
@@ -461,7 +494,7 @@ namespace CF
     
     void Dictionary::SetValue( const char * key, CFTypeRef value )
     {
-        this->SetValue( String( key ), value );
+        this->SetValue( __StoredKey( key ), value );
     }
     
     void Dictionary::SetValue( const String & key, CFTypeRef value )
@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-InflateStream.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Decompressing adaptor for CF::ReadStream
+ */
+
+#include <CF++.hpp>
+
+#ifdef CFPP_ZLIB
+#include <zlib.h>
+#endif
+
+namespace CF
+{
+    InflateStream::InflateStream( const ReadStream & stream, Data::Compression format ):
+        _stream( stream ),
+        _z( nullptr ),
+        _header( nullptr ),
+        _end( false ),
+        _failed( false )
+    {
+        #ifdef CFPP_ZLIB
+        
+        z_stream * z;
+        
+        if( stream.IsValid() == false )
+        {
+            return;
+        }
+        
+        z = new z_stream();
+        
+        /* +32 detects either a zlib or a gzip header */
+        if( inflateInit2( z, ( format == Data::CompressionDeflate ) ? -MAX_WBITS : MAX_WBITS + 32 ) != Z_OK )
+        {
+            delete z;
+            
+            return;
+        }
+        
+        /* Tells gzip members, which may be followed by another one, from other streams */
+        this->_z      = z;
+        this->_header = new gz_header();
+        
+        inflateGetHeader( this->_z, this->_header );
+        
+        this->_buffer.resize( 65536 );
+        
+        #else
+        
+        ( void )format;
+        
+        #endif
+    }
+    
+    InflateStream::InflateStream( InflateStream && value ) noexcept:
+        _stream( std::move( value._stream ) ),
+        _z( value._z ),
+        _header( value._header ),
+        _buffer( std::move( value._buffer ) ),
+        _end( value._end ),
+        _failed( value._failed )
+    {
+        value._z      = nullptr;
+        value._header = nullptr;
+    }
+    
+    InflateStream::~InflateStream()
+    {
+        #ifdef CFPP_ZLIB
+        
+        if( this->_z != nullptr )
+        {
+            inflateEnd( this->_z );
+            
+            delete this->_z;
+            delete this->_header;
+            
+            this->_z      = nullptr;
+            this->_header = nullptr;
+        }
+        
+        #endif
+    }
+    
+    InflateStream & InflateStream::operator =( InflateStream value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    bool InflateStream::IsValid() const
+    {
+        return this->_z != nullptr;
+    }
+    
+    bool InflateStream::IsAtEnd() const
+    {
+        return this->_end;
+    }
+    
+    bool InflateStream::HasFailed() const
+    {
+        return this->_failed;
+    }
+    
+    CFIndex InflateStream::Read( Data::Byte * buffer, CFIndex length )
+    {
+        #ifdef CFPP_ZLIB
+        
+        CFIndex size;
+        int     r;
+        
+        if( this->_z == nullptr || this->_failed )
+        {
+            return -1;
+        }
+        
+        if( buffer == nullptr || length <= 0 )
+        {
+            return -1;
+        }
+        
+        if( this->_end )
+        {
+            return 0;
+        }
+        
+        /* avail_out is 32 bits */
+        size                = std::min< CFIndex >( length, 0x40000000 );
+        this->_z->next_out  = buffer;
+        this->_z->avail_out = static_cast< uInt >( size );
+        
+        while( this->_z->avail_out > 0 && this->_end == false && this->_failed == false )
+        {
+            if( this->_z->avail_in == 0 && this->_Fill() <= 0 )
+            {
+                /* The stream ended before the compressed data */
+                this->_failed = true;
+                
+                break;
+            }
+            
+            r = inflate( this->_z, Z_NO_FLUSH );
+            
+            if( r == Z_STREAM_END )
+            {
+                if( this->_z->avail_in == 0 && this->_Fill() == 0 )
+                {
+                    this->_end = true;
+                }
+                else if( this->_failed == false )
+                {
+                    /* Another gzip member may follow a gzip member, nothing may follow other streams */
+                    if( this->_header->done == 1 && inflateReset( this->_z ) == Z_OK )
+                    {
+                        inflateGetHeader( this->_z, this->_header );
+                    }
+                    else
+                    {
+                        this->_failed = true;
+                    }
+                }
+            }
+            else if( r != Z_OK )
+            {
+                this->_failed = true;
+            }
+        }
+        
+        size -= static_cast< CFIndex >( this->_z->avail_out );
+        
+        /* Bytes decompressed before a failure are returned first */
+        if( size == 0 && this->_failed )
+        {
+            return -1;
+        }
+        
+        return size;
+        
+        #else
+        
+        ( void )buffer;
+        ( void )length;
+        
+        return -1;
+        
+        #endif
+    }
+    
+    Data InflateStream::Read( CFIndex length )
+    {
+        Data    data;
+        CFIndex size;
+        CFIndex used;
+        CFIndex n;
+        
+        if( this->IsValid() == false )
+        {
+            return nullptr;
+        }
+        
+        size = ( length > 0 ) ? length : 65536;
+        used = 0;
+        
+        data.SetLength( size );
+        
+        while( 1 )
+        {
+            if( used == size )
+            {
+                if( length > 0 )
+                {
+                    break;
+                }
+                
+                size *= 2;
+                
+                data.SetLength( size );
+            }
+            
+            n = this->Read( data.GetMutableBytePtr() + used, size - used );
+            
+            if( n < 0 )
+            {
+                return nullptr;
+            }
+            else if( n == 0 )
+            {
+                break;
+            }
+            
+            used += n;
+        }
+        
+        data.SetLength( used );
+        
+        return data;
+    }
+    
+    CFIndex InflateStream::_Fill()
+    {
+        #ifdef CFPP_ZLIB
+        
+        CFIndex n;
+        
+        n = this->_stream.Read( &( this->_buffer[ 0 ] ), static_cast< CFIndex >( this->_buffer.size() ) );
+        
+        if( n < 0 )
+        {
+            this->_failed = true;
+        }
+        else
+        {
+            this->_z->next_in  = &( this->_buffer[ 0 ] );
+            this->_z->avail_in = static_cast< uInt >( n );
+        }
+        
+        return n;
+        
+        #else
+        
+        return -1;
+        
+        #endif
+    }
+    
+    void swap( InflateStream & v1, InflateStream & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._stream, v2._stream );
+        swap( v1._z,      v2._z );
+        swap( v1._header, v2._header );
+        swap( v1._buffer, v2._buffer );
+        swap( v1._end,    v2._end );
+        swap( v1._failed, v2._failed );
+    }
+}
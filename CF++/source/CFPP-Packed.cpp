@@ -0,0 +1,393 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-Packed.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ reductions over packed numbers
+ */
+
+#include <CF++.hpp>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __SSE2__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define CFPP_PACKED_SSE2
+#include <emmintrin.h>
+#elif defined( __aarch64__ ) || defined( _M_ARM64 )
+#define CFPP_PACKED_NEON
+#include <arm_neon.h>
+#endif
+
+/*
+ * Kernels process 4 values per iteration, in two independent vectors,
+ * then finish the remaining values one by one.
+ */
+
+static double __SumDoubles( const double * values, CFIndex count );
+static double __SumDoubles( const double * values, CFIndex count )
+{
+    CFIndex i   = 0;
+    double  sum = 0;
+    
+    #if defined( CFPP_PACKED_SSE2 )
+    
+    __m128d s1 = _mm_setzero_pd();
+    __m128d s2 = _mm_setzero_pd();
+    
+    for( ; i + 4 <= count; i += 4 )
+    {
+        s1 = _mm_add_pd( s1, _mm_loadu_pd( values + i ) );
+        s2 = _mm_add_pd( s2, _mm_loadu_pd( values + i + 2 ) );
+    }
+    
+    s1  = _mm_add_pd( s1, s2 );
+    s1  = _mm_add_sd( s1, _mm_unpackhi_pd( s1, s1 ) );
+    sum = _mm_cvtsd_f64( s1 );
+    
+    #elif defined( CFPP_PACKED_NEON )
+    
+    float64x2_t s1 = vdupq_n_f64( 0 );
+    float64x2_t s2 = vdupq_n_f64( 0 );
+    
+    for( ; i + 4 <= count; i += 4 )
+    {
+        s1 = vaddq_f64( s1, vld1q_f64( values + i ) );
+        s2 = vaddq_f64( s2, vld1q_f64( values + i + 2 ) );
+    }
+    
+    sum = vaddvq_f64( vaddq_f64( s1, s2 ) );
+    
+    #endif
+    
+    for( ; i < count; i++ )
+    {
+        sum += values[ i ];
+    }
+    
+    return sum;
+}
+
+static SInt64 __SumInt64( const SInt64 * values, CFIndex count );
+static SInt64 __SumInt64( const SInt64 * values, CFIndex count )
+{
+    CFIndex i   = 0;
+    UInt64  sum = 0;
+    
+    #if defined( CFPP_PACKED_SSE2 )
+    
+    __m128i s1 = _mm_setzero_si128();
+    __m128i s2 = _mm_setzero_si128();
+    UInt64  lanes[ 2 ];
+    
+    for( ; i + 4 <= count; i += 4 )
+    {
+        s1 = _mm_add_epi64( s1, _mm_loadu_si128( reinterpret_cast< const __m128i * >( values + i ) ) );
+        s2 = _mm_add_epi64( s2, _mm_loadu_si128( reinterpret_cast< const __m128i * >( values + i + 2 ) ) );
+    }
+    
+    _mm_storeu_si128( reinterpret_cast< __m128i * >( lanes ), _mm_add_epi64( s1, s2 ) );
+    
+    sum = lanes[ 0 ] + lanes[ 1 ];
+    
+    #elif defined( CFPP_PACKED_NEON )
+    
+    uint64x2_t s1 = vdupq_n_u64( 0 );
+    uint64x2_t s2 = vdupq_n_u64( 0 );
+    
+    for( ; i + 4 <= count; i += 4 )
+    {
+        s1 = vaddq_u64( s1, vreinterpretq_u64_s64( vld1q_s64( values + i ) ) );
+        s2 = vaddq_u64( s2, vreinterpretq_u64_s64( vld1q_s64( values + i + 2 ) ) );
+    }
+    
+    sum = vaddvq_u64( vaddq_u64( s1, s2 ) );
+    
+    #endif
+    
+    for( ; i < count; i++ )
+    {
+        sum += static_cast< UInt64 >( values[ i ] );
+    }
+    
+    return static_cast< SInt64 >( sum );
+}
+
+/* Exact 128-bit sum in two words, so the mean cannot wrap around */
+static double __SumInt64Exact( const SInt64 * values, CFIndex count );
+static double __SumInt64Exact( const SInt64 * values, CFIndex count )
+{
+    UInt64 lo = 0;
+    UInt64 hi = 0;
+    UInt64 v;
+    
+    for( CFIndex i = 0; i < count; i++ )
+    {
+        v   = static_cast< UInt64 >( values[ i ] );
+        lo += v;
+        hi += ( lo < v )          ? 1 : 0;
+        hi -= ( values[ i ] < 0 ) ? 1 : 0;
+    }
+    
+    if( ( hi >> 63 ) == 0 )
+    {
+        return static_cast< double >( hi ) * 18446744073709551616.0 + static_cast< double >( lo );
+    }
+    
+    /* Negate first, so small negative sums don't cancel out */
+    lo = ~lo + 1;
+    hi = ~hi + ( ( lo == 0 ) ? 1 : 0 );
+    
+    return -( static_cast< double >( hi ) * 18446744073709551616.0 + static_cast< double >( lo ) );
+}
+
+template< bool _MAX_ >
+static double __MinMaxDoubles( const double * values, CFIndex count );
+template< bool _MAX_ >
+static double __MinMaxDoubles( const double * values, CFIndex count )
+{
+    CFIndex i = 1;
+    double  m = values[ 0 ];
+    
+    #if defined( CFPP_PACKED_SSE2 )
+    
+    if( count >= 4 )
+    {
+        __m128d m1 = _mm_loadu_pd( values );
+        __m128d m2 = _mm_loadu_pd( values + 2 );
+        
+        for( i = 4; i + 4 <= count; i += 4 )
+        {
+            m1 = ( _MAX_ ) ? _mm_max_pd( m1, _mm_loadu_pd( values + i ) )     : _mm_min_pd( m1, _mm_loadu_pd( values + i ) );
+            m2 = ( _MAX_ ) ? _mm_max_pd( m2, _mm_loadu_pd( values + i + 2 ) ) : _mm_min_pd( m2, _mm_loadu_pd( values + i + 2 ) );
+        }
+        
+        m1 = ( _MAX_ ) ? _mm_max_pd( m1, m2 ) : _mm_min_pd( m1, m2 );
+        m1 = ( _MAX_ ) ? _mm_max_sd( m1, _mm_unpackhi_pd( m1, m1 ) ) : _mm_min_sd( m1, _mm_unpackhi_pd( m1, m1 ) );
+        m  = _mm_cvtsd_f64( m1 );
+    }
+    
+    #elif defined( CFPP_PACKED_NEON )
+    
+    if( count >= 4 )
+    {
+        float64x2_t m1 = vld1q_f64( values );
+        float64x2_t m2 = vld1q_f64( values + 2 );
+        
+        for( i = 4; i + 4 <= count; i += 4 )
+        {
+            m1 = ( _MAX_ ) ? vmaxq_f64( m1, vld1q_f64( values + i ) )     : vminq_f64( m1, vld1q_f64( values + i ) );
+            m2 = ( _MAX_ ) ? vmaxq_f64( m2, vld1q_f64( values + i + 2 ) ) : vminq_f64( m2, vld1q_f64( values + i + 2 ) );
+        }
+        
+        m = ( _MAX_ ) ? vmaxvq_f64( vmaxq_f64( m1, m2 ) ) : vminvq_f64( vminq_f64( m1, m2 ) );
+    }
+    
+    #endif
+    
+    for( ; i < count; i++ )
+    {
+        if( ( _MAX_ ) ? values[ i ] > m : values[ i ] < m )
+        {
+            m = values[ i ];
+        }
+    }
+    
+    return m;
+}
+
+/*
+ * SSE2 has no 64-bit integer comparison, so only NEON gets a vector loop
+ * here. Compilers still vectorize the scalar loop with SSE4.2 or AVX2.
+ */
+template< bool _MAX_ >
+static SInt64 __MinMaxInt64( const SInt64 * values, CFIndex count );
+template< bool _MAX_ >
+static SInt64 __MinMaxInt64( const SInt64 * values, CFIndex count )
+{
+    CFIndex i = 1;
+    SInt64  m = values[ 0 ];
+    
+    #if defined( CFPP_PACKED_NEON )
+    
+    if( count >= 4 )
+    {
+        int64x2_t m1 = vld1q_s64( values );
+        int64x2_t m2 = vld1q_s64( values + 2 );
+        int64x2_t v;
+        SInt64    lanes[ 2 ];
+        
+        for( i = 4; i + 4 <= count; i += 4 )
+        {
+            v  = vld1q_s64( values + i );
+            m1 = vbslq_s64( ( _MAX_ ) ? vcgtq_s64( v, m1 ) : vcltq_s64( v, m1 ), v, m1 );
+            v  = vld1q_s64( values + i + 2 );
+            m2 = vbslq_s64( ( _MAX_ ) ? vcgtq_s64( v, m2 ) : vcltq_s64( v, m2 ), v, m2 );
+        }
+        
+        m1 = vbslq_s64( ( _MAX_ ) ? vcgtq_s64( m2, m1 ) : vcltq_s64( m2, m1 ), m2, m1 );
+        
+        vst1q_s64( lanes, m1 );
+        
+        m = lanes[ 0 ];
+        
+        if( ( _MAX_ ) ? lanes[ 1 ] > m : lanes[ 1 ] < m )
+        {
+            m = lanes[ 1 ];
+        }
+    }
+    
+    #endif
+    
+    for( ; i < count; i++ )
+    {
+        if( ( _MAX_ ) ? values[ i ] > m : values[ i ] < m )
+        {
+            m = values[ i ];
+        }
+    }
+    
+    return m;
+}
+
+namespace CF
+{
+    double Packed::Sum( const double * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __SumDoubles( values, count );
+    }
+    
+    SInt64 Packed::Sum( const SInt64 * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __SumInt64( values, count );
+    }
+    
+    double Packed::Sum( const std::vector< double > & values )
+    {
+        return Sum( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    SInt64 Packed::Sum( const std::vector< SInt64 > & values )
+    {
+        return Sum( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    double Packed::Min( const double * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __MinMaxDoubles< false >( values, count );
+    }
+    
+    SInt64 Packed::Min( const SInt64 * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __MinMaxInt64< false >( values, count );
+    }
+    
+    double Packed::Min( const std::vector< double > & values )
+    {
+        return Min( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    SInt64 Packed::Min( const std::vector< SInt64 > & values )
+    {
+        return Min( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    double Packed::Max( const double * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __MinMaxDoubles< true >( values, count );
+    }
+    
+    SInt64 Packed::Max( const SInt64 * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __MinMaxInt64< true >( values, count );
+    }
+    
+    double Packed::Max( const std::vector< double > & values )
+    {
+        return Max( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    SInt64 Packed::Max( const std::vector< SInt64 > & values )
+    {
+        return Max( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    double Packed::Mean( const double * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __SumDoubles( values, count ) / static_cast< double >( count );
+    }
+    
+    double Packed::Mean( const SInt64 * values, CFIndex count )
+    {
+        if( values == nullptr || count <= 0 )
+        {
+            return 0;
+        }
+        
+        return __SumInt64Exact( values, count ) / static_cast< double >( count );
+    }
+    
+    double Packed::Mean( const std::vector< double > & values )
+    {
+        return Mean( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+    
+    double Packed::Mean( const std::vector< SInt64 > & values )
+    {
+        return Mean( values.data(), static_cast< CFIndex >( values.size() ) );
+    }
+}
@@ -0,0 +1,272 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-Parallel.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ parallel algorithms over arrays
+ */
+
+#include <CF++.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+struct __Job
+{
+    const std::function< void( CFIndex, CFIndex ) > * work;
+    CFIndex                                           count;
+    CFIndex                                           size;
+    CFIndex                                           chunks;
+    std::atomic< CFIndex >                            next;
+    std::atomic< CFIndex >                            done;
+    std::mutex                                        lock;
+    std::condition_variable                           finished;
+};
+
+struct __Pool
+{
+    std::mutex                             lock;
+    std::condition_variable                available;
+    std::deque< std::shared_ptr< __Job > > jobs;
+    size_t                                 threads;
+};
+
+static thread_local bool __inParallel = false;
+
+static void __RunChunks( __Job & job );
+static void __RunChunks( __Job & job )
+{
+    CFIndex chunk;
+    CFIndex begin;
+    
+    while( ( chunk = job.next++ ) < job.chunks )
+    {
+        begin = chunk * job.size;
+        
+        ( *( job.work ) )( begin, std::min( begin + job.size, job.count ) );
+        
+        if( ++job.done == job.chunks )
+        {
+            std::lock_guard< std::mutex > l( job.lock );
+            
+            job.finished.notify_all();
+        }
+    }
+}
+
+static void __Worker( __Pool * pool );
+static void __Worker( __Pool * pool )
+{
+    std::shared_ptr< __Job > job;
+    
+    __inParallel = true;
+    
+    while( true )
+    {
+        {
+            std::unique_lock< std::mutex > l( pool->lock );
+            
+            pool->available.wait( l, [ & ] { return pool->jobs.empty() == false; } );
+            
+            job = std::move( pool->jobs.front() );
+            
+            pool->jobs.pop_front();
+        }
+        
+        __RunChunks( *( job ) );
+        
+        job = nullptr;
+    }
+}
+
+static __Pool & __GetPool();
+static __Pool & __GetPool()
+{
+    /* Never destroyed: workers stay blocked on the queue until exit */
+    static __Pool * pool = []
+    {
+        __Pool * p = new __Pool();
+        unsigned n = std::thread::hardware_concurrency();
+        
+        p->threads = ( n > 1 ) ? n - 1 : 0;
+        
+        for( size_t i = 0; i < p->threads; i++ )
+        {
+            std::thread( __Worker, p ).detach();
+        }
+        
+        return p;
+    }
+    ();
+    
+    return *( pool );
+}
+
+namespace CF
+{
+    void Parallel::Run( CFIndex count, const std::function< void( CFIndex, CFIndex ) > & work, CFIndex grain )
+    {
+        std::shared_ptr< __Job > job;
+        size_t                   helpers;
+        
+        if( count <= 0 )
+        {
+            return;
+        }
+        
+        grain = std::max< CFIndex >( grain, 1 );
+        
+        if( count <= grain || __inParallel )
+        {
+            work( 0, count );
+            
+            return;
+        }
+        
+        __Pool & pool = __GetPool();
+        
+        if( pool.threads == 0 )
+        {
+            work( 0, count );
+            
+            return;
+        }
+        
+        /* A few chunks per thread, so uneven chunks balance out */
+        job         = std::make_shared< __Job >();
+        job->work   = &work;
+        job->count  = count;
+        job->size   = std::max< CFIndex >( grain, count / static_cast< CFIndex >( ( pool.threads + 1 ) * 4 ) );
+        job->chunks = ( count + job->size - 1 ) / job->size;
+        job->next   = 0;
+        job->done   = 0;
+        helpers     = std::min( pool.threads, static_cast< size_t >( job->chunks - 1 ) );
+        
+        {
+            std::lock_guard< std::mutex > l( pool.lock );
+            
+            for( size_t i = 0; i < helpers; i++ )
+            {
+                pool.jobs.push_back( job );
+            }
+        }
+        
+        pool.available.notify_all();
+        
+        __inParallel = true;
+        
+        __RunChunks( *( job ) );
+        
+        __inParallel = false;
+        
+        {
+            std::unique_lock< std::mutex > l( job->lock );
+            
+            job->finished.wait( l, [ & ] { return job->done == job->chunks; } );
+        }
+    }
+    
+    void Parallel::Sort( Array & array, CFComparatorFunction comparator, void * context )
+    {
+        std::vector< CFTypeRef >                     values;
+        std::vector< std::pair< CFIndex, CFIndex > > ranges;
+        std::mutex                                   lock;
+        CFIndex                                      count;
+        
+        count = array.GetCount();
+        
+        if( comparator == nullptr || count < 2 )
+        {
+            return;
+        }
+        
+        values.resize( static_cast< size_t >( count ) );
+        
+        CFArrayGetValues( static_cast< CFArrayRef >( array.GetCFObject() ), CFRangeMake( 0, count ), values.data() );
+        
+        auto less = [ & ]( CFTypeRef v1, CFTypeRef v2 )
+        {
+            return comparator( v1, v2, context ) == kCFCompareLessThan;
+        };
+        
+        Run
+        (
+            count,
+            [ & ]( CFIndex begin, CFIndex end )
+            {
+                std::stable_sort( values.begin() + begin, values.begin() + end, less );
+                
+                {
+                    std::lock_guard< std::mutex > l( lock );
+                    
+                    ranges.emplace_back( begin, end );
+                }
+            }
+        );
+        
+        std::sort( ranges.begin(), ranges.end() );
+        
+        /* Merges adjacent sorted ranges, halving their number on each pass */
+        while( ranges.size() > 1 )
+        {
+            std::vector< std::pair< CFIndex, CFIndex > > merged( ( ranges.size() + 1 ) / 2 );
+            
+            Run
+            (
+                static_cast< CFIndex >( merged.size() ),
+                [ & ]( CFIndex begin, CFIndex end )
+                {
+                    for( CFIndex i = begin; i < end; i++ )
+                    {
+                        size_t r = static_cast< size_t >( i ) * 2;
+                        
+                        if( r + 1 < ranges.size() )
+                        {
+                            std::inplace_merge
+                            (
+                                values.begin() + ranges[ r ].first,
+                                values.begin() + ranges[ r ].second,
+                                values.begin() + ranges[ r + 1 ].second,
+                                less
+                            );
+                            
+                            merged[ static_cast< size_t >( i ) ] = { ranges[ r ].first, ranges[ r + 1 ].second };
+                        }
+                        else
+                        {
+                            merged[ static_cast< size_t >( i ) ] = ranges[ r ];
+                        }
+                    }
+                },
+                1
+            );
+            
+            ranges = std::move( merged );
+        }
+        
+        array = Array::CopyValues( values );
+    }
+}
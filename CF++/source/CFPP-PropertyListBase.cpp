@@ -89,4 +89,56 @@ namespace CF
         
         return data.As< CFDataRef >();
     }
+    
+    Data PropertyListBase::ReadPropertyListFile( const std::string & path, bool map )
+    {
+        Data       data;
+        ReadStream stream;
+        
+        if( path.length() == 0 )
+        {
+            return static_cast< CFDataRef >( nullptr );
+        }
+        
+        /* Decompressed as it is read, the compressed bytes are never held or mapped */
+        if( path.length() > 3 && path.compare( path.length() - 3, 3, ".gz" ) == 0 )
+        {
+            if( stream.Open( URL::FileSystemURL( path ) ) == false )
+            {
+                return static_cast< CFDataRef >( nullptr );
+            }
+            
+            data = InflateStream( stream, Data::CompressionGzip ).Read();
+            
+            stream.Close();
+            
+            return data;
+        }
+        
+        if( map )
+        {
+            data = Data::MapFile( path, Data::AccessSequential );
+        }
+        
+        /* Not requested, or not a regular file: read it through a stream */
+        if( map == false || data.IsValid() == false )
+        {
+            if( stream.Open( URL::FileSystemURL( path ) ) == false )
+            {
+                return static_cast< CFDataRef >( nullptr );
+            }
+            
+            data = stream.Read();
+            
+            stream.Close();
+        }
+        
+        /* gzip header, without the .gz extension */
+        if( data.GetLength() > 2 && data[ 0 ] == 0x1F && data[ 1 ] == 0x8B )
+        {
+            data = data.Decompress( Data::CompressionGzip );
+        }
+        
+        return data;
+    }
 }
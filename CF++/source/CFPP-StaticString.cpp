@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-StaticString.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ immortal string keys
+ */
+
+#include <CF++.hpp>
+
+namespace CF
+{
+    StaticString::StaticString( const StaticString & value ):
+        _value( value._value ),
+        _length( value._length ),
+        _cfObject( value._cfObject.load( std::memory_order_acquire ) )
+    {}
+    
+    StaticString & StaticString::operator =( const StaticString & value )
+    {
+        this->_value  = value._value;
+        this->_length = value._length;
+        
+        this->_cfObject.store( value._cfObject.load( std::memory_order_acquire ), std::memory_order_release );
+        
+        return *( this );
+    }
+    
+    StaticString::operator CFStringRef () const
+    {
+        return this->GetCFObject();
+    }
+    
+    CFStringRef StaticString::GetCFObject() const
+    {
+        CFStringRef s;
+        
+        s = this->_cfObject.load( std::memory_order_acquire );
+        
+        if( s == nullptr )
+        {
+            /* Racing threads get the same interned string */
+            s = String::Intern( this->GetStringView() );
+            
+            this->_cfObject.store( s, std::memory_order_release );
+        }
+        
+        return s;
+    }
+    
+    std::string_view StaticString::GetStringView() const
+    {
+        return std::string_view( this->_value, this->_length );
+    }
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-String-CharacterView.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    UTF-16 indexed access for CF::String
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+
+namespace CF
+{
+    String::CharacterView::CharacterView():
+        _cfObject( nullptr )
+    {
+        memset( &( this->_buffer ), 0, sizeof( this->_buffer ) );
+    }
+    
+    String::CharacterView::CharacterView( const String & string ):
+        _cfObject( static_cast< CFStringRef >( string.GetCFObject() ) )
+    {
+        memset( &( this->_buffer ), 0, sizeof( this->_buffer ) );
+        
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+            CFStringInitInlineBuffer( this->_cfObject, &( this->_buffer ), CFRangeMake( 0, CFStringGetLength( this->_cfObject ) ) );
+        }
+    }
+    
+    String::CharacterView::CharacterView( const CharacterView & value ):
+        _cfObject( value._cfObject ),
+        _buffer( value._buffer )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    String::CharacterView::CharacterView( CharacterView && value ) noexcept:
+        _cfObject( value._cfObject ),
+        _buffer( value._buffer )
+    {
+        value._cfObject = nullptr;
+        
+        memset( &( value._buffer ), 0, sizeof( value._buffer ) );
+    }
+    
+    String::CharacterView::~CharacterView()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+        }
+    }
+    
+    String::CharacterView & String::CharacterView::operator =( CharacterView value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    UniChar String::CharacterView::operator [] ( CFIndex index ) const
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return 0;
+        }
+        
+        return CFStringGetCharacterFromInlineBuffer( &( this->_buffer ), index );
+    }
+    
+    CFIndex String::CharacterView::GetLength() const
+    {
+        return this->_buffer.rangeToBuffer.length;
+    }
+    
+    const UniChar * String::CharacterView::GetCharactersPtr() const
+    {
+        return this->_buffer.directUniCharBuffer;
+    }
+    
+    void swap( String::CharacterView & v1, String::CharacterView & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._cfObject, v2._cfObject );
+        swap( v1._buffer,   v2._buffer );
+    }
+}
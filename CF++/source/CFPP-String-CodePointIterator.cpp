@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-String-CodePointIterator.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Code point iterator for CF::String
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+
+namespace CF
+{
+    String::CodePointIterator::CodePointIterator():
+        _cfObject( nullptr ),
+        _length( 0 ),
+        _pos( 0 ),
+        _next( 0 ),
+        _value( 0 )
+    {
+        memset( &( this->_buffer ), 0, sizeof( this->_buffer ) );
+    }
+    
+    String::CodePointIterator::CodePointIterator( const CodePointIterator & value ):
+        _cfObject( value._cfObject ),
+        _length( value._length ),
+        _pos( value._pos ),
+        _next( value._next ),
+        _value( value._value ),
+        _buffer( value._buffer )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    String::CodePointIterator::CodePointIterator( CodePointIterator && value ) noexcept:
+        _cfObject( value._cfObject ),
+        _length( value._length ),
+        _pos( value._pos ),
+        _next( value._next ),
+        _value( value._value ),
+        _buffer( value._buffer )
+    {
+        value._cfObject = nullptr;
+        value._length   = 0;
+        value._pos      = 0;
+        value._next     = 0;
+        value._value    = 0;
+        
+        memset( &( value._buffer ), 0, sizeof( value._buffer ) );
+    }
+    
+    String::CodePointIterator::CodePointIterator( CFStringRef string, CFIndex pos ):
+        _cfObject( string ),
+        _length( 0 ),
+        _pos( pos ),
+        _next( pos ),
+        _value( 0 )
+    {
+        memset( &( this->_buffer ), 0, sizeof( this->_buffer ) );
+        
+        if( this->_cfObject == nullptr )
+        {
+            this->_pos  = 0;
+            this->_next = 0;
+            
+            return;
+        }
+        
+        CFRetain( this->_cfObject );
+        
+        this->_length = CFStringGetLength( this->_cfObject );
+        
+        if( this->_pos >= this->_length )
+        {
+            this->_pos  = this->_length;
+            this->_next = this->_length;
+            
+            return;
+        }
+        
+        CFStringInitInlineBuffer( this->_cfObject, &( this->_buffer ), CFRangeMake( 0, this->_length ) );
+        this->Decode();
+    }
+    
+    String::CodePointIterator::~CodePointIterator()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+        }
+    }
+    
+    String::CodePointIterator & String::CodePointIterator::operator =( CodePointIterator value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    String::CodePointIterator & String::CodePointIterator::operator ++()
+    {
+        if( this->_pos < this->_length )
+        {
+            this->_pos = this->_next;
+            
+            this->Decode();
+        }
+        
+        return *( this );
+    }
+    
+    String::CodePointIterator String::CodePointIterator::operator ++( int )
+    {
+        CodePointIterator it( *( this ) );
+        
+        operator++();
+        
+        return it;
+    }
+    
+    bool String::CodePointIterator::operator == ( const CodePointIterator & value ) const
+    {
+        if( this->_cfObject != value._cfObject )
+        {
+            return false;
+        }
+        
+        if( this->_pos != value._pos )
+        {
+            return false;
+        }
+        
+        return true;
+    }
+    
+    bool String::CodePointIterator::operator != ( const CodePointIterator & value ) const
+    {
+        return !( *( this ) == value );
+    }
+    
+    UTF32Char String::CodePointIterator::operator *() const
+    {
+        return this->_value;
+    }
+    
+    CFIndex String::CodePointIterator::GetIndex() const
+    {
+        return this->_pos;
+    }
+    
+    void String::CodePointIterator::Decode()
+    {
+        UniChar c;
+        UniChar low;
+        
+        if( this->_pos >= this->_length )
+        {
+            this->_next  = this->_length;
+            this->_value = 0;
+            
+            return;
+        }
+        
+        c           = CFStringGetCharacterFromInlineBuffer( &( this->_buffer ), this->_pos );
+        this->_next = this->_pos + 1;
+        
+        if( CFStringIsSurrogateHighCharacter( c ) )
+        {
+            low = CFStringGetCharacterFromInlineBuffer( &( this->_buffer ), this->_next );
+            
+            if( this->_next < this->_length && CFStringIsSurrogateLowCharacter( low ) )
+            {
+                this->_value = CFStringGetLongCharacterForSurrogatePair( c, low );
+                this->_next++;
+            }
+            else
+            {
+                this->_value = 0xFFFD;
+            }
+        }
+        else if( CFStringIsSurrogateLowCharacter( c ) )
+        {
+            this->_value = 0xFFFD;
+        }
+        else
+        {
+            this->_value = c;
+        }
+    }
+    
+    void swap( String::CodePointIterator & v1, String::CodePointIterator & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._cfObject, v2._cfObject );
+        swap( v1._length,   v2._length );
+        swap( v1._pos,      v2._pos );
+        swap( v1._next,     v2._next );
+        swap( v1._value,    v2._value );
+        swap( v1._buffer,   v2._buffer );
+    }
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-String-CodePointView.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Code point range for CF::String
+ */
+
+#include <CF++.hpp>
+
+namespace CF
+{
+    String::CodePointView::CodePointView():
+        _cfObject( nullptr )
+    {}
+    
+    String::CodePointView::CodePointView( const String & string ):
+        _cfObject( static_cast< CFStringRef >( string.GetCFObject() ) )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    String::CodePointView::CodePointView( const CodePointView & value ):
+        _cfObject( value._cfObject )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    String::CodePointView::CodePointView( CodePointView && value ) noexcept:
+        _cfObject( value._cfObject )
+    {
+        value._cfObject = nullptr;
+    }
+    
+    String::CodePointView::~CodePointView()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+        }
+    }
+    
+    String::CodePointView & String::CodePointView::operator =( CodePointView value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    String::CodePointIterator String::CodePointView::begin() const
+    {
+        return CodePointIterator( this->_cfObject, 0 );
+    }
+    
+    String::CodePointIterator String::CodePointView::end() const
+    {
+        return CodePointIterator( this->_cfObject, ( this->_cfObject == nullptr ) ? 0 : CFStringGetLength( this->_cfObject ) );
+    }
+    
+    void swap( String::CodePointView & v1, String::CodePointView & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._cfObject, v2._cfObject );
+    }
+}
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-String-Encoder.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Incremental encoder for CF::String
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+
+static CFIndex __GetBOM( CFStringEncoding encoding, UInt8 * bom );
+static CFIndex __GetBOM( CFStringEncoding encoding, UInt8 * bom )
+{
+    bool little;
+    
+    little = CFByteOrderGetCurrent() == CFByteOrderLittleEndian;
+    
+    switch( encoding )
+    {
+        case kCFStringEncodingUTF8:
+            
+            bom[ 0 ] = 0xEF;
+            bom[ 1 ] = 0xBB;
+            bom[ 2 ] = 0xBF;
+            
+            return 3;
+            
+        case kCFStringEncodingUTF16:
+        case kCFStringEncodingUTF16BE:
+        case kCFStringEncodingUTF16LE:
+            
+            if( encoding == kCFStringEncodingUTF16LE || ( encoding == kCFStringEncodingUTF16 && little ) )
+            {
+                bom[ 0 ] = 0xFF;
+                bom[ 1 ] = 0xFE;
+            }
+            else
+            {
+                bom[ 0 ] = 0xFE;
+                bom[ 1 ] = 0xFF;
+            }
+            
+            return 2;
+            
+        case kCFStringEncodingUTF32:
+        case kCFStringEncodingUTF32BE:
+        case kCFStringEncodingUTF32LE:
+            
+            if( encoding == kCFStringEncodingUTF32LE || ( encoding == kCFStringEncodingUTF32 && little ) )
+            {
+                bom[ 0 ] = 0xFF;
+                bom[ 1 ] = 0xFE;
+                bom[ 2 ] = 0x00;
+                bom[ 3 ] = 0x00;
+            }
+            else
+            {
+                bom[ 0 ] = 0x00;
+                bom[ 1 ] = 0x00;
+                bom[ 2 ] = 0xFE;
+                bom[ 3 ] = 0xFF;
+            }
+            
+            return 4;
+            
+        default:
+            
+            return 0;
+    }
+}
+
+namespace CF
+{
+    String::Encoder::Encoder():
+        _cfObject( nullptr ),
+        _encoding( kCFStringEncodingUTF8 ),
+        _lossByte( 0 ),
+        _bom( false ),
+        _failed( false ),
+        _location( 0 ),
+        _length( 0 )
+    {}
+    
+    String::Encoder::Encoder( const String & string, CFStringEncoding encoding, UInt8 lossByte, bool includeBOM ):
+        _cfObject( static_cast< CFStringRef >( string.GetCFObject() ) ),
+        _encoding( encoding ),
+        _lossByte( lossByte ),
+        _bom( includeBOM ),
+        _failed( false ),
+        _location( 0 ),
+        _length( 0 )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+            
+            this->_length = CFStringGetLength( this->_cfObject );
+        }
+    }
+    
+    String::Encoder::Encoder( const Encoder & value ):
+        _cfObject( value._cfObject ),
+        _encoding( value._encoding ),
+        _lossByte( value._lossByte ),
+        _bom( value._bom ),
+        _failed( value._failed ),
+        _location( value._location ),
+        _length( value._length )
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRetain( this->_cfObject );
+        }
+    }
+    
+    String::Encoder::Encoder( Encoder && value ) noexcept:
+        _cfObject( value._cfObject ),
+        _encoding( value._encoding ),
+        _lossByte( value._lossByte ),
+        _bom( value._bom ),
+        _failed( value._failed ),
+        _location( value._location ),
+        _length( value._length )
+    {
+        value._cfObject = nullptr;
+        value._bom      = false;
+        value._failed   = false;
+        value._location = 0;
+        value._length   = 0;
+    }
+    
+    String::Encoder::~Encoder()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+        }
+    }
+    
+    String::Encoder & String::Encoder::operator =( Encoder value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    CFIndex String::Encoder::Read( UInt8 * buffer, CFIndex length )
+    {
+        UInt8   bom[ 4 ];
+        CFIndex written;
+        CFIndex count;
+        CFIndex used;
+        
+        if( buffer == nullptr || length <= 0 || this->_failed )
+        {
+            return 0;
+        }
+        
+        written = 0;
+        
+        if( this->_bom )
+        {
+            written = __GetBOM( this->_encoding, bom );
+            
+            if( written > length )
+            {
+                return 0;
+            }
+            
+            memcpy( buffer, bom, static_cast< std::size_t >( written ) );
+            
+            this->_bom = false;
+        }
+        
+        if( this->_location >= this->_length )
+        {
+            return written;
+        }
+        
+        used  = 0;
+        count = CFStringGetBytes
+        (
+            this->_cfObject,
+            CFRangeMake( this->_location, this->_length - this->_location ),
+            this->_encoding,
+            this->_lossByte,
+            false,
+            buffer + written,
+            length - written,
+            &used
+        );
+        
+        if( count == 0 && written == 0 )
+        {
+            /* Either the buffer cannot hold the next character, or it cannot be converted */
+            if( CFStringGetBytes( this->_cfObject, CFRangeMake( this->_location, std::min( static_cast< CFIndex >( 2 ), this->_length - this->_location ) ), this->_encoding, this->_lossByte, false, nullptr, 0, nullptr ) == 0 )
+            {
+                this->_failed = true;
+            }
+        }
+        
+        this->_location += count;
+        
+        return written + used;
+    }
+    
+    bool String::Encoder::IsAtEnd() const
+    {
+        return this->_bom == false && this->_location >= this->_length;
+    }
+    
+    bool String::Encoder::HasFailed() const
+    {
+        return this->_failed;
+    }
+    
+    CFIndex String::Encoder::GetLocation() const
+    {
+        return this->_location;
+    }
+    
+    void swap( String::Encoder & v1, String::Encoder & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._cfObject, v2._cfObject );
+        swap( v1._encoding, v2._encoding );
+        swap( v1._lossByte, v2._lossByte );
+        swap( v1._bom,      v2._bom );
+        swap( v1._failed,   v2._failed );
+        swap( v1._location, v2._location );
+        swap( v1._length,   v2._length );
+    }
+}
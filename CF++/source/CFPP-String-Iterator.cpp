@@ -29,63 +29,120 @@
  */
 
 #include <CF++.hpp>
+#include <cstring>
+
+static CFIndex __GetEncodingWidth( CFStringEncoding encoding );
+static CFIndex __GetEncodingWidth( CFStringEncoding encoding )
+{
+    switch( encoding )
+    {
+        case kCFStringEncodingASCII:
+        case kCFStringEncodingMacRoman:
+        case kCFStringEncodingWindowsLatin1:
+        case kCFStringEncodingISOLatin1:
+        case kCFStringEncodingNextStepLatin:
+            
+            return 1;
+            
+        case kCFStringEncodingUTF16:
+        case kCFStringEncodingUTF16BE:
+        case kCFStringEncodingUTF16LE:
+            
+            return 2;
+            
+        default:
+            
+            return 0;
+    }
+}
 
 namespace CF
 {
     String::Iterator::Iterator():
         _cfObject( nullptr ),
-        _length( 0 ),
+        _encoding( kCFStringEncodingUTF8 ),
+        _characters( 0 ),
+        _width( 0 ),
+        _cp( nullptr ),
         _pos( 0 ),
-        _cp( nullptr )
-    {}
+        _end( false ),
+        _chunkStart( 0 ),
+        _chunkLength( 0 ),
+        _chunkSource( 0 ),
+        _chunkCharacters( 0 )
+    {
+        memset( this->_chunk, 0, sizeof( this->_chunk ) );
+    }
     
     String::Iterator::Iterator( const Iterator & value ):
         _cfObject( value._cfObject ),
-        _length( value._length ),
+        _encoding( value._encoding ),
+        _characters( value._characters ),
+        _width( value._width ),
+        _cp( value._cp ),
         _pos( value._pos ),
-        _cp( value._cp )
+        _end( value._end ),
+        _chunkStart( value._chunkStart ),
+        _chunkLength( value._chunkLength ),
+        _chunkSource( value._chunkSource ),
+        _chunkCharacters( value._chunkCharacters )
     {
+        memcpy( this->_chunk, value._chunk, sizeof( this->_chunk ) );
+        
         if( this->_cfObject != nullptr )
         {
             CFRetain( this->_cfObject );
         }
     }
     
-    String::Iterator::Iterator( CFStringRef string, CFStringEncoding encoding, CFIndex length, CFIndex pos ):
+    String::Iterator::Iterator( CFStringRef string, CFStringEncoding encoding, bool end ):
         _cfObject( string ),
-        _length( length ),
-        _pos( pos ),
-        _cp( nullptr )
+        _encoding( encoding ),
+        _characters( 0 ),
+        _width( __GetEncodingWidth( encoding ) ),
+        _cp( nullptr ),
+        _pos( 0 ),
+        _end( end ),
+        _chunkStart( 0 ),
+        _chunkLength( 0 ),
+        _chunkSource( 0 ),
+        _chunkCharacters( 0 )
     {
+        memset( this->_chunk, 0, sizeof( this->_chunk ) );
+        
         if( this->_cfObject != nullptr )
         {
             CFRetain( this->_cfObject );
             
-            {
-                std::size_t size;
-                
-                size      = static_cast< std::size_t >( CFStringGetMaximumSizeForEncoding( CFStringGetLength( this->_cfObject ), encoding ) );
-                this->_cp = std::shared_ptr< char >( new char[ size + 1 ] );
-                
-                if( this->_cp != nullptr )
-                {
-                    memset( this->_cp.get(), 0, size + 1 );
-                    CFStringGetCString( this->_cfObject, this->_cp.get(), static_cast< CFIndex >( length + 1 ), encoding );
-                }
-            }
+            this->_characters = CFStringGetLength( this->_cfObject );
+            this->_cp         = CFStringGetCStringPtr( this->_cfObject, encoding );
         }
     }
     
-    String::Iterator::Iterator( Iterator && value ) noexcept
+    String::Iterator::Iterator( Iterator && value ) noexcept:
+        _cfObject( value._cfObject ),
+        _encoding( value._encoding ),
+        _characters( value._characters ),
+        _width( value._width ),
+        _cp( value._cp ),
+        _pos( value._pos ),
+        _end( value._end ),
+        _chunkStart( value._chunkStart ),
+        _chunkLength( value._chunkLength ),
+        _chunkSource( value._chunkSource ),
+        _chunkCharacters( value._chunkCharacters )
     {
-        this->_cfObject = value._cfObject;
-        value._cfObject = nullptr;
-        this->_length   = value._length;
-        value._length   = 0;
-        this->_pos      = value._pos;
-        value._pos      = 0;
-        this->_cp       = value._cp;
-        value._cp       = nullptr;
+        memcpy( this->_chunk, value._chunk, sizeof( this->_chunk ) );
+        
+        value._cfObject        = nullptr;
+        value._characters      = 0;
+        value._cp              = nullptr;
+        value._pos             = 0;
+        value._end             = false;
+        value._chunkStart      = 0;
+        value._chunkLength     = 0;
+        value._chunkSource     = 0;
+        value._chunkCharacters = 0;
     }
     
     String::Iterator::~Iterator()
@@ -105,6 +162,11 @@ namespace CF
     
     String::Iterator & String::Iterator::operator ++()
     {
+        if( this->_cfObject == nullptr || this->_end )
+        {
+            return *( this );
+        }
+        
         this->_pos++;
         
         return *( this );
@@ -121,6 +183,13 @@ namespace CF
     
     String::Iterator & String::Iterator::operator --()
     {
+        if( this->_cfObject == nullptr )
+        {
+            return *( this );
+        }
+        
+        this->Resolve();
+        
         this->_pos--;
         
         return *( this );
@@ -137,6 +206,13 @@ namespace CF
     
     String::Iterator & String::Iterator::operator += ( CFIndex value )
     {
+        if( this->_cfObject == nullptr || value == 0 )
+        {
+            return *( this );
+        }
+        
+        this->Resolve();
+        
         this->_pos += value;
         
         return *( this );
@@ -144,12 +220,10 @@ namespace CF
     
     String::Iterator & String::Iterator::operator -= ( CFIndex value )
     {
-        this->_pos -= value;
-        
-        return *( this );
+        return operator +=( -value );
     }
     
-    String::Iterator String::Iterator::operator +( CFIndex value )
+    String::Iterator String::Iterator::operator +( CFIndex value ) const
     {
         Iterator i;
         
@@ -158,7 +232,7 @@ namespace CF
         return i += value;
     }
     
-    String::Iterator String::Iterator::operator -( CFIndex value )
+    String::Iterator String::Iterator::operator -( CFIndex value ) const
     {
         Iterator i;
         
@@ -167,6 +241,11 @@ namespace CF
         return i -= value;
     }
     
+    CFIndex String::Iterator::operator -( const Iterator & value ) const
+    {
+        return this->GetPosition() - value.GetPosition();
+    }
+    
     bool String::Iterator::operator == ( const Iterator & value ) const
     {
         if( this->_cfObject != value._cfObject )
@@ -174,17 +253,32 @@ namespace CF
             return false;
         }
         
-        if( this->_length != value._length )
+        if( this->_cfObject == nullptr )
         {
-            return false;
+            return true;
         }
         
-        if( this->_pos != value._pos )
+        if( this->_encoding != value._encoding )
         {
             return false;
         }
         
-        return true;
+        if( this->_end && value._end )
+        {
+            return true;
+        }
+        
+        if( this->_end )
+        {
+            return value.IsAtEnd();
+        }
+        
+        if( value._end )
+        {
+            return this->IsAtEnd();
+        }
+        
+        return this->_pos == value._pos;
     }
     
     bool String::Iterator::operator != ( const Iterator & value ) const
@@ -192,43 +286,285 @@ namespace CF
         return !( *( this ) == value );
     }
     
+    bool String::Iterator::operator < ( const Iterator & value ) const
+    {
+        return *( this ) - value < 0;
+    }
+    
+    bool String::Iterator::operator > ( const Iterator & value ) const
+    {
+        return *( this ) - value > 0;
+    }
+    
+    bool String::Iterator::operator <= ( const Iterator & value ) const
+    {
+        return *( this ) - value <= 0;
+    }
+    
+    bool String::Iterator::operator >= ( const Iterator & value ) const
+    {
+        return *( this ) - value >= 0;
+    }
+    
     char String::Iterator::operator *() const
     {
-        if( this->_cfObject == nullptr )
+        if( this->_cfObject == nullptr || this->_end )
         {
             return 0;
         }
         
-        if( this->_cp == nullptr )
+        return this->GetByte( this->_pos );
+    }
+    
+    char String::Iterator::operator []( CFIndex index ) const
+    {
+        if( this->_cfObject == nullptr )
         {
             return 0;
         }
         
+        return this->GetByte( this->GetPosition() + index );
+    }
+    
+    String::Iterator::operator char () const
+    {
+        return operator*();
+    }
+    
+    bool String::Iterator::IsAtEnd() const
+    {
+        if( this->_cfObject == nullptr || this->_end )
+        {
+            return true;
+        }
+        
         if( this->_pos < 0 )
+        {
+            return false;
+        }
+        
+        if( this->_cp != nullptr )
+        {
+            return this->_pos >= this->_characters;
+        }
+        
+        return this->Load( this->_pos ) == false;
+    }
+    
+    char String::Iterator::GetByte( CFIndex pos ) const
+    {
+        if( pos < 0 )
         {
             return 0;
         }
         
-        if( this->_pos >= this->_length )
+        if( this->_cp != nullptr )
+        {
+            return ( pos < this->_characters ) ? this->_cp[ pos ] : 0;
+        }
+        
+        if( this->Load( pos ) == false )
         {
             return 0;
         }
         
-        return this->_cp.get()[ this->_pos ];
+        return this->_chunk[ pos - this->_chunkStart ];
     }
     
-    String::Iterator::operator char () const
+    CFIndex String::Iterator::GetPosition() const
     {
-        return operator*();
+        return ( this->_end ) ? this->GetByteLength() : this->_pos;
+    }
+    
+    bool String::Iterator::Load( CFIndex pos ) const
+    {
+        CFIndex source;
+        CFIndex start;
+        CFIndex count;
+        CFIndex used;
+        
+        if( this->_cfObject == nullptr || pos < 0 )
+        {
+            return false;
+        }
+        
+        if( pos >= this->_chunkStart && pos < this->_chunkStart + this->_chunkLength )
+        {
+            return true;
+        }
+        
+        if( this->_width > 0 )
+        {
+            /* Fixed width: jump straight to the character, keeping some room behind when scanning backwards */
+            source = pos / this->_width;
+            
+            if( pos < this->_chunkStart )
+            {
+                source = std::max( static_cast< CFIndex >( 0 ), source - static_cast< CFIndex >( sizeof( this->_chunk ) ) / this->_width + 1 );
+            }
+            
+            start = source * this->_width;
+        }
+        else if( pos < this->_chunkStart && this->Rewind( pos ) )
+        {
+            /* Variable width: continue from a character boundary measured backwards */
+            source = this->_chunkSource;
+            start  = this->_chunkStart;
+        }
+        else if( pos < this->_chunkStart )
+        {
+            source = 0;
+            start  = 0;
+        }
+        else
+        {
+            source = this->_chunkSource + this->_chunkCharacters;
+            start  = this->_chunkStart  + this->_chunkLength;
+        }
+        
+        while( source < this->_characters )
+        {
+            used  = 0;
+            count = CFStringGetBytes
+            (
+                this->_cfObject,
+                CFRangeMake( source, this->_characters - source ),
+                this->_encoding,
+                0,
+                false,
+                reinterpret_cast< UInt8 * >( this->_chunk ),
+                static_cast< CFIndex >( sizeof( this->_chunk ) ),
+                &used
+            );
+            
+            if( count <= 0 || used <= 0 )
+            {
+                break;
+            }
+            
+            this->_chunkStart      = start;
+            this->_chunkLength     = used;
+            this->_chunkSource     = source;
+            this->_chunkCharacters = count;
+            
+            if( pos < start + used )
+            {
+                return true;
+            }
+            
+            source += count;
+            start  += used;
+        }
+        
+        return false;
+    }
+    
+    /*
+     * Moves the chunk origin back to a character boundary at or before pos,
+     * by measuring the bytes of the characters in between, so stepping
+     * backwards costs the distance rather than a rescan from the start.
+     */
+    bool String::Iterator::Rewind( CFIndex pos ) const
+    {
+        CFIndex source;
+        CFIndex start;
+        CFIndex count;
+        CFIndex used;
+        UniChar c;
+        
+        source = this->_chunkSource;
+        start  = this->_chunkStart;
+        count  = std::max( static_cast< CFIndex >( sizeof( this->_chunk ) / 4 ), start - pos );
+        
+        while( start > pos && source > 0 )
+        {
+            count = std::min( count, source );
+            c     = CFStringGetCharacterAtIndex( this->_cfObject, source - count );
+            
+            /* Never split a surrogate pair */
+            if( c >= 0xDC00 && c <= 0xDFFF && count < source )
+            {
+                count++;
+            }
+            
+            used = 0;
+            
+            if( CFStringGetBytes( this->_cfObject, CFRangeMake( source - count, count ), this->_encoding, 0, false, nullptr, 0, &used ) != count )
+            {
+                return false;
+            }
+            
+            source -= count;
+            start  -= used;
+            count  *= 2;
+        }
+        
+        if( start > pos )
+        {
+            return false;
+        }
+        
+        /* Empty chunk: the next conversion starts at this boundary */
+        this->_chunkSource     = source;
+        this->_chunkStart      = start;
+        this->_chunkLength     = 0;
+        this->_chunkCharacters = 0;
+        
+        return true;
+    }
+    
+    CFIndex String::Iterator::GetByteLength() const
+    {
+        CFIndex used;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return 0;
+        }
+        
+        if( this->_cp != nullptr )
+        {
+            return this->_characters;
+        }
+        
+        used = 0;
+        
+        CFStringGetBytes( this->_cfObject, CFRangeMake( 0, this->_characters ), this->_encoding, 0, false, nullptr, 0, &used );
+        
+        return used;
+    }
+    
+    void String::Iterator::Resolve()
+    {
+        if( this->_end == false )
+        {
+            return;
+        }
+        
+        this->_pos = this->GetByteLength();
+        this->_end = false;
+    }
+    
+    String::Iterator operator +( CFIndex value, const String::Iterator & it )
+    {
+        return it + value;
     }
     
     void swap( String::Iterator & v1, String::Iterator & v2 ) noexcept
     {
         using std::swap;
         
-        swap( v1._cfObject, v2._cfObject );
-        swap( v1._length,   v2._length );
-        swap( v1._pos,      v2._pos );
-        swap( v1._cp,       v2._cp );
+        swap( v1._cfObject,        v2._cfObject );
+        swap( v1._encoding,        v2._encoding );
+        swap( v1._characters,      v2._characters );
+        swap( v1._width,           v2._width );
+        swap( v1._cp,              v2._cp );
+        swap( v1._pos,             v2._pos );
+        swap( v1._end,             v2._end );
+        swap( v1._chunkStart,      v2._chunkStart );
+        swap( v1._chunkLength,     v2._chunkLength );
+        swap( v1._chunkSource,     v2._chunkSource );
+        swap( v1._chunkCharacters, v2._chunkCharacters );
+        swap( v1._chunk,           v2._chunk );
     }
 }
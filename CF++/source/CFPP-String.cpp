@@ -29,15 +29,487 @@
  */
 
 #include <CF++.hpp>
+#include <cstring>
+#include <deque>
+#include <mutex>
+
+#ifdef _WIN32
+
+#include <Windows.h>
+
+static bool           __hasCFAllocatorNull = false;
+static CFAllocatorRef __cfAllocatorNull    = nullptr;
+
+static void __loadCFAllocatorNull()
+{
+    HMODULE cfModule;
+
+    if( __hasCFAllocatorNull == true )
+    {
+        return;
+    }
+
+    cfModule = GetModuleHandle( L"CoreFoundation.dll" );
+
+    if( cfModule != nullptr )
+    {
+        __hasCFAllocatorNull = true;
+        __cfAllocatorNull    = *( ( CFAllocatorRef * )GetProcAddress( cfModule, "kCFAllocatorNull" ) );
+    }
+}
+
+#endif
+
+struct __KeyEntry
+{
+    std::string  key;
+    CFStringRef  string;
+    std::size_t  hash;
+};
+
+/* Open-addressed and at most half full, so every probe ends on an empty slot */
+struct __KeySlots
+{
+    explicit __KeySlots( std::size_t count ): mask( count - 1 ), slots( new std::atomic< const __KeyEntry * >[ count ] )
+    {
+        for( std::size_t i = 0; i < count; i++ )
+        {
+            this->slots[ i ].store( nullptr, std::memory_order_relaxed );
+        }
+    }
+    
+    std::size_t                                             mask;
+    std::unique_ptr< std::atomic< const __KeyEntry * >[] > slots;
+};
+
+/*
+ * Readers probe the current slots without locking. Writers serialize on
+ * the mutex, publish entries with release stores and replace the slots
+ * with a larger copy when they fill up. Replaced slots are kept alive,
+ * as readers may still be probing them.
+ */
+struct __KeyTable
+{
+    std::mutex                          lock;
+    std::deque< __KeyEntry >            entries;
+    std::deque< __KeySlots >            slots;
+    std::atomic< const __KeySlots * >   current;
+};
+
+static __KeyTable & __GetKeyTable();
+static __KeyTable & __GetKeyTable()
+{
+    /* Never destroyed, so interned strings outlive static destructors */
+    static __KeyTable * table = new __KeyTable();
+    
+    return *( table );
+}
+
+static const __KeyEntry * __FindKey( const __KeySlots * slots, std::string_view value, std::size_t hash );
+static const __KeyEntry * __FindKey( const __KeySlots * slots, std::string_view value, std::size_t hash )
+{
+    const __KeyEntry * entry;
+    std::size_t        i;
+    
+    if( slots == nullptr )
+    {
+        return nullptr;
+    }
+    
+    for( i = hash & slots->mask; ; i = ( i + 1 ) & slots->mask )
+    {
+        entry = slots->slots[ i ].load( std::memory_order_acquire );
+        
+        if( entry == nullptr )
+        {
+            return nullptr;
+        }
+        
+        if( entry->hash == hash && entry->key == value )
+        {
+            return entry;
+        }
+    }
+}
+
+static void __InsertKey( const __KeySlots * slots, const __KeyEntry * entry );
+static void __InsertKey( const __KeySlots * slots, const __KeyEntry * entry )
+{
+    std::size_t i;
+    
+    for( i = entry->hash & slots->mask; slots->slots[ i ].load( std::memory_order_relaxed ) != nullptr; i = ( i + 1 ) & slots->mask )
+    {}
+    
+    slots->slots[ i ].store( entry, std::memory_order_release );
+}
+
+static bool               __MatchUTF8( CFStringRef string, std::string_view value, bool prefix );
+static bool               __HasSuffixUTF8( CFStringRef string, std::string_view value );
+static UTF32Char          __DecodeUTF8( const unsigned char * & p, const unsigned char * end );
+static CFComparisonResult __CompareUTF8( CFStringRef string, std::string_view value );
+static bool               __LessUTF8( std::string_view v1, std::string_view v2 );
+static uint64_t           __HashBytes( uint64_t hash, const void * bytes, std::size_t length );
+static std::size_t        __FinalizeHash( uint64_t hash );
+
+static const uint64_t __fnvOffsetBasis = 14695981039346656037ULL;
+static const uint64_t __fnvPrime       = 1099511628211ULL;
+
+/* Largest per-thread GetStringView() buffer kept between calls */
+static const std::size_t __scratchLimit = 64 * 1024;
+
+/* Equality or prefix match against UTF-8 bytes, converting the string chunk by chunk */
+static bool __MatchUTF8( CFStringRef string, std::string_view value, bool prefix )
+{
+    const char * cp;
+    CFIndex      length;
+    CFIndex      pos;
+    CFIndex      count;
+    CFIndex      used;
+    std::size_t  offset;
+    std::size_t  n;
+    char         buffer[ 256 ];
+    
+    length = CFStringGetLength( string );
+    cp     = CFStringGetCStringPtr( string, kCFStringEncodingUTF8 );
+    
+    if( cp != nullptr )
+    {
+        if( value.length() > static_cast< std::size_t >( length ) || ( prefix == false && value.length() != static_cast< std::size_t >( length ) ) )
+        {
+            return false;
+        }
+        
+        if( memcmp( cp, value.data(), value.length() ) != 0 )
+        {
+            return false;
+        }
+        
+        return value.length() == static_cast< std::size_t >( length ) || ( cp[ value.length() ] & 0xC0 ) != 0x80;
+    }
+    
+    /* A UTF-16 code unit takes between 1 and 3 UTF-8 bytes */
+    if( value.length() > static_cast< std::size_t >( length ) * 3 || ( prefix == false && value.length() < static_cast< std::size_t >( length ) ) )
+    {
+        return false;
+    }
+    
+    pos    = 0;
+    offset = 0;
+    
+    while( pos < length )
+    {
+        used  = 0;
+        count = CFStringGetBytes( string, CFRangeMake( pos, length - pos ), kCFStringEncodingUTF8, 0, false, reinterpret_cast< UInt8 * >( buffer ), sizeof( buffer ), &used );
+        
+        if( count <= 0 )
+        {
+            return false;
+        }
+        
+        n = std::min( static_cast< std::size_t >( used ), value.length() - offset );
+        
+        if( memcmp( buffer, value.data() + offset, n ) != 0 )
+        {
+            return false;
+        }
+        
+        offset += n;
+        pos    += count;
+        
+        if( offset == value.length() )
+        {
+            if( prefix == false )
+            {
+                return n == static_cast< std::size_t >( used ) && pos == length;
+            }
+            
+            return n == static_cast< std::size_t >( used ) || ( buffer[ n ] & 0xC0 ) != 0x80;
+        }
+    }
+    
+    return offset == value.length();
+}
+
+/* Suffix match against UTF-8 bytes, only converting the tail of the string */
+static bool __HasSuffixUTF8( CFStringRef string, std::string_view value )
+{
+    const char * cp;
+    CFIndex      length;
+    CFIndex      start;
+    CFIndex      pos;
+    CFIndex      count;
+    CFIndex      used;
+    CFIndex      total;
+    std::size_t  skip;
+    std::size_t  offset;
+    std::size_t  compared;
+    std::size_t  from;
+    char         buffer[ 256 ];
+    
+    if( value.length() == 0 || ( value[ 0 ] & 0xC0 ) == 0x80 )
+    {
+        return false;
+    }
+    
+    length = CFStringGetLength( string );
+    cp     = CFStringGetCStringPtr( string, kCFStringEncodingUTF8 );
+    
+    if( cp != nullptr )
+    {
+        if( value.length() > static_cast< std::size_t >( length ) )
+        {
+            return false;
+        }
+        
+        return memcmp( cp + ( static_cast< std::size_t >( length ) - value.length() ), value.data(), value.length() ) == 0;
+    }
+    
+    /* N UTF-8 bytes never span more than N UTF-16 code units */
+    start = length - std::min( length, static_cast< CFIndex >( value.length() ) );
+    
+    if( start > 0 && CFStringIsSurrogateLowCharacter( CFStringGetCharacterAtIndex( string, start ) ) )
+    {
+        start--;
+    }
+    
+    total = 0;
+    
+    CFStringGetBytes( string, CFRangeMake( start, length - start ), kCFStringEncodingUTF8, 0, false, nullptr, 0, &total );
+    
+    if( static_cast< std::size_t >( total ) < value.length() )
+    {
+        return false;
+    }
+    
+    skip     = static_cast< std::size_t >( total ) - value.length();
+    offset   = 0;
+    compared = 0;
+    pos      = start;
+    
+    while( pos < length )
+    {
+        used  = 0;
+        count = CFStringGetBytes( string, CFRangeMake( pos, length - pos ), kCFStringEncodingUTF8, 0, false, reinterpret_cast< UInt8 * >( buffer ), sizeof( buffer ), &used );
+        
+        if( count <= 0 )
+        {
+            return false;
+        }
+        
+        if( offset + static_cast< std::size_t >( used ) > skip )
+        {
+            from = ( skip > offset ) ? skip - offset : 0;
+            
+            if( memcmp( buffer + from, value.data() + compared, static_cast< std::size_t >( used ) - from ) != 0 )
+            {
+                return false;
+            }
+            
+            compared += static_cast< std::size_t >( used ) - from;
+        }
+        
+        offset += static_cast< std::size_t >( used );
+        pos    += count;
+    }
+    
+    return compared == value.length();
+}
+
+/* Decodes one code point, invalid sequences yield U+FFFD */
+static UTF32Char __DecodeUTF8( const unsigned char * & p, const unsigned char * end )
+{
+    UTF32Char   c;
+    UTF32Char   min;
+    std::size_t n;
+    std::size_t i;
+    
+    c = *( p++ );
+    
+    if( c < 0x80 )
+    {
+        return c;
+    }
+    else if( ( c & 0xE0 ) == 0xC0 )
+    {
+        n   = 1;
+        min = 0x80;
+        c  &= 0x1F;
+    }
+    else if( ( c & 0xF0 ) == 0xE0 )
+    {
+        n   = 2;
+        min = 0x800;
+        c  &= 0x0F;
+    }
+    else if( ( c & 0xF8 ) == 0xF0 )
+    {
+        n   = 3;
+        min = 0x10000;
+        c  &= 0x07;
+    }
+    else
+    {
+        return 0xFFFD;
+    }
+    
+    if( static_cast< std::size_t >( end - p ) < n )
+    {
+        p = end;
+        
+        return 0xFFFD;
+    }
+    
+    for( i = 0; i < n; i++ )
+    {
+        if( ( p[ i ] & 0xC0 ) != 0x80 )
+        {
+            p += i;
+            
+            return 0xFFFD;
+        }
+        
+        c = ( c << 6 ) | ( p[ i ] & 0x3F );
+    }
+    
+    p += n;
+    
+    if( c < min || c > 0x10FFFF || ( c >= 0xD800 && c <= 0xDFFF ) )
+    {
+        return 0xFFFD;
+    }
+    
+    return c;
+}
+
+/* Literal comparison of UTF-16 code units, decoding the UTF-8 bytes on the fly */
+static CFComparisonResult __CompareUTF8( CFStringRef string, std::string_view value )
+{
+    CFStringInlineBuffer  buffer;
+    CFIndex               length;
+    CFIndex               i;
+    const unsigned char * p;
+    const unsigned char * end;
+    UTF32Char             c;
+    UniChar               a;
+    UniChar               b;
+    UniChar               pending;
+    
+    length  = CFStringGetLength( string );
+    p       = reinterpret_cast< const unsigned char * >( value.data() );
+    end     = p + value.length();
+    i       = 0;
+    pending = 0;
+    
+    CFStringInitInlineBuffer( string, &buffer, CFRangeMake( 0, length ) );
+    
+    while( true )
+    {
+        if( i == length || ( pending == 0 && p == end ) )
+        {
+            if( i < length )
+            {
+                return kCFCompareGreaterThan;
+            }
+            
+            return ( pending == 0 && p == end ) ? kCFCompareEqualTo : kCFCompareLessThan;
+        }
+        
+        a = CFStringGetCharacterFromInlineBuffer( &buffer, i++ );
+        
+        if( pending != 0 )
+        {
+            b       = pending;
+            pending = 0;
+        }
+        else
+        {
+            c = __DecodeUTF8( p, end );
+            
+            if( c > 0xFFFF )
+            {
+                c      -= 0x10000;
+                b       = static_cast< UniChar >( 0xD800 + ( c >> 10 ) );
+                pending = static_cast< UniChar >( 0xDC00 + ( c & 0x3FF ) );
+            }
+            else
+            {
+                b = static_cast< UniChar >( c );
+            }
+        }
+        
+        if( a != b )
+        {
+            return ( a < b ) ? kCFCompareLessThan : kCFCompareGreaterThan;
+        }
+    }
+}
+
+/* Code point order matching UTF-16 code unit order: U+E000-U+FFFF sort after supplementary planes */
+static bool __LessUTF8( std::string_view v1, std::string_view v2 )
+{
+    const unsigned char * p1;
+    const unsigned char * p2;
+    const unsigned char * e1;
+    const unsigned char * e2;
+    UTF32Char             c1;
+    UTF32Char             c2;
+    
+    p1 = reinterpret_cast< const unsigned char * >( v1.data() );
+    p2 = reinterpret_cast< const unsigned char * >( v2.data() );
+    e1 = p1 + v1.length();
+    e2 = p2 + v2.length();
+    
+    while( p1 < e1 && p2 < e2 )
+    {
+        c1 = __DecodeUTF8( p1, e1 );
+        c2 = __DecodeUTF8( p2, e2 );
+        
+        if( c1 != c2 )
+        {
+            c1 = ( c1 >= 0xE000 && c1 <= 0xFFFF ) ? c1 + 0x200000 : c1;
+            c2 = ( c2 >= 0xE000 && c2 <= 0xFFFF ) ? c2 + 0x200000 : c2;
+            
+            return c1 < c2;
+        }
+    }
+    
+    return p1 == e1 && p2 != e2;
+}
+
+static uint64_t __HashBytes( uint64_t hash, const void * bytes, std::size_t length )
+{
+    const unsigned char * p;
+    std::size_t           i;
+    
+    p = static_cast< const unsigned char * >( bytes );
+    
+    for( i = 0; i < length; i++ )
+    {
+        hash ^= p[ i ];
+        hash *= __fnvPrime;
+    }
+    
+    return hash;
+}
+
+static std::size_t __FinalizeHash( uint64_t hash )
+{
+    std::size_t h;
+    
+    h = ( sizeof( std::size_t ) < sizeof( uint64_t ) ) ? static_cast< std::size_t >( hash ^ ( hash >> 32 ) ) : static_cast< std::size_t >( hash );
+    
+    /* 0 means not computed yet */
+    return ( h == 0 ) ? 1 : h;
+}
 
 namespace CF
 {
-    String::String(): _cfObject( nullptr )
+    String::String(): _cfObject( nullptr ), _hash( 0 )
     {
         this->SetValue( "" );
     }
     
-    String::String( const AutoPointer & value ): _cfObject( nullptr )
+    String::String( const AutoPointer & value ): _cfObject( nullptr ), _hash( 0 )
     {
         if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
         {
@@ -45,7 +517,7 @@ namespace CF
         }
     }
     
-    String::String( CFTypeRef cfObject ): _cfObject( nullptr )
+    String::String( CFTypeRef cfObject ): _cfObject( nullptr ), _hash( 0 )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -53,7 +525,7 @@ namespace CF
         }
     }
     
-    String::String( CFStringRef cfObject ): _cfObject( nullptr )
+    String::String( CFStringRef cfObject ): _cfObject( nullptr ), _hash( 0 )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -64,7 +536,7 @@ namespace CF
     String::String( std::nullptr_t ): String( static_cast< CFTypeRef >( nullptr ) )
     {}
     
-    String::String( const AutoPointer & value, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( const AutoPointer & value, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr ), _hash( 0 )
     {
         if( value.IsValid() && value.GetTypeID() == this->GetTypeID() )
         {
@@ -76,7 +548,7 @@ namespace CF
         }
     }
     
-    String::String( CFTypeRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( CFTypeRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr ), _hash( 0 )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -88,7 +560,7 @@ namespace CF
         }
     }
     
-    String::String( CFStringRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( CFStringRef cfObject, std::string defaultValueIfNULL, CFStringEncoding encoding ): _cfObject( nullptr ), _hash( 0 )
     {
         if( cfObject != nullptr && CFGetTypeID( cfObject ) == this->GetTypeID() )
         {
@@ -100,12 +572,17 @@ namespace CF
         }
     }
     
-    String::String( const std::string & value, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( const std::string & value, CFStringEncoding encoding ): _cfObject( nullptr ), _hash( 0 )
+    {
+        this->SetValue( value, encoding );
+    }
+    
+    String::String( std::string_view value, CFStringEncoding encoding ): _cfObject( nullptr ), _hash( 0 )
     {
         this->SetValue( value, encoding );
     }
     
-    String::String( char * value, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( char * value, CFStringEncoding encoding ): _cfObject( nullptr ), _hash( 0 )
     {
         if( value == nullptr )
         {
@@ -115,7 +592,7 @@ namespace CF
         this->SetValue( value, encoding );
     }
     
-    String::String( const char * value, CFStringEncoding encoding ): _cfObject( nullptr )
+    String::String( const char * value, CFStringEncoding encoding ): _cfObject( nullptr ), _hash( 0 )
     {
         if( value == nullptr )
         {
@@ -125,7 +602,7 @@ namespace CF
         this->SetValue( value, encoding );
     }
     
-    String::String( const String & value ): _cfObject( nullptr )
+    String::String( const String & value ): _cfObject( nullptr ), _hash( value._hash.load( std::memory_order_relaxed ) )
     {
         if( value._cfObject != nullptr )
         {
@@ -137,6 +614,8 @@ namespace CF
     {
         this->_cfObject = value._cfObject;
         value._cfObject = nullptr;
+        this->_hash.store( value._hash.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+        value._hash.store( 0, std::memory_order_relaxed );
     }
     
     String::~String()
@@ -149,6 +628,118 @@ namespace CF
         }
     }
     
+    String String::NoCopy( std::string_view value, CFStringEncoding encoding )
+    {
+        #ifdef _WIN32
+        
+        __loadCFAllocatorNull();
+        
+        return String::NoCopy( value, __cfAllocatorNull, encoding );
+        
+        #else
+        
+        return String::NoCopy( value, kCFAllocatorNull, encoding );
+        
+        #endif
+    }
+    
+    String String::NoCopy( std::string_view value, CFAllocatorRef deallocator, CFStringEncoding encoding )
+    {
+        AutoPointer str;
+        
+        if( value.data() == nullptr )
+        {
+            return String( "", encoding );
+        }
+        
+        str = CFStringCreateWithBytesNoCopy
+        (
+            static_cast< CFAllocatorRef >( nullptr ),
+            reinterpret_cast< const UInt8 * >( value.data() ),
+            static_cast< CFIndex >( value.length() ),
+            encoding,
+            false,
+            deallocator
+        );
+        
+        return str.As< CFStringRef >();
+    }
+    
+    CFStringRef String::Intern( std::string_view value )
+    {
+        __KeyTable       & table = __GetKeyTable();
+        std::size_t        hash  = GetHash( value );
+        const __KeySlots * slots;
+        const __KeyEntry * entry;
+        CFStringRef        s;
+        
+        entry = __FindKey( table.current.load( std::memory_order_acquire ), value, hash );
+        
+        if( entry != nullptr )
+        {
+            return entry->string;
+        }
+        
+        std::lock_guard< std::mutex > l( table.lock );
+        
+        slots = table.current.load( std::memory_order_relaxed );
+        entry = __FindKey( slots, value, hash );
+        
+        if( entry != nullptr )
+        {
+            return entry->string;
+        }
+        
+        s = CFStringCreateWithBytes( static_cast< CFAllocatorRef >( nullptr ), reinterpret_cast< const UInt8 * >( value.data() ), static_cast< CFIndex >( value.length() ), kCFStringEncodingUTF8, false );
+        
+        if( s == nullptr )
+        {
+            return nullptr;
+        }
+        
+        table.entries.push_back( __KeyEntry{ std::string( value ), s, hash } );
+        
+        entry = &( table.entries.back() );
+        
+        if( slots == nullptr || table.entries.size() * 2 > slots->mask + 1 )
+        {
+            table.slots.emplace_back( ( slots == nullptr ) ? 16 : ( slots->mask + 1 ) * 2 );
+            
+            slots = &( table.slots.back() );
+            
+            for( const __KeyEntry & e: table.entries )
+            {
+                __InsertKey( slots, &e );
+            }
+            
+            table.current.store( slots, std::memory_order_release );
+        }
+        else
+        {
+            __InsertKey( slots, entry );
+        }
+        
+        return s;
+    }
+    
+    CFStringRef String::GetInterned( std::string_view value )
+    {
+        const __KeySlots * slots;
+        const __KeyEntry * entry;
+        
+        slots = __GetKeyTable().current.load( std::memory_order_acquire );
+        
+        /* Nothing interned yet: skip hashing the value */
+        if( slots == nullptr )
+        {
+            return nullptr;
+        }
+        
+        entry = __FindKey( slots, value, GetHash( value ) );
+        
+        return ( entry == nullptr ) ? nullptr : entry->string;
+    }
+    
     String & String::operator =( String value )
     {
         swap( *( this ), value );
@@ -213,17 +804,27 @@ namespace CF
     
     bool String::operator == ( const std::string & value ) const
     {
-        return operator ==( String( value ) );
+        return operator ==( std::string_view( value ) );
+    }
+    
+    bool String::operator == ( std::string_view value ) const
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return false;
+        }
+        
+        return __MatchUTF8( this->_cfObject, value, false );
     }
     
     bool String::operator == ( char * value ) const
     {
-        return operator ==( String( value ) );
+        return operator ==( static_cast< const char * >( value ) );
     }
     
     bool String::operator == ( const char * value ) const
     {
-        return operator ==( String( value ) );
+        return operator ==( std::string_view( ( value == nullptr ) ? "" : value ) );
     }
             
     bool String::operator != ( const String & value ) const
@@ -246,6 +847,11 @@ namespace CF
         return !operator ==( value );
     }
     
+    bool String::operator != ( std::string_view value ) const
+    {
+        return !operator ==( value );
+    }
+    
     bool String::operator != ( char * value ) const
     {
         return !operator ==( value );
@@ -280,6 +886,7 @@ namespace CF
         CFRelease( this->_cfObject );
         
         this->_cfObject = newString;
+        this->_hash.store( 0, std::memory_order_relaxed );
         
         return *( this );
     }
@@ -306,21 +913,21 @@ namespace CF
     
     char String::operator [] ( int index ) const
     {
-        std::string s;
+        std::string_view s;
         
-        s = this->GetValue();
+        s = this->GetStringView();
         
         if( index < 0 )
         {
             index = static_cast< int >( s.length() ) + index;
         }
         
-        if( static_cast< std::size_t >( index ) >= s.length() )
+        if( index < 0 || static_cast< std::size_t >( index ) >= s.length() )
         {
             return 0;
         }
         
-        return s.at( static_cast< std::size_t >( index ) );
+        return s[ static_cast< std::size_t >( index ) ];
     }
     
     String::operator std::string () const
@@ -359,11 +966,22 @@ namespace CF
     
     bool String::HasPrefix( const std::string & value ) const
     {
-        String s;
-        
-        s = value;
+        return this->HasPrefix( std::string_view( value ) );
+    }
+    
+    bool String::HasPrefix( std::string_view value ) const
+    {
+        if( this->_cfObject == nullptr || value.length() == 0 )
+        {
+            return false;
+        }
         
-        return this->HasPrefix( s );
+        return __MatchUTF8( this->_cfObject, value, true );
+    }
+    
+    bool String::HasPrefix( const char * value ) const
+    {
+        return this->HasPrefix( std::string_view( ( value == nullptr ) ? "" : value ) );
     }
     
     bool String::HasSuffix( const String & value ) const
@@ -387,11 +1005,72 @@ namespace CF
     
     bool String::HasSuffix( const std::string & value ) const
     {
-        String s;
+        return this->HasSuffix( std::string_view( value ) );
+    }
+    
+    bool String::HasSuffix( std::string_view value ) const
+    {
+        if( this->_cfObject == nullptr || value.length() == 0 )
+        {
+            return false;
+        }
         
-        s = value;
+        return __HasSuffixUTF8( this->_cfObject, value );
+    }
+    
+    bool String::HasSuffix( const char * value ) const
+    {
+        return this->HasSuffix( std::string_view( ( value == nullptr ) ? "" : value ) );
+    }
+    
+    CFComparisonResult String::Compare( const String & value, CFStringCompareFlags flags ) const
+    {
+        return this->Compare( value._cfObject, flags );
+    }
+    
+    CFComparisonResult String::Compare( CFStringRef value, CFStringCompareFlags flags ) const
+    {
+        CFStringRef s;
         
-        return this->HasSuffix( s );
+        s = ( this->_cfObject == nullptr ) ? CFSTR( "" ) : this->_cfObject;
+        
+        return CFStringCompare( s, ( value == nullptr ) ? CFSTR( "" ) : value, flags );
+    }
+    
+    CFComparisonResult String::Compare( const std::string & value, CFStringCompareFlags flags ) const
+    {
+        return this->Compare( std::string_view( value ), flags );
+    }
+    
+    CFComparisonResult String::Compare( std::string_view value, CFStringCompareFlags flags ) const
+    {
+        CFStringRef        s;
+        String             other;
+        CFComparisonResult r;
+        
+        s = ( this->_cfObject == nullptr ) ? CFSTR( "" ) : this->_cfObject;
+        
+        if( flags == 0 )
+        {
+            return __CompareUTF8( s, value );
+        }
+        
+        other = NoCopy( value );
+        
+        if( other.IsValid() )
+        {
+            return this->Compare( other, flags );
+        }
+        
+        /* Not valid UTF-8: literal order, and never equal to a valid string */
+        r = __CompareUTF8( s, value );
+        
+        return ( r == kCFCompareEqualTo ) ? kCFCompareLessThan : r;
+    }
+    
+    CFComparisonResult String::Compare( const char * value, CFStringCompareFlags flags ) const
+    {
+        return this->Compare( std::string_view( ( value == nullptr ) ? "" : value ), flags );
     }
     
     CFIndex String::GetLength() const
@@ -404,38 +1083,198 @@ namespace CF
         return CFStringGetLength( this->_cfObject );
     }
     
+    std::size_t String::GetHash() const
+    {
+        uint64_t     hash;
+        const char * cp;
+        CFIndex      length;
+        CFIndex      pos;
+        CFIndex      count;
+        CFIndex      used;
+        UniChar      c;
+        UInt8        buffer[ 256 ];
+        std::size_t  cached;
+        
+        /* Relaxed is enough: racing threads compute and store the same value */
+        cached = this->_hash.load( std::memory_order_relaxed );
+        
+        if( cached != 0 )
+        {
+            return cached;
+        }
+        
+        hash = __fnvOffsetBasis;
+        
+        if( this->_cfObject != nullptr )
+        {
+            length = CFStringGetLength( this->_cfObject );
+            cp     = CFStringGetCStringPtr( this->_cfObject, kCFStringEncodingUTF8 );
+            
+            if( cp != nullptr )
+            {
+                hash = __HashBytes( hash, cp, static_cast< std::size_t >( length ) );
+            }
+            else
+            {
+                pos = 0;
+                
+                while( pos < length )
+                {
+                    used  = 0;
+                    count = CFStringGetBytes( this->_cfObject, CFRangeMake( pos, length - pos ), kCFStringEncodingUTF8, 0, false, buffer, sizeof( buffer ), &used );
+                    
+                    if( count == 0 )
+                    {
+                        /* Unpaired surrogate, not representable in UTF-8 */
+                        c     = CFStringGetCharacterAtIndex( this->_cfObject, pos );
+                        hash  = __HashBytes( hash, &c, sizeof( c ) );
+                        count = 1;
+                    }
+                    else
+                    {
+                        hash = __HashBytes( hash, buffer, static_cast< std::size_t >( used ) );
+                    }
+                    
+                    pos += count;
+                }
+            }
+        }
+        
+        cached = __FinalizeHash( hash );
+        
+        this->_hash.store( cached, std::memory_order_relaxed );
+        
+        return cached;
+    }
+    
+    std::size_t String::GetHash( std::string_view value )
+    {
+        return __FinalizeHash( __HashBytes( __fnvOffsetBasis, value.data(), value.length() ) );
+    }
+    
     std::string String::GetValue( CFStringEncoding encoding ) const
     {
-        const char * s;
-        char       * buf;
-        size_t       length;
-        std::string  str;
+        std::string  s;
+        const char * cp;
+        CFIndex      count;
+        CFIndex      length;
+        UInt8        buffer[ 4096 ];
         
         if( this->_cfObject == nullptr )
         {
-            return "";
+            return s;
         }
         
-        s = this->GetCStringValue( encoding );
+        cp    = this->GetCStringValue( encoding );
+        count = CFStringGetLength( this->_cfObject );
         
-        if( s == nullptr )
+        if( cp != nullptr )
         {
-            length = static_cast< size_t >( CFStringGetMaximumSizeForEncoding( CFStringGetLength( this->_cfObject ), encoding ) );
-            buf    = new char [ length + 1 ];
-            
-            memset( buf, 0, length + 1 );
-            CFStringGetCString( this->_cfObject, buf, static_cast< CFIndex >( length + 1 ), encoding );
+            return std::string( cp, static_cast< std::size_t >( count ) );
+        }
+        
+        Encoder encoder( *( this ), encoding );
+        
+        /*
+         * A single conversion pass, rather than measuring first. Most
+         * encodings need at least one byte per UTF-16 unit, and the string
+         * grows geometrically past that.
+         */
+        s.reserve( static_cast< std::size_t >( count ) );
+        
+        while( encoder.IsAtEnd() == false )
+        {
+            length = encoder.Read( buffer, sizeof( buffer ) );
             
-            str = ( buf == nullptr ) ? "" : buf;
+            if( length == 0 )
+            {
+                return std::string();
+            }
             
-            delete [] buf;
+            s.append( reinterpret_cast< const char * >( buffer ), static_cast< std::size_t >( length ) );
         }
-        else
+        
+        return s;
+    }
+    
+    std::string_view String::GetStringView( CFStringEncoding encoding ) const
+    {
+        static thread_local std::vector< char > buffer;
+        
+        const char * s;
+        CFIndex      count;
+        CFIndex      used;
+        std::size_t  size;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return {};
+        }
+        
+        s     = this->GetCStringValue( encoding );
+        count = CFStringGetLength( this->_cfObject );
+        
+        if( s != nullptr )
+        {
+            return std::string_view( s, static_cast< std::size_t >( count ) );
+        }
+        
+        /* Measures the exact converted size rather than the worst case */
+        used = 0;
+        
+        if( CFStringGetBytes( this->_cfObject, CFRangeMake( 0, count ), encoding, 0, false, nullptr, 0, &used ) != count )
+        {
+            return {};
+        }
+        
+        size = std::max( static_cast< std::size_t >( used ), static_cast< std::size_t >( 1 ) );
+        
+        /* Releases the storage kept from a large string once it is no longer needed */
+        if( buffer.size() > __scratchLimit && size <= __scratchLimit )
+        {
+            std::vector< char >().swap( buffer );
+        }
+        
+        if( buffer.size() < size )
+        {
+            buffer.resize( size );
+        }
+        
+        return this->GetStringView( buffer.data(), static_cast< CFIndex >( size ), encoding );
+    }
+    
+    std::string_view String::GetStringView( char * buffer, CFIndex length, CFStringEncoding encoding ) const
+    {
+        const char * s;
+        CFIndex      count;
+        CFIndex      used;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return {};
+        }
+        
+        s     = this->GetCStringValue( encoding );
+        count = CFStringGetLength( this->_cfObject );
+        
+        if( s != nullptr )
         {
-            str = s;
+            return std::string_view( s, static_cast< std::size_t >( count ) );
         }
         
-        return str;
+        if( buffer == nullptr || length <= 0 )
+        {
+            return {};
+        }
+        
+        used = 0;
+        
+        if( CFStringGetBytes( this->_cfObject, CFRangeMake( 0, count ), encoding, 0, false, reinterpret_cast< UInt8 * >( buffer ), length, &used ) != count )
+        {
+            return {};
+        }
+        
+        return std::string_view( buffer, static_cast< std::size_t >( used ) );
     }
     
     const char * String::GetCStringValue( CFStringEncoding encoding ) const
@@ -448,30 +1287,178 @@ namespace CF
         return nullptr;
     }
     
-    void String::SetValue( const std::string & value, CFStringEncoding encoding )
+    void String::SetValue( std::string_view value, CFStringEncoding encoding )
     {
         if( this->_cfObject != nullptr )
         {
             CFRelease( this->_cfObject );
         }
         
-        this->_cfObject = CFStringCreateWithCString( static_cast< CFAllocatorRef >( nullptr ), value.c_str(), encoding );
+        this->_hash.store( 0, std::memory_order_relaxed );
+        this->_cfObject = CFStringCreateWithBytes
+        (
+            static_cast< CFAllocatorRef >( nullptr ),
+            reinterpret_cast< const UInt8 * >( ( value.data() == nullptr ) ? "" : value.data() ),
+            static_cast< CFIndex >( value.length() ),
+            encoding,
+            false
+        );
     }
     
     String::Iterator String::begin( CFStringEncoding encoding ) const
     {
-        return Iterator( this->_cfObject, encoding, this->GetLength() );
+        return Iterator( this->_cfObject, encoding, false );
     }
     
     String::Iterator String::end( CFStringEncoding encoding ) const
     {
-        return Iterator( this->_cfObject, encoding, this->GetLength(), this->GetLength() );
+        return Iterator( this->_cfObject, encoding, true );
+    }
+    
+    bool String::WriteTo( WriteStream & stream, CFStringEncoding encoding, UInt8 lossByte, bool includeBOM ) const
+    {
+        Encoder encoder( *( this ), encoding, lossByte, includeBOM );
+        UInt8   buffer[ 4096 ];
+        CFIndex length;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return false;
+        }
+        
+        while( encoder.IsAtEnd() == false )
+        {
+            length = encoder.Read( buffer, sizeof( buffer ) );
+            
+            if( length == 0 || stream.WriteAll( buffer, length ) == false )
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    bool String::AppendTo( Data & data, CFStringEncoding encoding, UInt8 lossByte, bool includeBOM ) const
+    {
+        Encoder encoder( *( this ), encoding, lossByte, includeBOM );
+        CFIndex start;
+        CFIndex length;
+        
+        if( this->_cfObject == nullptr || data.GetCFObject() == nullptr )
+        {
+            return false;
+        }
+        
+        /* Converts straight into the data storage, which CoreFoundation grows geometrically */
+        while( encoder.IsAtEnd() == false )
+        {
+            start = data.GetLength();
+            
+            data.IncreaseLength( 16384 );
+            
+            length = encoder.Read( data.GetMutableBytePtr() + start, 16384 );
+            
+            data.SetLength( start + length );
+            
+            if( length == 0 )
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    std::size_t String::Hasher::operator ()( const String & value ) const
+    {
+        return value.GetHash();
+    }
+    
+    std::size_t String::Hasher::operator ()( std::string_view value ) const
+    {
+        return String::GetHash( value );
+    }
+    
+    bool String::EqualTo::operator ()( const String & v1, const String & v2 ) const
+    {
+        std::size_t h1;
+        std::size_t h2;
+        
+        if( v1._cfObject == nullptr || v2._cfObject == nullptr )
+        {
+            return v1._cfObject == v2._cfObject;
+        }
+        
+        h1 = v1._hash.load( std::memory_order_relaxed );
+        h2 = v2._hash.load( std::memory_order_relaxed );
+        
+        if( h1 != 0 && h2 != 0 && h1 != h2 )
+        {
+            return false;
+        }
+        
+        return v1 == v2;
+    }
+    
+    bool String::EqualTo::operator ()( const String & v1, std::string_view v2 ) const
+    {
+        return v1 == v2;
+    }
+    
+    bool String::EqualTo::operator ()( std::string_view v1, const String & v2 ) const
+    {
+        return v2 == v1;
+    }
+    
+    bool String::EqualTo::operator ()( std::string_view v1, std::string_view v2 ) const
+    {
+        return v1 == v2;
+    }
+    
+    bool String::Less::operator ()( const String & v1, const String & v2 ) const
+    {
+        return v1.Compare( v2 ) == kCFCompareLessThan;
+    }
+    
+    bool String::Less::operator ()( const String & v1, std::string_view v2 ) const
+    {
+        return v1.Compare( v2 ) == kCFCompareLessThan;
+    }
+    
+    bool String::Less::operator ()( std::string_view v1, const String & v2 ) const
+    {
+        return v2.Compare( v1 ) == kCFCompareGreaterThan;
+    }
+    
+    bool String::Less::operator ()( std::string_view v1, std::string_view v2 ) const
+    {
+        return __LessUTF8( v1, v2 );
+    }
+    
+    String::CharacterView String::GetCharacters() const
+    {
+        return CharacterView( *( this ) );
+    }
+    
+    String::CodePointView String::GetCodePoints() const
+    {
+        return CodePointView( *( this ) );
     }
     
     void swap( String & v1, String & v2 ) noexcept
     {
         using std::swap;
         
+        std::size_t h1;
+        std::size_t h2;
+        
+        h1 = v1._hash.load( std::memory_order_relaxed );
+        h2 = v2._hash.load( std::memory_order_relaxed );
+        
         swap( v1._cfObject, v2._cfObject );
+        
+        v1._hash.store( h2, std::memory_order_relaxed );
+        v2._hash.store( h1, std::memory_order_relaxed );
     }
 }
@@ -0,0 +1,567 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-StringBuilder.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    CoreFoundation++ CFMutableStringRef builder
+ */
+
+#include <CF++.hpp>
+#include <charconv>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static void __AppendASCII( CFMutableStringRef str, const char * s, std::size_t length );
+static void __AppendASCII( CFMutableStringRef str, const char * s, std::size_t length )
+{
+    UniChar     chars[ 128 ];
+    std::size_t n;
+    std::size_t i;
+    
+    while( length > 0 )
+    {
+        n = ( length < sizeof( chars ) / sizeof( UniChar ) ) ? length : sizeof( chars ) / sizeof( UniChar );
+        
+        for( i = 0; i < n; i++ )
+        {
+            chars[ i ] = static_cast< UniChar >( static_cast< unsigned char >( s[ i ] ) );
+        }
+        
+        CFStringAppendCharacters( str, chars, static_cast< CFIndex >( n ) );
+        
+        s      += n;
+        length -= n;
+    }
+}
+
+static bool __IsASCII( const char * s, std::size_t length );
+static bool __IsASCII( const char * s, std::size_t length )
+{
+    std::size_t i;
+    
+    for( i = 0; i < length; i++ )
+    {
+        if( static_cast< unsigned char >( s[ i ] ) > 0x7F )
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+template< typename T >
+static void __AppendInteger( CFMutableStringRef str, T value )
+{
+    char                 buf[ 32 ];
+    std::to_chars_result r;
+    
+    r = std::to_chars( buf, buf + sizeof( buf ), value );
+    
+    if( r.ec == std::errc() )
+    {
+        __AppendASCII( str, buf, static_cast< std::size_t >( r.ptr - buf ) );
+    }
+}
+
+static void __AppendDouble( CFMutableStringRef str, double value );
+static void __AppendDouble( CFMutableStringRef str, double value )
+{
+    char buf[ 32 ];
+    
+    #ifdef __cpp_lib_to_chars
+    
+    std::to_chars_result r;
+    
+    /* Shortest representation that round-trips, independent of the locale */
+    r = std::to_chars( buf, buf + sizeof( buf ), value );
+    
+    if( r.ec == std::errc() )
+    {
+        __AppendASCII( str, buf, static_cast< std::size_t >( r.ptr - buf ) );
+    }
+    
+    #else
+    
+    int          n;
+    const char * point;
+    char       * p;
+    std::size_t  length;
+    
+    /*
+     * Shortest of %.15g and %.17g that still round-trips.
+     */
+    n = snprintf( buf, sizeof( buf ), "%.15g", value );
+    
+    if( n > 0 && strtod( buf, nullptr ) != value )
+    {
+        n = snprintf( buf, sizeof( buf ), "%.17g", value );
+    }
+    
+    if( n <= 0 )
+    {
+        return;
+    }
+    
+    /* Both follow LC_NUMERIC, so put back a '.' decimal point */
+    point = localeconv()->decimal_point;
+    p     = ( point == nullptr || strcmp( point, "." ) == 0 ) ? nullptr : strstr( buf, point );
+    
+    if( p != nullptr )
+    {
+        length   = strlen( point );
+        *( p++ ) = '.';
+        
+        memmove( p, p + length - 1, strlen( p + length - 1 ) + 1 );
+        
+        n -= static_cast< int >( length - 1 );
+    }
+    
+    __AppendASCII( str, buf, static_cast< std::size_t >( n ) );
+    
+    #endif
+}
+
+namespace CF
+{
+    StringBuilder::StringBuilder(): StringBuilder( static_cast< CFIndex >( 0 ) )
+    {}
+    
+    StringBuilder::StringBuilder( CFIndex capacity ): _cfObject( nullptr ), _capacity( 0 )
+    {
+        this->_cfObject = CFStringCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+        
+        this->Reserve( capacity );
+    }
+    
+    StringBuilder::StringBuilder( const String & value ): StringBuilder( value.GetLength() )
+    {
+        this->Append( value );
+    }
+    
+    StringBuilder::StringBuilder( const StringBuilder & value ): _cfObject( nullptr ), _capacity( 0 )
+    {
+        if( value._cfObject != nullptr )
+        {
+            this->_cfObject = CFStringCreateMutableCopy( static_cast< CFAllocatorRef >( nullptr ), 0, value._cfObject );
+        }
+    }
+    
+    StringBuilder::StringBuilder( StringBuilder && value ) noexcept
+    {
+        this->_cfObject = value._cfObject;
+        value._cfObject = nullptr;
+        this->_capacity = value._capacity;
+        value._capacity = 0;
+    }
+    
+    StringBuilder::~StringBuilder()
+    {
+        if( this->_cfObject != nullptr )
+        {
+            CFRelease( this->_cfObject );
+            
+            this->_cfObject = nullptr;
+        }
+    }
+    
+    StringBuilder & StringBuilder::operator =( StringBuilder value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const String & value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( CFStringRef value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( std::string_view value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const std::string & value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( const char * value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( char value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( signed short value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( signed int value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( signed long value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( signed long long value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( unsigned short value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( unsigned int value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( unsigned long value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( unsigned long long value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( float value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    StringBuilder & StringBuilder::operator << ( double value )
+    {
+        this->Append( value );
+        
+        return *( this );
+    }
+    
+    CFTypeID StringBuilder::GetTypeID() const
+    {
+        return CFStringGetTypeID();
+    }
+    
+    CFTypeRef StringBuilder::GetCFObject() const
+    {
+        return static_cast< CFTypeRef >( this->_cfObject );
+    }
+    
+    CFIndex StringBuilder::GetLength() const
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return 0;
+        }
+        
+        return CFStringGetLength( this->_cfObject );
+    }
+    
+    void StringBuilder::Reserve( CFIndex capacity )
+    {
+        CFMutableStringRef str;
+        UniChar          * chars;
+        CFIndex            length;
+        
+        if( this->_cfObject == nullptr || capacity <= this->_capacity )
+        {
+            return;
+        }
+        
+        length = CFStringGetLength( this->_cfObject );
+        
+        if( capacity <= length )
+        {
+            return;
+        }
+        
+        /*
+         * CFStringCreateMutable only takes a hard length limit, so the
+         * storage is preallocated as an external buffer, which CF grows and
+         * frees with the default allocator.
+         */
+        chars = static_cast< UniChar * >( CFAllocatorAllocate( static_cast< CFAllocatorRef >( nullptr ), capacity * static_cast< CFIndex >( sizeof( UniChar ) ), 0 ) );
+        
+        if( chars == nullptr )
+        {
+            return;
+        }
+        
+        CFStringGetCharacters( this->_cfObject, CFRangeMake( 0, length ), chars );
+        
+        str = CFStringCreateMutableWithExternalCharactersNoCopy
+        (
+            static_cast< CFAllocatorRef >( nullptr ),
+            chars,
+            length,
+            capacity,
+            static_cast< CFAllocatorRef >( nullptr )
+        );
+        
+        if( str == nullptr )
+        {
+            CFAllocatorDeallocate( static_cast< CFAllocatorRef >( nullptr ), chars );
+            
+            return;
+        }
+        
+        CFRelease( this->_cfObject );
+        
+        this->_cfObject = str;
+        this->_capacity = capacity;
+    }
+    
+    void StringBuilder::Clear()
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        CFStringDelete( this->_cfObject, CFRangeMake( 0, CFStringGetLength( this->_cfObject ) ) );
+    }
+    
+    void StringBuilder::Append( const String & value )
+    {
+        this->Append( static_cast< CFStringRef >( value.GetCFObject() ) );
+    }
+    
+    void StringBuilder::Append( CFStringRef value )
+    {
+        if( this->_cfObject == nullptr || value == nullptr || CFGetTypeID( value ) != this->GetTypeID() )
+        {
+            return;
+        }
+        
+        CFStringAppend( this->_cfObject, value );
+    }
+    
+    void StringBuilder::Append( std::string_view value, CFStringEncoding encoding )
+    {
+        if( this->_cfObject == nullptr || value.length() == 0 )
+        {
+            return;
+        }
+        
+        if( ( encoding == kCFStringEncodingUTF8 || encoding == kCFStringEncodingASCII ) && __IsASCII( value.data(), value.length() ) )
+        {
+            __AppendASCII( this->_cfObject, value.data(), value.length() );
+        }
+        else
+        {
+            this->Append( String::NoCopy( value, encoding ) );
+        }
+    }
+    
+    void StringBuilder::Append( const std::string & value, CFStringEncoding encoding )
+    {
+        this->Append( std::string_view( value ), encoding );
+    }
+    
+    void StringBuilder::Append( const char * value, CFStringEncoding encoding )
+    {
+        if( value == nullptr )
+        {
+            return;
+        }
+        
+        this->Append( std::string_view( value ), encoding );
+    }
+    
+    void StringBuilder::Append( char value )
+    {
+        UniChar c;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        c = static_cast< UniChar >( static_cast< unsigned char >( value ) );
+        
+        CFStringAppendCharacters( this->_cfObject, &c, 1 );
+    }
+    
+    void StringBuilder::Append( signed short value )
+    {
+        this->Append( static_cast< signed long long >( value ) );
+    }
+    
+    void StringBuilder::Append( signed int value )
+    {
+        this->Append( static_cast< signed long long >( value ) );
+    }
+    
+    void StringBuilder::Append( signed long value )
+    {
+        this->Append( static_cast< signed long long >( value ) );
+    }
+    
+    void StringBuilder::Append( signed long long value )
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        __AppendInteger( this->_cfObject, value );
+    }
+    
+    void StringBuilder::Append( unsigned short value )
+    {
+        this->Append( static_cast< unsigned long long >( value ) );
+    }
+    
+    void StringBuilder::Append( unsigned int value )
+    {
+        this->Append( static_cast< unsigned long long >( value ) );
+    }
+    
+    void StringBuilder::Append( unsigned long value )
+    {
+        this->Append( static_cast< unsigned long long >( value ) );
+    }
+    
+    void StringBuilder::Append( unsigned long long value )
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        __AppendInteger( this->_cfObject, value );
+    }
+    
+    void StringBuilder::Append( float value )
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        __AppendDouble( this->_cfObject, static_cast< double >( value ) );
+    }
+    
+    void StringBuilder::Append( double value )
+    {
+        if( this->_cfObject == nullptr )
+        {
+            return;
+        }
+        
+        __AppendDouble( this->_cfObject, value );
+    }
+    
+    void StringBuilder::AppendCharacters( const UniChar * characters, CFIndex length )
+    {
+        if( this->_cfObject == nullptr || characters == nullptr || length <= 0 )
+        {
+            return;
+        }
+        
+        CFStringAppendCharacters( this->_cfObject, characters, length );
+    }
+    
+    String StringBuilder::Freeze()
+    {
+        AutoPointer str;
+        
+        if( this->_cfObject == nullptr )
+        {
+            return String();
+        }
+        
+        /*
+         * An immutable copy, compacted to 8 bits when possible: the builder's
+         * storage may be a reserved external UTF-16 buffer, which would stay
+         * alive and keep CFStringGetCStringPtr from ever succeeding.
+         */
+        str = CFStringCreateCopy( static_cast< CFAllocatorRef >( nullptr ), this->_cfObject );
+        
+        CFRelease( this->_cfObject );
+        
+        this->_cfObject = CFStringCreateMutable( static_cast< CFAllocatorRef >( nullptr ), 0 );
+        this->_capacity = 0;
+        
+        return str.As< CFStringRef >();
+    }
+    
+    void swap( StringBuilder & v1, StringBuilder & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._cfObject, v2._cfObject );
+        swap( v1._capacity, v2._capacity );
+    }
+}
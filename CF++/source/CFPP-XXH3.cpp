@@ -0,0 +1,651 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CFPP-XXH3.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Incremental XXH3 64-bit hash
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __SSE2__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define CFPP_XXH3_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined( _MSC_VER ) && defined( _M_X64 )
+#include <intrin.h>
+#endif
+
+/*
+ * Port of the reference XXH3_64bits (xxHash 0.8, BSD 2-Clause,
+ * Yann Collet). Stripes are 64 bytes, blocks are 16 stripes; the
+ * secret advances 8 bytes per stripe.
+ */
+
+static const UInt64 __prime32_1 = 0x9E3779B1ULL;
+static const UInt64 __prime32_2 = 0x85EBCA77ULL;
+static const UInt64 __prime32_3 = 0xC2B2AE3DULL;
+static const UInt64 __prime64_1 = 0x9E3779B185EBCA87ULL;
+static const UInt64 __prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const UInt64 __prime64_3 = 0x165667B19E3779F9ULL;
+static const UInt64 __prime64_4 = 0x85EBCA77C2B2AE63ULL;
+static const UInt64 __prime64_5 = 0x27D4EB2F165667C5ULL;
+static const UInt64 __primeMX1  = 0x165667919E3779F9ULL;
+static const UInt64 __primeMX2  = 0x9FB21C651E98DF25ULL;
+
+static const CF::Data::Byte __defaultSecret[ 192 ] =
+{
+    0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+    0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+    0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+    0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+    0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+    0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+    0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+    0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+    0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+    0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+    0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+    0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E
+};
+
+static UInt32 __Read32( const CF::Data::Byte * p );
+static UInt64 __Read64( const CF::Data::Byte * p );
+static void   __Write64( CF::Data::Byte * p, UInt64 v );
+static UInt64 __Swap64( UInt64 v );
+static UInt64 __RotL64( UInt64 v, unsigned int r );
+static UInt64 __Mul128Fold64( UInt64 a, UInt64 b );
+static UInt64 __Avalanche64( UInt64 h );
+static UInt64 __Avalanche( UInt64 h );
+static UInt64 __RRMXMX( UInt64 h, UInt64 length );
+static UInt64 __Mix16( const CF::Data::Byte * in, const CF::Data::Byte * secret, UInt64 seed );
+static UInt64 __HashShort( const CF::Data::Byte * in, CFIndex length, UInt64 seed );
+static UInt64 __HashLong( const CF::Data::Byte * in, CFIndex length, const CF::Data::Byte * secret );
+static void   __InitSecret( CF::Data::Byte * secret, UInt64 seed );
+static void   __InitAcc( UInt64 * acc );
+static void   __Accumulate( UInt64 * acc, const CF::Data::Byte * in, const CF::Data::Byte * secret, CFIndex stripes );
+static void   __Scramble( UInt64 * acc, const CF::Data::Byte * secret );
+static void   __ConsumeStripes( UInt64 * acc, CFIndex & stripesSoFar, const CF::Data::Byte * in, CFIndex stripes, const CF::Data::Byte * secret );
+static UInt64 __MergeAccs( const UInt64 * acc, const CF::Data::Byte * secret, UInt64 start );
+
+static UInt32 __Read32( const CF::Data::Byte * p )
+{
+    UInt32 v;
+    
+    memcpy( &v, p, sizeof( v ) );
+    
+    return CFSwapInt32LittleToHost( v );
+}
+
+static UInt64 __Read64( const CF::Data::Byte * p )
+{
+    UInt64 v;
+    
+    memcpy( &v, p, sizeof( v ) );
+    
+    return CFSwapInt64LittleToHost( v );
+}
+
+static void __Write64( CF::Data::Byte * p, UInt64 v )
+{
+    v = CFSwapInt64HostToLittle( v );
+    
+    memcpy( p, &v, sizeof( v ) );
+}
+
+static UInt64 __Swap64( UInt64 v )
+{
+    v = ( ( v & 0x00FF00FF00FF00FFULL ) << 8 )  | ( ( v >> 8 )  & 0x00FF00FF00FF00FFULL );
+    v = ( ( v & 0x0000FFFF0000FFFFULL ) << 16 ) | ( ( v >> 16 ) & 0x0000FFFF0000FFFFULL );
+    
+    return ( v << 32 ) | ( v >> 32 );
+}
+
+static UInt64 __RotL64( UInt64 v, unsigned int r )
+{
+    return ( v << r ) | ( v >> ( 64 - r ) );
+}
+
+static UInt64 __Mul128Fold64( UInt64 a, UInt64 b )
+{
+    #if defined( __SIZEOF_INT128__ )
+    
+    unsigned __int128 p;
+    
+    p = static_cast< unsigned __int128 >( a ) * b;
+    
+    return static_cast< UInt64 >( p ) ^ static_cast< UInt64 >( p >> 64 );
+    
+    #elif defined( _MSC_VER ) && defined( _M_X64 )
+    
+    unsigned __int64 hi;
+    unsigned __int64 lo;
+    
+    lo = _umul128( a, b, &hi );
+    
+    return lo ^ hi;
+    
+    #else
+    
+    UInt64 ll;
+    UInt64 hl;
+    UInt64 lh;
+    UInt64 hh;
+    UInt64 cross;
+    
+    ll    = ( a & 0xFFFFFFFF ) * ( b & 0xFFFFFFFF );
+    hl    = ( a >> 32 )        * ( b & 0xFFFFFFFF );
+    lh    = ( a & 0xFFFFFFFF ) * ( b >> 32 );
+    hh    = ( a >> 32 )        * ( b >> 32 );
+    cross = ( ll >> 32 ) + ( hl & 0xFFFFFFFF ) + lh;
+    
+    return ( ( cross << 32 ) | ( ll & 0xFFFFFFFF ) ) ^ ( ( hl >> 32 ) + ( cross >> 32 ) + hh );
+    
+    #endif
+}
+
+static UInt64 __Avalanche64( UInt64 h )
+{
+    h ^= h >> 33;
+    h *= __prime64_2;
+    h ^= h >> 29;
+    h *= __prime64_3;
+    h ^= h >> 32;
+    
+    return h;
+}
+
+static UInt64 __Avalanche( UInt64 h )
+{
+    h ^= h >> 37;
+    h *= __primeMX1;
+    h ^= h >> 32;
+    
+    return h;
+}
+
+static UInt64 __RRMXMX( UInt64 h, UInt64 length )
+{
+    h ^= __RotL64( h, 49 ) ^ __RotL64( h, 24 );
+    h *= __primeMX2;
+    h ^= ( h >> 35 ) + length;
+    h *= __primeMX2;
+    h ^= h >> 28;
+    
+    return h;
+}
+
+static UInt64 __Mix16( const CF::Data::Byte * in, const CF::Data::Byte * secret, UInt64 seed )
+{
+    return __Mul128Fold64( __Read64( in ) ^ ( __Read64( secret ) + seed ), __Read64( in + 8 ) ^ ( __Read64( secret + 8 ) - seed ) );
+}
+
+/* Up to 240 bytes, always with the default secret */
+static UInt64 __HashShort( const CF::Data::Byte * in, CFIndex length, UInt64 seed )
+{
+    const CF::Data::Byte * s;
+    UInt64                 acc;
+    UInt64                 lo;
+    UInt64                 hi;
+    UInt32                 c;
+    CFIndex                i;
+    
+    s = __defaultSecret;
+    
+    if( length > 128 )
+    {
+        acc = static_cast< UInt64 >( length ) * __prime64_1;
+        
+        for( i = 0; i < 8; i++ )
+        {
+            acc += __Mix16( in + 16 * i, s + 16 * i, seed );
+        }
+        
+        acc = __Avalanche( acc );
+        
+        for( i = 8; i < length / 16; i++ )
+        {
+            acc += __Mix16( in + 16 * i, s + 16 * ( i - 8 ) + 3, seed );
+        }
+        
+        acc += __Mix16( in + length - 16, s + 136 - 17, seed );
+        
+        return __Avalanche( acc );
+    }
+    
+    if( length > 16 )
+    {
+        acc = static_cast< UInt64 >( length ) * __prime64_1;
+        
+        if( length > 32 )
+        {
+            if( length > 64 )
+            {
+                if( length > 96 )
+                {
+                    acc += __Mix16( in + 48,          s + 96,  seed );
+                    acc += __Mix16( in + length - 64, s + 112, seed );
+                }
+                
+                acc += __Mix16( in + 32,          s + 64, seed );
+                acc += __Mix16( in + length - 48, s + 80, seed );
+            }
+            
+            acc += __Mix16( in + 16,          s + 32, seed );
+            acc += __Mix16( in + length - 32, s + 48, seed );
+        }
+        
+        acc += __Mix16( in,               s,      seed );
+        acc += __Mix16( in + length - 16, s + 16, seed );
+        
+        return __Avalanche( acc );
+    }
+    
+    if( length > 8 )
+    {
+        lo  = __Read64( in )              ^ ( ( __Read64( s + 24 ) ^ __Read64( s + 32 ) ) + seed );
+        hi  = __Read64( in + length - 8 ) ^ ( ( __Read64( s + 40 ) ^ __Read64( s + 48 ) ) - seed );
+        acc = static_cast< UInt64 >( length ) + __Swap64( lo ) + hi + __Mul128Fold64( lo, hi );
+        
+        return __Avalanche( acc );
+    }
+    
+    if( length >= 4 )
+    {
+        seed ^= static_cast< UInt64 >( __Swap64( seed ) >> 32 ) << 32;
+        lo    = __Read32( in );
+        hi    = __Read32( in + length - 4 );
+        acc   = ( hi + ( lo << 32 ) ) ^ ( ( __Read64( s + 8 ) ^ __Read64( s + 16 ) ) - seed );
+        
+        return __RRMXMX( acc, static_cast< UInt64 >( length ) );
+    }
+    
+    if( length > 0 )
+    {
+        c = ( static_cast< UInt32 >( in[ 0 ] ) << 16 ) | ( static_cast< UInt32 >( in[ length >> 1 ] ) << 24 ) | in[ length - 1 ] | ( static_cast< UInt32 >( length ) << 8 );
+        
+        return __Avalanche64( static_cast< UInt64 >( c ) ^ ( static_cast< UInt64 >( __Read32( s ) ^ __Read32( s + 4 ) ) + seed ) );
+    }
+    
+    return __Avalanche64( seed ^ __Read64( s + 56 ) ^ __Read64( s + 64 ) );
+}
+
+static UInt64 __HashLong( const CF::Data::Byte * in, CFIndex length, const CF::Data::Byte * secret )
+{
+    UInt64  acc[ 8 ];
+    CFIndex blocks;
+    CFIndex i;
+    
+    __InitAcc( acc );
+    
+    blocks = ( length - 1 ) / 1024;
+    
+    for( i = 0; i < blocks; i++ )
+    {
+        __Accumulate( acc, in + i * 1024, secret, 16 );
+        __Scramble( acc, secret + 128 );
+    }
+    
+    __Accumulate( acc, in + blocks * 1024, secret, ( ( length - 1 ) - blocks * 1024 ) / 64 );
+    __Accumulate( acc, in + length - 64, secret + 128 - 7, 1 );
+    
+    return __MergeAccs( acc, secret + 11, static_cast< UInt64 >( length ) * __prime64_1 );
+}
+
+/* A seed of 0 gives back the default secret */
+static void __InitSecret( CF::Data::Byte * secret, UInt64 seed )
+{
+    unsigned int i;
+    
+    for( i = 0; i < 192; i += 16 )
+    {
+        __Write64( secret + i,     __Read64( __defaultSecret + i )     + seed );
+        __Write64( secret + i + 8, __Read64( __defaultSecret + i + 8 ) - seed );
+    }
+}
+
+static void __InitAcc( UInt64 * acc )
+{
+    acc[ 0 ] = __prime32_3;
+    acc[ 1 ] = __prime64_1;
+    acc[ 2 ] = __prime64_2;
+    acc[ 3 ] = __prime64_3;
+    acc[ 4 ] = __prime64_4;
+    acc[ 5 ] = __prime32_2;
+    acc[ 6 ] = __prime64_5;
+    acc[ 7 ] = __prime32_1;
+}
+
+static void __Accumulate( UInt64 * acc, const CF::Data::Byte * in, const CF::Data::Byte * secret, CFIndex stripes )
+{
+    CFIndex      n;
+    unsigned int i;
+    
+    #ifdef CFPP_XXH3_SSE2
+    
+    __m128i a[ 4 ];
+    __m128i d;
+    __m128i dk;
+    
+    for( i = 0; i < 4; i++ )
+    {
+        a[ i ] = _mm_loadu_si128( reinterpret_cast< const __m128i * >( acc + i * 2 ) );
+    }
+    
+    for( n = 0; n < stripes; n++ )
+    {
+        for( i = 0; i < 4; i++ )
+        {
+            d      = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + n * 64 + i * 16 ) );
+            dk     = _mm_xor_si128( d, _mm_loadu_si128( reinterpret_cast< const __m128i * >( secret + n * 8 + i * 16 ) ) );
+            dk     = _mm_mul_epu32( dk, _mm_shuffle_epi32( dk, _MM_SHUFFLE( 0, 3, 0, 1 ) ) );
+            a[ i ] = _mm_add_epi64( a[ i ], _mm_add_epi64( _mm_shuffle_epi32( d, _MM_SHUFFLE( 1, 0, 3, 2 ) ), dk ) );
+        }
+    }
+    
+    for( i = 0; i < 4; i++ )
+    {
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( acc + i * 2 ), a[ i ] );
+    }
+    
+    #else
+    
+    UInt64 d;
+    UInt64 dk;
+    
+    for( n = 0; n < stripes; n++ )
+    {
+        for( i = 0; i < 8; i++ )
+        {
+            d             = __Read64( in + n * 64 + i * 8 );
+            dk            = d ^ __Read64( secret + n * 8 + i * 8 );
+            acc[ i ^ 1 ] += d;
+            acc[ i ]     += ( dk & 0xFFFFFFFF ) * ( dk >> 32 );
+        }
+    }
+    
+    #endif
+}
+
+static void __Scramble( UInt64 * acc, const CF::Data::Byte * secret )
+{
+    unsigned int i;
+    
+    #ifdef CFPP_XXH3_SSE2
+    
+    __m128i a;
+    __m128i prime;
+    
+    prime = _mm_set1_epi32( static_cast< int >( __prime32_1 ) );
+    
+    for( i = 0; i < 4; i++ )
+    {
+        a = _mm_loadu_si128( reinterpret_cast< const __m128i * >( acc + i * 2 ) );
+        a = _mm_xor_si128( a, _mm_srli_epi64( a, 47 ) );
+        a = _mm_xor_si128( a, _mm_loadu_si128( reinterpret_cast< const __m128i * >( secret + i * 16 ) ) );
+        a = _mm_add_epi64( _mm_mul_epu32( a, prime ), _mm_slli_epi64( _mm_mul_epu32( _mm_shuffle_epi32( a, _MM_SHUFFLE( 0, 3, 0, 1 ) ), prime ), 32 ) );
+        
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( acc + i * 2 ), a );
+    }
+    
+    #else
+    
+    for( i = 0; i < 8; i++ )
+    {
+        acc[ i ] ^= acc[ i ] >> 47;
+        acc[ i ] ^= __Read64( secret + i * 8 );
+        acc[ i ] *= __prime32_1;
+    }
+    
+    #endif
+}
+
+/* Scrambles as soon as a block is complete, as the input is known to continue */
+static void __ConsumeStripes( UInt64 * acc, CFIndex & stripesSoFar, const CF::Data::Byte * in, CFIndex stripes, const CF::Data::Byte * secret )
+{
+    CFIndex n;
+    
+    if( 16 - stripesSoFar <= stripes )
+    {
+        n = 16 - stripesSoFar;
+        
+        __Accumulate( acc, in, secret + stripesSoFar * 8, n );
+        __Scramble( acc, secret + 128 );
+        __Accumulate( acc, in + n * 64, secret, stripes - n );
+        
+        stripesSoFar = stripes - n;
+    }
+    else
+    {
+        __Accumulate( acc, in, secret + stripesSoFar * 8, stripes );
+        
+        stripesSoFar += stripes;
+    }
+}
+
+static UInt64 __MergeAccs( const UInt64 * acc, const CF::Data::Byte * secret, UInt64 start )
+{
+    unsigned int i;
+    
+    for( i = 0; i < 4; i++ )
+    {
+        start += __Mul128Fold64( acc[ i * 2 ] ^ __Read64( secret + i * 16 ), acc[ i * 2 + 1 ] ^ __Read64( secret + i * 16 + 8 ) );
+    }
+    
+    return __Avalanche( start );
+}
+
+namespace CF
+{
+    XXH3::XXH3( UInt64 seed ): _seed( seed )
+    {
+        this->Reset();
+    }
+    
+    XXH3::XXH3( const XXH3 & value ):
+        _seed( value._seed ),
+        _length( value._length ),
+        _stripes( value._stripes ),
+        _buffered( value._buffered )
+    {
+        memcpy( this->_acc,    value._acc,    sizeof( this->_acc ) );
+        memcpy( this->_secret, value._secret, sizeof( this->_secret ) );
+        memcpy( this->_buffer, value._buffer, sizeof( this->_buffer ) );
+    }
+    
+    XXH3::XXH3( XXH3 && value ) noexcept: XXH3( static_cast< const XXH3 & >( value ) )
+    {}
+    
+    XXH3::~XXH3()
+    {}
+    
+    XXH3 & XXH3::operator =( XXH3 value )
+    {
+        swap( *( this ), value );
+        
+        return *( this );
+    }
+    
+    UInt64 XXH3::Compute( const Data & data, UInt64 seed )
+    {
+        return XXH3::Compute( data.GetBytePtr(), data.GetLength(), seed );
+    }
+    
+    UInt64 XXH3::Compute( const Data::Byte * bytes, CFIndex length, UInt64 seed )
+    {
+        Data::Byte secret[ 192 ];
+        
+        if( bytes == nullptr || length < 0 )
+        {
+            length = 0;
+        }
+        
+        if( length <= 240 )
+        {
+            return __HashShort( bytes, length, seed );
+        }
+        
+        if( seed == 0 )
+        {
+            return __HashLong( bytes, length, __defaultSecret );
+        }
+        
+        __InitSecret( secret, seed );
+        
+        return __HashLong( bytes, length, secret );
+    }
+    
+    UInt64 XXH3::GetSeed() const
+    {
+        return this->_seed;
+    }
+    
+    UInt64 XXH3::GetValue() const
+    {
+        UInt64     acc[ 8 ];
+        Data::Byte last[ 64 ];
+        CFIndex    stripes;
+        
+        if( this->_length <= 240 )
+        {
+            return __HashShort( this->_buffer, static_cast< CFIndex >( this->_length ), this->_seed );
+        }
+        
+        memcpy( acc, this->_acc, sizeof( acc ) );
+        
+        stripes = this->_stripes;
+        
+        if( this->_buffered >= 64 )
+        {
+            __ConsumeStripes( acc, stripes, this->_buffer, ( this->_buffered - 1 ) / 64, this->_secret );
+            __Accumulate( acc, this->_buffer + this->_buffered - 64, this->_secret + 128 - 7, 1 );
+        }
+        else
+        {
+            /* The last stripe starts in the previous block, kept at the end of the buffer */
+            memcpy( last, this->_buffer + sizeof( this->_buffer ) - ( 64 - this->_buffered ), static_cast< size_t >( 64 - this->_buffered ) );
+            memcpy( last + 64 - this->_buffered, this->_buffer, static_cast< size_t >( this->_buffered ) );
+            
+            __Accumulate( acc, last, this->_secret + 128 - 7, 1 );
+        }
+        
+        return __MergeAccs( acc, this->_secret + 11, this->_length * __prime64_1 );
+    }
+    
+    void XXH3::Reset()
+    {
+        this->_length   = 0;
+        this->_stripes  = 0;
+        this->_buffered = 0;
+        
+        __InitAcc( this->_acc );
+        __InitSecret( this->_secret, this->_seed );
+    }
+    
+    void XXH3::Update( const Data & data )
+    {
+        this->Update( data.GetBytePtr(), data.GetLength() );
+    }
+    
+    void XXH3::Update( const Data::Byte * bytes, CFIndex length )
+    {
+        CFIndex n;
+        
+        if( bytes == nullptr || length <= 0 )
+        {
+            return;
+        }
+        
+        this->_length += static_cast< UInt64 >( length );
+        
+        if( this->_buffered + length <= 256 )
+        {
+            memcpy( this->_buffer + this->_buffered, bytes, static_cast< size_t >( length ) );
+            
+            this->_buffered += length;
+            
+            return;
+        }
+        
+        /* At least one byte is always kept back, for the last stripe */
+        if( this->_buffered > 0 )
+        {
+            n = 256 - this->_buffered;
+            
+            memcpy( this->_buffer + this->_buffered, bytes, static_cast< size_t >( n ) );
+            __ConsumeStripes( this->_acc, this->_stripes, this->_buffer, 4, this->_secret );
+            
+            bytes          += n;
+            length         -= n;
+            this->_buffered = 0;
+        }
+        
+        if( length > 256 )
+        {
+            do
+            {
+                __ConsumeStripes( this->_acc, this->_stripes, bytes, 4, this->_secret );
+                
+                bytes  += 256;
+                length -= 256;
+            }
+            while( length > 256 );
+            
+            memcpy( this->_buffer + sizeof( this->_buffer ) - 64, bytes - 64, 64 );
+        }
+        
+        memcpy( this->_buffer, bytes, static_cast< size_t >( length ) );
+        
+        this->_buffered = length;
+    }
+    
+    bool XXH3::Update( ReadStream & stream )
+    {
+        std::vector< Data::Byte > buffer( 65536 );
+        CFIndex                   n;
+        
+        while( ( n = stream.Read( &( buffer[ 0 ] ), static_cast< CFIndex >( buffer.size() ) ) ) > 0 )
+        {
+            this->Update( &( buffer[ 0 ] ), n );
+        }
+        
+        return n == 0;
+    }
+    
+    void swap( XXH3 & v1, XXH3 & v2 ) noexcept
+    {
+        using std::swap;
+        
+        swap( v1._seed,     v2._seed );
+        swap( v1._length,   v2._length );
+        swap( v1._acc,      v2._acc );
+        swap( v1._stripes,  v2._stripes );
+        swap( v1._buffered, v2._buffered );
+        swap( v1._secret,   v2._secret );
+        swap( v1._buffer,   v2._buffer );
+    }
+}
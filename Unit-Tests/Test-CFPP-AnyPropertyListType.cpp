@@ -52,6 +52,11 @@ TEST( CFPP_AnyPropertyListType, FromPropertyList )
     ASSERT_TRUE( p.IsValidPropertyList() );
     ASSERT_TRUE( p.GetTypeID() == CFDictionaryGetTypeID() );
     
+    p = CF::AnyPropertyListType::FromPropertyList( "/System/Library/Frameworks/CoreFoundation.framework/Versions/A/Resources/Info.plist", true );
+    
+    ASSERT_TRUE( p.IsValidPropertyList() );
+    ASSERT_TRUE( p.GetTypeID() == CFDictionaryGetTypeID() );
+    
     p = CF::Dictionary::FromPropertyList( "" );
     
     ASSERT_FALSE( p.IsValid() );
@@ -65,6 +70,30 @@ TEST( CFPP_AnyPropertyListType, FromPropertyList )
     ASSERT_TRUE(  p.GetTypeID() == 0 );
 }
 
+TEST( CFPP_AnyPropertyListType, FromPropertyList_GZip )
+{
+    CF::AnyPropertyListType p( CF::PropertyListFormatBinary );
+    CF::WriteStream         s( std::string( "/tmp/com.xs-labs.cfpp-any.plist.gz" ) );
+    
+    ASSERT_TRUE( s.Open() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE( s.WriteAll( CF::Data( std::string( __plist ) ).Compress( CF::Data::CompressionGzip ) ) );
+    #endif
+    
+    s.Close();
+    
+    p = CF::AnyPropertyListType::FromPropertyList( "/tmp/com.xs-labs.cfpp-any.plist.gz" );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  p.IsValid() );
+    ASSERT_TRUE(  p.GetTypeID() == CFDictionaryGetTypeID() );
+    ASSERT_TRUE(  p.GetFormat() == CF::PropertyListFormatXML );
+    #else
+    ASSERT_FALSE( p.IsValid() );
+    #endif
+}
+
 TEST( CFPP_AnyPropertyListType, FromPropertyListString )
 {
     CF::AnyPropertyListType p( CF::PropertyListFormatBinary );
@@ -408,6 +408,13 @@ TEST( CFPP_Array_Iterator, OperatorEqual )
         i1 = a1.begin();
         i2 = a2.begin();
         
+        /* Copies share their CFArray until one of them is mutated */
+        ASSERT_TRUE( i1 == i2 );
+        
+        a2 << CF::String( "foobar" );
+        
+        i2 = a2.begin();
+        
         ASSERT_FALSE( i1 == i2 );
         
         i1 = a1.begin();
@@ -456,6 +463,13 @@ TEST( CFPP_Array_Iterator, OperatorNotEqual )
         i1 = a1.begin();
         i2 = a2.begin();
         
+        /* Copies share their CFArray until one of them is mutated */
+        ASSERT_FALSE( i1 != i2 );
+        
+        a2 << CF::String( "foobar" );
+        
+        i2 = a2.begin();
+        
         ASSERT_TRUE( i1 != i2 );
         
         i1 = a1.begin();
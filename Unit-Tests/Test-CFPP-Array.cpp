@@ -29,6 +29,7 @@
  */
 
 #include <CF++.hpp>
+#include <list>
 
 #define XSTEST_GTEST_COMPAT
 #include <XSTest/XSTest.hpp>
@@ -115,6 +116,51 @@ TEST( CFPP_Array, CTOR_STDInitializerList )
     ASSERT_TRUE( CF::String( a[ 3 ] ) == "hello, universe" );
 }
 
+TEST( CFPP_Array, CTOR_Iterators )
+{
+    std::list< std::string > l( { "hello", "world" } );
+    const char             * s[] = { "hello", nullptr, "universe" };
+    CF::Array                a1( l.begin(), l.end() );
+    CF::Array                a2( std::begin( s ), std::end( s ) );
+    CF::Array                a3( l.end(), l.end() );
+    
+    ASSERT_TRUE( a1.IsValid() );
+    ASSERT_TRUE( a2.IsValid() );
+    ASSERT_TRUE( a3.IsValid() );
+    ASSERT_EQ( a1.GetCount(), 2 );
+    ASSERT_EQ( a2.GetCount(), 3 );
+    ASSERT_EQ( a3.GetCount(), 0 );
+    
+    ASSERT_TRUE( CF::String( a1[ 0 ] ) == "hello" );
+    ASSERT_TRUE( CF::String( a1[ 1 ] ) == "world" );
+    ASSERT_TRUE( CF::String( a2[ 0 ] ) == "hello" );
+    ASSERT_TRUE( a2[ 1 ] == kCFNull );
+    ASSERT_TRUE( CF::String( a2[ 2 ] ) == "universe" );
+}
+
+TEST( CFPP_Array, CTOR_STDVector )
+{
+    CF::Array a1( std::vector< std::string >( { "hello", "world" } ) );
+    CF::Array a2( std::vector< int >( { 1, 2, 3 } ) );
+    CF::Array a3( std::vector< CF::String >( { "hello", "world" } ) );
+    CF::Array a4( std::vector< CFTypeRef >( { CF::String( "hello" ), nullptr, CF::Number( 42 ) } ) );
+    
+    ASSERT_TRUE( a1.IsValid() );
+    ASSERT_TRUE( a2.IsValid() );
+    ASSERT_TRUE( a3.IsValid() );
+    ASSERT_TRUE( a4.IsValid() );
+    ASSERT_EQ( a1.GetCount(), 2 );
+    ASSERT_EQ( a2.GetCount(), 3 );
+    ASSERT_EQ( a3.GetCount(), 2 );
+    ASSERT_EQ( a4.GetCount(), 3 );
+    
+    ASSERT_TRUE( CF::String( a1[ 1 ] ) == "world" );
+    ASSERT_TRUE( CF::Number( a2[ 2 ] ) == 3 );
+    ASSERT_TRUE( CF::String( a3[ 0 ] ) == "hello" );
+    ASSERT_TRUE( a4[ 1 ] == kCFNull );
+    ASSERT_TRUE( CF::Number( a4[ 2 ] ) == 42 );
+}
+
 TEST( CFPP_Array, CCTOR )
 {
     CF::Array a1;
@@ -154,6 +200,217 @@ TEST( CFPP_Array, MCTOR )
     }
 }
 
+TEST( CFPP_Array, Borrow )
+{
+    CF::Array a( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::Array a1( CF::Array::Borrow( static_cast< CFArrayRef >( a.GetCFObject() ) ) );
+    CF::Array a2( CF::Array::Borrow( nullptr ) );
+    
+    ASSERT_TRUE(  a1.IsValid() );
+    ASSERT_FALSE( a2.IsValid() );
+    ASSERT_TRUE(  a1.GetCFObject() == a.GetCFObject() );
+    ASSERT_EQ(    a1.GetCount(), 2 );
+    
+    a1 << "universe";
+    
+    ASSERT_TRUE(  a1.GetCFObject() != a.GetCFObject() );
+    ASSERT_EQ(    a1.GetCount(), 3 );
+    ASSERT_EQ(    a.GetCount(), 2 );
+}
+
+TEST( CFPP_Array, Adopt )
+{
+    CFMutableArrayRef array;
+    CF::Array         a1;
+    CF::Array         a2( CF::Array::Adopt( nullptr ) );
+    CF::Array         a3( CF::Array::Adopt( static_cast< CFArrayRef >( CFRetain( CF::String( "hello" ).GetCFObject() ) ) ) );
+    
+    array = CFArrayCreateMutable( nullptr, 0, &kCFTypeArrayCallBacks );
+    
+    CFArrayAppendValue( array, CF::String( "hello" ) );
+    
+    a1 = CF::Array::Adopt( array );
+    
+    ASSERT_TRUE(  a1.IsValid() );
+    ASSERT_FALSE( a2.IsValid() );
+    ASSERT_FALSE( a3.IsValid() );
+    ASSERT_TRUE(  a1.GetCFObject() == array );
+    ASSERT_EQ(    a1.GetRetainCount(), 1 );
+    ASSERT_EQ(    a1.GetCount(), 1 );
+    
+    a1 << "world";
+    
+    ASSERT_EQ(    a1.GetCount(), 2 );
+    ASSERT_TRUE(  CF::String( a1[ 1 ] ) == "world" );
+}
+
+TEST( CFPP_Array, FromRange )
+{
+    std::vector< double > v( { 1.5, 2.5 } );
+    std::list< bool >     l( { true, false } );
+    CF::Array             a1( CF::Array::FromRange( v ) );
+    CF::Array             a2( CF::Array::FromRange( l ) );
+    CF::Array             a3( CF::Array::FromRange( std::vector< std::string >() ) );
+    CF::Array             a4( CF::Array::FromRange( a1 ) );
+    
+    ASSERT_TRUE( a1.IsValid() );
+    ASSERT_TRUE( a2.IsValid() );
+    ASSERT_TRUE( a3.IsValid() );
+    ASSERT_TRUE( a4.IsValid() );
+    ASSERT_EQ( a1.GetCount(), 2 );
+    ASSERT_EQ( a2.GetCount(), 2 );
+    ASSERT_EQ( a3.GetCount(), 0 );
+    ASSERT_EQ( a4.GetCount(), 2 );
+    
+    ASSERT_TRUE( CF::Number( a1[ 0 ] ) == 1.5 );
+    ASSERT_TRUE( CF::Boolean( a2[ 0 ] ) == true );
+    ASSERT_TRUE( CF::Boolean( a2[ 1 ] ) == false );
+    ASSERT_TRUE( a4[ 1 ] == a1[ 1 ] );
+    
+    {
+        std::vector< CF::String > s( { CF::String( "hello" ), CF::String( static_cast< CFStringRef >( nullptr ) ) } );
+        CF::Array                 a( CF::Array::FromRange( s ) );
+        
+        ASSERT_EQ(   a.GetCount(), 2 );
+        ASSERT_TRUE( a[ 1 ] == kCFNull );
+    }
+    
+    a3 << "hello";
+    
+    ASSERT_EQ( a3.GetCount(), 1 );
+}
+
+TEST( CFPP_Array, FromRange_Iterators )
+{
+    std::vector< std::string > v( { "hello", "world", "universe" } );
+    CF::Array                  a( CF::Array::FromRange( v.begin() + 1, v.end() ) );
+    
+    ASSERT_TRUE( a.IsValid() );
+    ASSERT_EQ( a.GetCount(), 2 );
+    
+    ASSERT_TRUE( CF::String( a[ 0 ] ) == "world" );
+    ASSERT_TRUE( CF::String( a[ 1 ] ) == "universe" );
+}
+
+TEST( CFPP_Array, ToVector )
+{
+    CF::Array a1( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::Array a2( { CF::Number( 1 ), CF::Number( 2.5 ) } );
+    CF::Array a3( static_cast< CFArrayRef >( nullptr ) );
+    
+    {
+        std::vector< std::string > v( a1.ToVector< std::string >() );
+        
+        ASSERT_EQ( v.size(), 2 );
+        ASSERT_EQ( v[ 0 ], "hello" );
+        ASSERT_EQ( v[ 1 ], "world" );
+    }
+    
+    {
+        std::vector< CF::String > v( a1.ToVector< CF::String >() );
+        
+        ASSERT_EQ( v.size(), 2 );
+        ASSERT_TRUE( v[ 1 ] == "world" );
+    }
+    
+    {
+        std::vector< CFTypeRef > v( a1.ToVector< CFTypeRef >() );
+        
+        ASSERT_EQ( v.size(), 2 );
+        ASSERT_TRUE( v[ 0 ] == a1[ 0 ] );
+    }
+    
+    {
+        std::vector< CFStringRef > v( a1.ToVector< CFStringRef >() );
+        
+        ASSERT_EQ( v.size(), 2 );
+        ASSERT_TRUE( v[ 1 ] == a1[ 1 ] );
+    }
+    
+    {
+        std::vector< int >    v1( a2.ToVector< int >() );
+        std::vector< double > v2( a2.ToVector< double >() );
+        
+        ASSERT_EQ( v1.size(), 2 );
+        ASSERT_EQ( v2.size(), 2 );
+        ASSERT_EQ( v1[ 0 ], 1 );
+        ASSERT_EQ( v2[ 1 ], 2.5 );
+    }
+    
+    ASSERT_EQ( a3.ToVector< std::string >().size(), 0 );
+    ASSERT_TRUE( CF::Array( std::vector< std::string >( { "a", "b" } ) ).ToVector< std::string >() == std::vector< std::string >( { "a", "b" } ) );
+}
+
+TEST( CFPP_Array, ToPackedDoubles )
+{
+    CF::Array             a1( { CF::Number( 1 ), CF::Number( 2.5 ), CF::Number( -3 ) } );
+    CF::Array             a2( { CF::Number( 1 ), CF::String( "hello" ), CF::Number( 2 ), CF::String( "world" ) } );
+    CF::Array             a3( static_cast< CFArrayRef >( nullptr ) );
+    CFIndex               mismatch( 0 );
+    std::vector< double > v;
+    
+    v = a1.ToPackedDoubles( &mismatch );
+    
+    ASSERT_EQ( mismatch, kCFNotFound );
+    ASSERT_TRUE( v == std::vector< double >( { 1.0, 2.5, -3.0 } ) );
+    
+    v = a2.ToPackedDoubles( &mismatch );
+    
+    ASSERT_EQ( mismatch, 1 );
+    ASSERT_TRUE( v == std::vector< double >( { 1.0, 0.0, 2.0, 0.0 } ) );
+    
+    v = a3.ToPackedDoubles( &mismatch );
+    
+    ASSERT_EQ( mismatch, kCFNotFound );
+    ASSERT_EQ( v.size(), 0 );
+    ASSERT_EQ( a1.ToPackedDoubles().size(), 3 );
+}
+
+TEST( CFPP_Array, ToPackedInt64 )
+{
+    CF::Array             a1( { CF::Number( 1 ), CF::Number( 42 ), CF::Number( -3 ) } );
+    CF::Array             a2( { CF::Number( 1 ), CF::Number( 2 ), CF::String( "hello" ) } );
+    CF::Array             a3( { CF::Number( 1 ), CF::Number( 3.0 ), CF::Number( 3.7 ), CF::String( "hello" ) } );
+    CFIndex               mismatch( 0 );
+    std::vector< SInt64 > v;
+    
+    v = a1.ToPackedInt64( &mismatch );
+    
+    ASSERT_EQ( mismatch, kCFNotFound );
+    ASSERT_TRUE( v == std::vector< SInt64 >( { 1, 42, -3 } ) );
+    
+    v = a2.ToPackedInt64( &mismatch );
+    
+    ASSERT_EQ( mismatch, 2 );
+    ASSERT_TRUE( v == std::vector< SInt64 >( { 1, 2, 0 } ) );
+    
+    v = a3.ToPackedInt64( &mismatch );
+    
+    ASSERT_EQ( mismatch, 2 );
+    ASSERT_TRUE( v == std::vector< SInt64 >( { 1, 3, 3, 0 } ) );
+}
+
+TEST( CFPP_Array, FromPacked )
+{
+    std::vector< double > d( { 1.5, -2.0, 3.25 } );
+    std::vector< SInt64 > i( { 1, 4294967296LL, -3 } );
+    CF::Array             a1( CF::Array::FromPacked( d ) );
+    CF::Array             a2( CF::Array::FromPacked( i ) );
+    CF::Array             a3( CF::Array::FromPacked( static_cast< const double * >( nullptr ), 10 ) );
+    
+    ASSERT_TRUE( a1.IsValid() );
+    ASSERT_TRUE( a2.IsValid() );
+    ASSERT_TRUE( a3.IsValid() );
+    ASSERT_EQ( a1.GetCount(), 3 );
+    ASSERT_EQ( a2.GetCount(), 3 );
+    ASSERT_EQ( a3.GetCount(), 0 );
+    
+    ASSERT_TRUE( CF::Number( a1[ 2 ] ) == 3.25 );
+    ASSERT_TRUE( CF::Number( a2[ 1 ] ).GetSignedLongLongValue() == 4294967296LL );
+    ASSERT_TRUE( a1.ToPackedDoubles() == d );
+    ASSERT_TRUE( a2.ToPackedInt64() == i );
+}
+
 TEST( CFPP_Array, OperatorAssignArray )
 {
     CF::Array a1;
@@ -432,6 +689,30 @@ TEST( CFPP_Array, OperatorSubscript )
     ASSERT_EQ( CFGetTypeID( a1[ 0 ] ), CFStringGetTypeID() );
 }
 
+TEST( CFPP_Array, CastToCFMutableArrayRef )
+{
+    CFArrayRef  array( CFArrayCreate( nullptr, nullptr, 0, &kCFTypeArrayCallBacks ) );
+    CF::Array   a1( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::Array   a2( a1 );
+    CF::Array   a3( a1 );
+    CF::Array   a4( CF::Array::Adopt( array ) );
+    CF::Array   a5( static_cast< CFArrayRef >( nullptr ) );
+    CF::Type  & t( a3 );
+    
+    CFArrayAppendValue( a2, CF::String( "universe" ) );
+    CFArrayRemoveAllValues( static_cast< CFMutableArrayRef >( t ) );
+    CFArrayAppendValue( a4, CF::String( "hello" ) );
+    
+    ASSERT_TRUE( a1.GetCFObject() != a2.GetCFObject() );
+    ASSERT_TRUE( a1.GetCFObject() != a3.GetCFObject() );
+    ASSERT_TRUE( a4.GetCFObject() != array );
+    ASSERT_EQ(   a1.GetCount(), 2 );
+    ASSERT_EQ(   a2.GetCount(), 3 );
+    ASSERT_EQ(   a3.GetCount(), 0 );
+    ASSERT_EQ(   a4.GetCount(), 1 );
+    ASSERT_TRUE( static_cast< CFMutableArrayRef >( a5 ) == nullptr );
+}
+
 TEST( CFPP_Array, GetTypeID )
 {
     CF::Array a;
@@ -739,6 +1020,99 @@ TEST( CFPP_Array, ExchangeValuesAtIndices )
     ASSERT_TRUE( CF::String( a1[ 1 ] ) == "hello, world" );
 }
 
+TEST( CFPP_Array, Sort )
+{
+    CF::Array            a1( { CF::String( "b" ), CF::String( "c" ), CF::String( "a" ) } );
+    CF::Array            a2( { CF::Number( 3 ), CF::Number( 1.5 ), CF::Number( 2 ) } );
+    CF::Array            a3( a1 );
+    CF::Array            a4( static_cast< CFArrayRef >( nullptr ) );
+    CFStringCompareFlags flags( kCFCompareCaseInsensitive );
+    
+    a1.Sort( CF::Array::CompareStrings );
+    a2.Sort( CF::Array::CompareNumbers );
+    a3.Sort( CF::Array::CompareStrings, &flags );
+    
+    ASSERT_NO_FATAL_FAILURE( a4.Sort( CF::Array::CompareStrings ) );
+    ASSERT_NO_FATAL_FAILURE( a1.Sort( nullptr ) );
+    
+    ASSERT_TRUE( CF::String( a1[ 0 ] ) == "a" );
+    ASSERT_TRUE( CF::String( a1[ 1 ] ) == "b" );
+    ASSERT_TRUE( CF::String( a1[ 2 ] ) == "c" );
+    ASSERT_TRUE( CF::String( a3[ 0 ] ) == "a" );
+    ASSERT_TRUE( CF::Number( a2[ 0 ] ) == 1.5 );
+    ASSERT_TRUE( CF::Number( a2[ 1 ] ) == 2 );
+    ASSERT_TRUE( CF::Number( a2[ 2 ] ) == 3 );
+    ASSERT_TRUE( a1.GetCFObject() != a3.GetCFObject() );
+}
+
+TEST( CFPP_Array, BinarySearch )
+{
+    CF::Array a1( std::vector< std::string >( { "d", "a", "c", "e" } ) );
+    CF::Array a2( std::vector< int >( { 1, 3, 5, 7 } ) );
+    CF::Array a3( static_cast< CFArrayRef >( nullptr ) );
+    
+    a1.Sort( CF::Array::CompareStrings );
+    
+    ASSERT_EQ( a1.BinarySearch( CF::String( "a" ), CF::Array::CompareStrings ), 0 );
+    ASSERT_EQ( a1.BinarySearch( CF::String( "d" ), CF::Array::CompareStrings ), 2 );
+    ASSERT_EQ( a1.BinarySearch( CF::String( "e" ), CF::Array::CompareStrings ), 3 );
+    ASSERT_EQ( a1.BinarySearch( CF::String( "b" ), CF::Array::CompareStrings ), kCFNotFound );
+    ASSERT_EQ( a1.BinarySearch( CF::String( "f" ), CF::Array::CompareStrings ), kCFNotFound );
+    ASSERT_EQ( a1.BinarySearch( nullptr,           CF::Array::CompareStrings ), kCFNotFound );
+    ASSERT_EQ( a1.BinarySearch( CF::String( "a" ), nullptr ),                   kCFNotFound );
+    
+    ASSERT_EQ( a2.BinarySearch( CF::Number( 5 ), CF::Array::CompareNumbers ), 2 );
+    ASSERT_EQ( a2.BinarySearch( CF::Number( 4 ), CF::Array::CompareNumbers ), kCFNotFound );
+    ASSERT_EQ( a3.BinarySearch( CF::Number( 4 ), CF::Array::CompareNumbers ), kCFNotFound );
+}
+
+TEST( CFPP_Array, CompareStrings )
+{
+    CFStringCompareFlags flags( kCFCompareCaseInsensitive );
+    
+    ASSERT_EQ( CF::Array::CompareStrings( CF::String( "a" ), CF::String( "b" ), nullptr ), kCFCompareLessThan );
+    ASSERT_EQ( CF::Array::CompareStrings( CF::String( "b" ), CF::String( "a" ), nullptr ), kCFCompareGreaterThan );
+    ASSERT_EQ( CF::Array::CompareStrings( CF::String( "a" ), CF::String( "a" ), &flags ),  kCFCompareEqualTo );
+    ASSERT_EQ( CF::Array::CompareStrings( nullptr,           CF::String( "a" ), nullptr ), kCFCompareLessThan );
+    ASSERT_EQ( CF::Array::CompareStrings( CF::String( "a" ), nullptr,           nullptr ), kCFCompareGreaterThan );
+    ASSERT_EQ( CF::Array::CompareStrings( nullptr,           nullptr,           nullptr ), kCFCompareEqualTo );
+}
+
+TEST( CFPP_Array, CompareNumbers )
+{
+    ASSERT_EQ( CF::Array::CompareNumbers( CF::Number( 1 ),   CF::Number( 2 ), nullptr ), kCFCompareLessThan );
+    ASSERT_EQ( CF::Array::CompareNumbers( CF::Number( 2.5 ), CF::Number( 2 ), nullptr ), kCFCompareGreaterThan );
+    ASSERT_EQ( CF::Array::CompareNumbers( CF::Number( 2 ),   CF::Number( 2 ), nullptr ), kCFCompareEqualTo );
+    ASSERT_EQ( CF::Array::CompareNumbers( nullptr,           CF::Number( 2 ), nullptr ), kCFCompareLessThan );
+    ASSERT_EQ( CF::Array::CompareNumbers( CF::Number( 2 ),   nullptr,         nullptr ), kCFCompareGreaterThan );
+}
+
+TEST( CFPP_Array, CopyOnWrite )
+{
+    CF::Array a1( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::Array a2( a1 );
+    CF::Array a3( a1 );
+    
+    ASSERT_TRUE( a1.GetCFObject() == a2.GetCFObject() );
+    ASSERT_TRUE( a1.GetCFObject() == a3.GetCFObject() );
+    
+    a2 << "universe";
+    a3.SetValueAtIndex( CF::String( "foo" ), 0 );
+    
+    ASSERT_TRUE( a1.GetCFObject() != a2.GetCFObject() );
+    ASSERT_TRUE( a1.GetCFObject() != a3.GetCFObject() );
+    ASSERT_EQ(   a1.GetCount(), 2 );
+    ASSERT_EQ(   a2.GetCount(), 3 );
+    ASSERT_EQ(   a3.GetCount(), 2 );
+    ASSERT_TRUE( CF::String( a1[ 0 ] ) == "hello" );
+    ASSERT_TRUE( CF::String( a3[ 0 ] ) == "foo" );
+    
+    a1 += a1;
+    
+    ASSERT_EQ(   a1.GetCount(), 4 );
+    ASSERT_TRUE( CF::String( a1[ 2 ] ) == "hello" );
+}
+
 TEST( CFPP_Array, Swap )
 {
     CF::Array a1;
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-ArrayIndex.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::ArrayIndex
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_ArrayIndex, CTOR )
+{
+    CF::ArrayIndex i;
+    
+    ASSERT_TRUE( i.GetArray().IsValid() );
+    ASSERT_EQ( i.GetCount(), 0 );
+    ASSERT_FALSE( i.ContainsValue( CF::String( "hello" ) ) );
+}
+
+TEST( CFPP_ArrayIndex, CTOR_Array )
+{
+    CF::Array      a( { CF::String( "hello" ), CF::String( "world" ), CF::String( "hello" ) } );
+    CF::ArrayIndex i1( a );
+    CF::ArrayIndex i2( CF::Array( static_cast< CFArrayRef >( nullptr ) ) );
+    
+    ASSERT_EQ( i1.GetCount(), 3 );
+    ASSERT_EQ( i2.GetCount(), 0 );
+    ASSERT_TRUE( i1.GetArray().GetCFObject() == a.GetCFObject() );
+    ASSERT_FALSE( i2.GetArray().IsValid() );
+}
+
+TEST( CFPP_ArrayIndex, CCTOR )
+{
+    CF::ArrayIndex i1( CF::Array( { CF::String( "hello" ) } ) );
+    CF::ArrayIndex i2( i1 );
+    
+    i2.AppendValue( CF::String( "world" ) );
+    
+    ASSERT_EQ( i1.GetCount(), 1 );
+    ASSERT_EQ( i2.GetCount(), 2 );
+    ASSERT_FALSE( i1.ContainsValue( CF::String( "world" ) ) );
+    ASSERT_TRUE(  i2.ContainsValue( CF::String( "world" ) ) );
+    ASSERT_TRUE(  i2.ContainsValue( CF::String( "hello" ) ) );
+}
+
+TEST( CFPP_ArrayIndex, MCTOR )
+{
+    CF::ArrayIndex i1( CF::Array( { CF::String( "hello" ) } ) );
+    CF::ArrayIndex i2( std::move( i1 ) );
+    
+    ASSERT_EQ( i2.GetCount(), 1 );
+    ASSERT_TRUE( i2.ContainsValue( CF::String( "hello" ) ) );
+}
+
+TEST( CFPP_ArrayIndex, OperatorAssign )
+{
+    CF::ArrayIndex i1( CF::Array( { CF::String( "hello" ) } ) );
+    CF::ArrayIndex i2;
+    
+    i2 = i1;
+    
+    ASSERT_EQ( i2.GetCount(), 1 );
+    ASSERT_TRUE( i2.ContainsValue( CF::String( "hello" ) ) );
+}
+
+TEST( CFPP_ArrayIndex, GetArray )
+{
+    CF::Array      a( { CF::String( "hello" ) } );
+    CF::ArrayIndex i( a );
+    
+    i.AppendValue( CF::String( "world" ) );
+    
+    ASSERT_EQ( a.GetCount(), 1 );
+    ASSERT_EQ( i.GetArray().GetCount(), 2 );
+    ASSERT_TRUE( CF::String( i.GetArray()[ 1 ] ) == "world" );
+}
+
+TEST( CFPP_ArrayIndex, GetCount )
+{
+    CF::ArrayIndex i( CF::Array( { CF::Number( 1 ), CF::Number( 2 ) } ) );
+    
+    ASSERT_EQ( i.GetCount(), 2 );
+    
+    i.AppendValue( CF::Number( 3 ) );
+    
+    ASSERT_EQ( i.GetCount(), 3 );
+}
+
+TEST( CFPP_ArrayIndex, ContainsValue )
+{
+    CF::ArrayIndex i( CF::Array( { CF::String( "hello" ), CF::Number( 42 ) } ) );
+    
+    ASSERT_TRUE(  i.ContainsValue( CF::String( "hello" ) ) );
+    ASSERT_TRUE(  i.ContainsValue( CF::Number( 42 ) ) );
+    ASSERT_FALSE( i.ContainsValue( CF::String( "world" ) ) );
+    ASSERT_FALSE( i.ContainsValue( CF::Number( 43 ) ) );
+    ASSERT_FALSE( i.ContainsValue( nullptr ) );
+}
+
+TEST( CFPP_ArrayIndex, GetIndexOfValue )
+{
+    CF::ArrayIndex i( CF::Array( std::vector< std::string >( { "a", "b", "a", "c" } ) ) );
+    
+    ASSERT_EQ( i.GetIndexOfValue( CF::String( "a" ) ), 0 );
+    ASSERT_EQ( i.GetIndexOfValue( CF::String( "b" ) ), 1 );
+    ASSERT_EQ( i.GetIndexOfValue( CF::String( "c" ) ), 3 );
+    ASSERT_EQ( i.GetIndexOfValue( CF::String( "d" ) ), kCFNotFound );
+    ASSERT_EQ( i.GetIndexOfValue( nullptr ),           kCFNotFound );
+}
+
+TEST( CFPP_ArrayIndex, AppendValue )
+{
+    CF::ArrayIndex i;
+    
+    i.AppendValue( CF::String( "hello" ) );
+    i.AppendValue( CF::String( "world" ) );
+    i.AppendValue( CF::String( "hello" ) );
+    i.AppendValue( nullptr );
+    
+    ASSERT_EQ( i.GetCount(), 3 );
+    ASSERT_EQ( i.GetIndexOfValue( CF::String( "hello" ) ), 0 );
+    ASSERT_EQ( i.GetIndexOfValue( CF::String( "world" ) ), 1 );
+}
+
+TEST( CFPP_ArrayIndex, Swap )
+{
+    CF::ArrayIndex i1( CF::Array( { CF::String( "hello" ) } ) );
+    CF::ArrayIndex i2;
+    
+    swap( i1, i2 );
+    
+    ASSERT_EQ( i1.GetCount(), 0 );
+    ASSERT_EQ( i2.GetCount(), 1 );
+    ASSERT_FALSE( i1.ContainsValue( CF::String( "hello" ) ) );
+    ASSERT_TRUE(  i2.ContainsValue( CF::String( "hello" ) ) );
+}
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-ArrayView.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::ArrayView
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_ArrayView, CTOR )
+{
+    CF::Array                    a( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::ArrayView< CFStringRef > v1( a );
+    CF::ArrayView< CFNumberRef > v2( a );
+    CF::ArrayView< CFTypeRef >   v3( a );
+    CF::ArrayView< CFStringRef > v4( CF::Array( static_cast< CFArrayRef >( nullptr ) ) );
+    CF::ArrayView< CFStringRef > v5( ( CF::Array() ) );
+    
+    ASSERT_TRUE(  v1.IsValid() );
+    ASSERT_FALSE( v2.IsValid() );
+    ASSERT_TRUE(  v3.IsValid() );
+    ASSERT_FALSE( v4.IsValid() );
+    ASSERT_TRUE(  v5.IsValid() );
+    
+    ASSERT_EQ( v1.GetCount(), 2 );
+    ASSERT_EQ( v2.GetCount(), 0 );
+    ASSERT_EQ( v3.GetCount(), 2 );
+    ASSERT_EQ( v4.GetCount(), 0 );
+    ASSERT_EQ( v5.GetCount(), 0 );
+}
+
+TEST( CFPP_ArrayView, CTOR_Unchecked )
+{
+    CF::Array                    a( { CF::String( "hello" ), CF::Number( 42 ) } );
+    CF::ArrayView< CFStringRef > v1( a );
+    CF::ArrayView< CFStringRef > v2( a, false );
+    
+    ASSERT_FALSE( v1.IsValid() );
+    ASSERT_TRUE(  v2.IsValid() );
+    ASSERT_EQ( v2.GetCount(), 2 );
+}
+
+TEST( CFPP_ArrayView, IsValid )
+{
+    CF::Array a( { CF::Number( 1 ), CF::Number( 2 ) } );
+    
+    ASSERT_TRUE(  CF::ArrayView< CFNumberRef >( a ).IsValid() );
+    ASSERT_FALSE( CF::ArrayView< CFStringRef >( a ).IsValid() );
+}
+
+TEST( CFPP_ArrayView, GetCount )
+{
+    CF::Array a( { CF::Number( 1 ), CF::Number( 2 ), CF::Number( 3 ) } );
+    
+    ASSERT_EQ( CF::ArrayView< CFNumberRef >( a ).GetCount(), 3 );
+    ASSERT_EQ( CF::ArrayView< CFStringRef >( a ).GetCount(), 0 );
+}
+
+TEST( CFPP_ArrayView, OperatorSubscript )
+{
+    CF::Array                    a( { CF::String( "hello" ), CF::String( "world" ) } );
+    CF::ArrayView< CFStringRef > v( a );
+    
+    ASSERT_TRUE( v[ 0 ] == a[ 0 ] );
+    ASSERT_TRUE( v[ 1 ] == a[ 1 ] );
+    ASSERT_TRUE( v[ 2 ] == nullptr );
+    ASSERT_TRUE( v[ -1 ] == nullptr );
+    
+    ASSERT_TRUE( CF::String( v[ 1 ] ) == "world" );
+}
+
+TEST( CFPP_ArrayView, GetArray )
+{
+    CF::Array                    a( { CF::String( "hello" ) } );
+    CF::ArrayView< CFStringRef > v( a );
+    
+    ASSERT_TRUE( v.GetArray().GetCFObject() == a.GetCFObject() );
+    
+    a << "world";
+    
+    ASSERT_EQ( a.GetCount(), 2 );
+    ASSERT_EQ( v.GetCount(), 1 );
+    ASSERT_EQ( v.GetArray().GetCount(), 1 );
+}
+
+TEST( CFPP_ArrayView, Iterator )
+{
+    CF::Array                    a( { CF::String( "hello" ), CF::String( "world" ), CF::String( "universe" ) } );
+    CF::ArrayView< CFStringRef > v( a );
+    CFIndex                      i( 0 );
+    
+    for( CFStringRef s: v )
+    {
+        ASSERT_TRUE( s == a[ static_cast< int >( i++ ) ] );
+    }
+    
+    ASSERT_EQ( i, 3 );
+    ASSERT_EQ( v.end() - v.begin(), 3 );
+    ASSERT_TRUE( CF::String( *( v.begin() + 2 ) ) == "universe" );
+    ASSERT_TRUE( std::find_if( v.begin(), v.end(), [ & ]( CFStringRef s ) { return CF::String( s ) == "world"; } ) == v.begin() + 1 );
+}
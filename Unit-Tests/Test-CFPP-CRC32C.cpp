@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-CRC32C.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::CRC32C
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Data __Digits()
+{
+    return CF::Data( std::string( "123456789" ) );
+}
+
+TEST( CFPP_CRC32C, CTOR )
+{
+    CF::CRC32C c;
+    
+    ASSERT_EQ( c.GetValue(), 0 );
+}
+
+TEST( CFPP_CRC32C, CCTOR )
+{
+    CF::CRC32C c1;
+    
+    c1.Update( __Digits() );
+    
+    {
+        CF::CRC32C c2( c1 );
+        
+        ASSERT_EQ( c2.GetValue(), 0xE3069283 );
+    }
+}
+
+TEST( CFPP_CRC32C, MCTOR )
+{
+    CF::CRC32C c1;
+    
+    c1.Update( __Digits() );
+    
+    {
+        CF::CRC32C c2( std::move( c1 ) );
+        
+        ASSERT_EQ( c1.GetValue(), 0 );
+        ASSERT_EQ( c2.GetValue(), 0xE3069283 );
+    }
+}
+
+TEST( CFPP_CRC32C, OperatorAssign )
+{
+    CF::CRC32C c1;
+    CF::CRC32C c2;
+    
+    c1.Update( __Digits() );
+    
+    c2 = c1;
+    
+    ASSERT_EQ( c2.GetValue(), 0xE3069283 );
+}
+
+TEST( CFPP_CRC32C, Compute )
+{
+    ASSERT_EQ( CF::CRC32C::Compute( __Digits() ),                                         0xE3069283 );
+    ASSERT_EQ( CF::CRC32C::Compute( CF::Data() ),                                         0 );
+    ASSERT_EQ( CF::CRC32C::Compute( CF::Data( static_cast< CFDataRef >( nullptr ) ) ),    0 );
+}
+
+TEST( CFPP_CRC32C, Compute_BytePtr )
+{
+    CF::Data::Byte b[ 32 ] = { 0 };
+    
+    /* RFC 3720 test vectors */
+    ASSERT_EQ( CF::CRC32C::Compute( b, sizeof( b ) ), 0x8A9136AA );
+    
+    std::fill( b, b + sizeof( b ), 0xFF );
+    
+    ASSERT_EQ( CF::CRC32C::Compute( b, sizeof( b ) ), 0x62A8AB43 );
+    ASSERT_EQ( CF::CRC32C::Compute( nullptr, 10 ),    0 );
+}
+
+TEST( CFPP_CRC32C, GetValue )
+{
+    CF::CRC32C c;
+    
+    ASSERT_EQ( c.GetValue(), 0 );
+    
+    c.Update( __Digits() );
+    
+    ASSERT_EQ( c.GetValue(), 0xE3069283 );
+    ASSERT_EQ( c.GetValue(), 0xE3069283 );
+}
+
+TEST( CFPP_CRC32C, Reset )
+{
+    CF::CRC32C c;
+    
+    c.Update( __Digits() );
+    c.Reset();
+    
+    ASSERT_EQ( c.GetValue(), 0 );
+    
+    c.Update( __Digits() );
+    
+    ASSERT_EQ( c.GetValue(), 0xE3069283 );
+}
+
+TEST( CFPP_CRC32C, Update )
+{
+    CF::CRC32C c;
+    
+    c.Update( CF::Data( std::string( "1234" ) ) );
+    c.Update( CF::Data() );
+    c.Update( CF::Data( std::string( "56789" ) ) );
+    
+    ASSERT_EQ( c.GetValue(), 0xE3069283 );
+}
+
+TEST( CFPP_CRC32C, Update_BytePtr )
+{
+    CF::Data   d;
+    CF::CRC32C c;
+    CFIndex    i;
+    
+    for( i = 0; i < 1000; i++ )
+    {
+        d += static_cast< CF::Data::Byte >( i * 7 );
+    }
+    
+    for( i = 0; i < d.GetLength(); i += 13 )
+    {
+        c.Update( d.GetBytePtr() + i, std::min< CFIndex >( 13, d.GetLength() - i ) );
+    }
+    
+    ASSERT_EQ( c.GetValue(), CF::CRC32C::Compute( d ) );
+}
+
+TEST( CFPP_CRC32C, Update_ReadStream )
+{
+    CF::ReadStream s1( "/etc/hosts" );
+    CF::ReadStream s2( "/etc/hosts" );
+    CF::ReadStream s3;
+    CF::CRC32C     c;
+    
+    ASSERT_TRUE(  s1.Open() );
+    ASSERT_TRUE(  c.Update( s1 ) );
+    ASSERT_TRUE(  s2.Open() );
+    ASSERT_EQ(    c.GetValue(), CF::CRC32C::Compute( s2.Read() ) );
+    ASSERT_FALSE( c.Update( s3 ) );
+    
+    s1.Close();
+    s2.Close();
+}
+
+TEST( CFPP_CRC32C, Swap )
+{
+    CF::CRC32C c1;
+    CF::CRC32C c2;
+    
+    c1.Update( __Digits() );
+    
+    swap( c1, c2 );
+    
+    ASSERT_EQ( c1.GetValue(), 0 );
+    ASSERT_EQ( c2.GetValue(), 0xE3069283 );
+}
@@ -260,6 +260,15 @@ TEST( CFPP_Data_Iterator, OperatorMinus )
     ASSERT_EQ( *( i - static_cast< CFIndex >( 2 ) ), 0xBE );
 }
 
+TEST( CFPP_Data_Iterator, OperatorMinusIterator )
+{
+    CF::Data d( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_EQ( d.end()   - d.begin(), 4 );
+    ASSERT_EQ( d.begin() - d.end(),  -4 );
+    ASSERT_EQ( d.begin() - d.begin(), 0 );
+}
+
 TEST( CFPP_Data_Iterator, OperatorEqual )
 {
     CF::Data           d1( __bytes, sizeof( __bytes ) );
@@ -332,6 +341,42 @@ TEST( CFPP_Data_Iterator, OperatorNotEqual )
     ASSERT_TRUE( i1 != i2 );
 }
 
+TEST( CFPP_Data_Iterator, OperatorLess )
+{
+    CF::Data d( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_TRUE(  d.begin() < d.end() );
+    ASSERT_FALSE( d.end()   < d.begin() );
+    ASSERT_FALSE( d.begin() < d.begin() );
+}
+
+TEST( CFPP_Data_Iterator, OperatorGreater )
+{
+    CF::Data d( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_TRUE(  d.end()   > d.begin() );
+    ASSERT_FALSE( d.begin() > d.end() );
+    ASSERT_FALSE( d.begin() > d.begin() );
+}
+
+TEST( CFPP_Data_Iterator, OperatorLessOrEqual )
+{
+    CF::Data d( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_TRUE(  d.begin() <= d.end() );
+    ASSERT_FALSE( d.end()   <= d.begin() );
+    ASSERT_TRUE(  d.begin() <= d.begin() );
+}
+
+TEST( CFPP_Data_Iterator, OperatorGreaterOrEqual )
+{
+    CF::Data d( __bytes, sizeof( __bytes ) );
+    
+    ASSERT_TRUE(  d.end()   >= d.begin() );
+    ASSERT_FALSE( d.begin() >= d.end() );
+    ASSERT_TRUE(  d.begin() >= d.begin() );
+}
+
 TEST( CFPP_Data_Iterator, OperatorDereference )
 {
     CF::Data           d1( __bytes, sizeof( __bytes ) );
@@ -355,6 +400,21 @@ TEST( CFPP_Data_Iterator, OperatorDereference )
     ASSERT_EQ( *( i2 ), 0x00 );
 }
 
+TEST( CFPP_Data_Iterator, OperatorSubscript )
+{
+    CF::Data           d( __bytes, sizeof( __bytes ) );
+    CF::Data::Iterator i;
+    
+    ASSERT_EQ( i[ 0 ], 0x00 );
+    
+    i = d.begin() + static_cast< CFIndex >( 1 );
+    
+    ASSERT_EQ( i[ -1 ], 0xDE );
+    ASSERT_EQ( i[  0 ], 0xAD );
+    ASSERT_EQ( i[  2 ], 0xEF );
+    ASSERT_EQ( i[  3 ], 0x00 );
+}
+
 TEST( CFPP_Data_Iterator, OperatorCastToByte )
 {
     CF::Data           d1( __bytes, sizeof( __bytes ) );
@@ -496,6 +556,29 @@ TEST( CFPP_Data_Iterator, TestIterateSTD )
     }
 }
 
+TEST( CFPP_Data_Iterator, TestRandomAccessSTD )
+{
+    CF::Data                      d( __bytes, sizeof( __bytes ) );
+    CF::Data                      n( { 0xBE, 0xEF } );
+    CF::Data::Iterator            it;
+    std::vector< CF::Data::Byte > v;
+    
+    ASSERT_EQ( std::distance( d.begin(), d.end() ), 4 );
+    
+    it = std::search( d.begin(), d.end(), n.begin(), n.end() );
+    
+    ASSERT_EQ( it - d.begin(), 2 );
+    
+    it = std::lower_bound( n.begin(), n.end(), static_cast< CF::Data::Byte >( 0xEF ) );
+    
+    ASSERT_EQ( it - n.begin(), 1 );
+    
+    v = std::vector< CF::Data::Byte >( d.begin(), d.end() );
+    
+    ASSERT_EQ( v.size(), 4 );
+    ASSERT_EQ( v[ 3 ], 0xEF );
+}
+
 TEST( CFPP_Data_Iterator, TestIterateCPP11 )
 {
     CF::Data d1;
@@ -548,3 +631,20 @@ TEST( CFPP_Data_Iterator, TestIterateCPP11 )
         ASSERT_EQ( i, 4 );
     }
 }
+
+TEST( CFPP_Data_Iterator, NoCopyOnWrite )
+{
+    CF::Data           d( __bytes, sizeof( __bytes ) );
+    CF::Data::Iterator i;
+    CFTypeRef          o;
+    
+    d.AppendBytes( __bytes, sizeof( __bytes ) );
+    
+    o = d.GetCFObject();
+    i = d.begin();
+    
+    d.GetMutableBytePtr()[ 0 ] = 0x42;
+    
+    ASSERT_TRUE( d.GetCFObject() == o );
+    ASSERT_EQ(   d[ 0 ], 0x42 );
+}
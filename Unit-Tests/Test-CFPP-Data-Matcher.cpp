@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-Data-Matcher.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::Data::Matcher
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_Data_Matcher, CTOR )
+{
+    CF::Data::Matcher m;
+    
+    ASSERT_EQ( m.GetPatternCount(), 0 );
+    ASSERT_EQ( m.FindAll( CF::Data( std::string( "hello" ) ) ).size(), 0 );
+}
+
+TEST( CFPP_Data_Matcher, CTOR_STDVector )
+{
+    std::vector< CF::Data > p( { CF::Data( std::string( "foo" ) ), CF::Data( std::string( "bar" ) ) } );
+    CF::Data::Matcher       m( p );
+    
+    ASSERT_EQ( m.GetPatternCount(), 2 );
+}
+
+TEST( CFPP_Data_Matcher, CTOR_STDInitializerList )
+{
+    CF::Data::Matcher m( { CF::Data( std::string( "foo" ) ), CF::Data( std::string( "bar" ) ), CF::Data( std::string( "" ) ) } );
+    
+    ASSERT_EQ( m.GetPatternCount(), 3 );
+}
+
+TEST( CFPP_Data_Matcher, CCTOR )
+{
+    CF::Data::Matcher m1( { CF::Data( std::string( "foo" ) ) } );
+    CF::Data::Matcher m2( m1 );
+    
+    ASSERT_EQ( m1.GetPatternCount(), 1 );
+    ASSERT_EQ( m2.GetPatternCount(), 1 );
+    ASSERT_EQ( m2.FindAll( CF::Data( std::string( "afoo" ) ) ).size(), 1 );
+}
+
+TEST( CFPP_Data_Matcher, MCTOR )
+{
+    CF::Data::Matcher m1( { CF::Data( std::string( "foo" ) ) } );
+    CF::Data::Matcher m2( std::move( m1 ) );
+    
+    ASSERT_EQ( m2.GetPatternCount(), 1 );
+    ASSERT_EQ( m2.FindAll( CF::Data( std::string( "afoo" ) ) ).size(), 1 );
+}
+
+TEST( CFPP_Data_Matcher, OperatorAssign )
+{
+    CF::Data::Matcher m1( { CF::Data( std::string( "foo" ) ) } );
+    CF::Data::Matcher m2;
+    
+    m2 = m1;
+    
+    ASSERT_EQ( m2.GetPatternCount(), 1 );
+    ASSERT_EQ( m2.FindAll( CF::Data( std::string( "afoo" ) ) ).size(), 1 );
+}
+
+TEST( CFPP_Data_Matcher, GetPatternCount )
+{
+    CF::Data::Matcher m1;
+    CF::Data::Matcher m2( { CF::Data( std::string( "a" ) ), CF::Data( std::string( "b" ) ) } );
+    
+    ASSERT_EQ( m1.GetPatternCount(), 0 );
+    ASSERT_EQ( m2.GetPatternCount(), 2 );
+}
+
+TEST( CFPP_Data_Matcher, FindAll )
+{
+    CF::Data::Matcher                       m( { CF::Data( std::string( "he" ) ), CF::Data( std::string( "she" ) ), CF::Data( std::string( "his" ) ), CF::Data( std::string( "hers" ) ) } );
+    std::vector< CF::Data::Matcher::Match > r;
+    
+    r = m.FindAll( CF::Data( std::string( "ushers" ) ) );
+    
+    ASSERT_EQ( r.size(), 3 );
+    
+    ASSERT_EQ( r[ 0 ].range.location, 1 );
+    ASSERT_EQ( r[ 0 ].range.length,   3 );
+    ASSERT_EQ( r[ 0 ].pattern,        1 );
+    ASSERT_EQ( r[ 1 ].range.location, 2 );
+    ASSERT_EQ( r[ 1 ].range.length,   2 );
+    ASSERT_EQ( r[ 1 ].pattern,        0 );
+    ASSERT_EQ( r[ 2 ].range.location, 2 );
+    ASSERT_EQ( r[ 2 ].range.length,   4 );
+    ASSERT_EQ( r[ 2 ].pattern,        3 );
+    
+    ASSERT_EQ( m.FindAll( CF::Data( std::string( "xyz" ) ) ).size(), 0 );
+    ASSERT_EQ( m.FindAll( CF::Data( static_cast< CFDataRef >( nullptr ) ) ).size(), 0 );
+}
+
+TEST( CFPP_Data_Matcher, FindAll_BytePtr )
+{
+    CF::Data::Byte                          b[] = { 0x00, 0xFF, 0x00, 0xFF, 0x00 };
+    CF::Data::Matcher                       m( { CF::Data( { 0xFF, 0x00 } ), CF::Data( { 0x00, 0xFF, 0x00 } ) } );
+    std::vector< CF::Data::Matcher::Match > r;
+    
+    r = m.FindAll( b, sizeof( b ) );
+    
+    ASSERT_EQ( r.size(), 4 );
+    ASSERT_EQ( r[ 0 ].range.location, 0 );
+    ASSERT_EQ( r[ 0 ].pattern,        1 );
+    ASSERT_EQ( r[ 1 ].range.location, 1 );
+    ASSERT_EQ( r[ 1 ].pattern,        0 );
+    ASSERT_EQ( r[ 2 ].range.location, 2 );
+    ASSERT_EQ( r[ 2 ].pattern,        1 );
+    ASSERT_EQ( r[ 3 ].range.location, 3 );
+    ASSERT_EQ( r[ 3 ].pattern,        0 );
+    
+    ASSERT_EQ( m.FindAll( nullptr, 10 ).size(), 0 );
+}
+
+TEST( CFPP_Data_Matcher, Swap )
+{
+    CF::Data::Matcher m1( { CF::Data( std::string( "foo" ) ) } );
+    CF::Data::Matcher m2;
+    
+    swap( m1, m2 );
+    
+    ASSERT_EQ( m1.GetPatternCount(), 0 );
+    ASSERT_EQ( m2.GetPatternCount(), 1 );
+}
@@ -159,6 +159,247 @@ TEST( CFPP_Data, MCTOR )
     ASSERT_FALSE( d4.IsValid() );
 }
 
+TEST( CFPP_Data, Share )
+{
+    CF::AutoPointer ap( CFDataCreate( nullptr, __bytes, sizeof( __bytes ) ) );
+    CF::Data        d1( CF::Data::Share( ap.As< CFDataRef >() ) );
+    CF::Data        d2( CF::Data::Share( nullptr ) );
+    
+    ASSERT_TRUE(  d1.IsValid() );
+    ASSERT_FALSE( d2.IsValid() );
+    ASSERT_TRUE(  d1.GetCFObject() == ap.GetCFObject() );
+    ASSERT_EQ(    d1.GetLength(), 4 );
+    
+    d1 += static_cast< CF::Data::Byte >( 0x42 );
+    
+    ASSERT_TRUE(  d1.GetCFObject() != ap.GetCFObject() );
+    ASSERT_EQ(    d1.GetLength(), 5 );
+    ASSERT_EQ(    CFDataGetLength( ap.As< CFDataRef >() ), 4 );
+}
+
+TEST( CFPP_Data, Adopt )
+{
+    CFDataRef data;
+    CF::Data  d1;
+    CF::Data  d2( CF::Data::Adopt( nullptr ) );
+    
+    data = CFDataCreate( nullptr, __bytes, sizeof( __bytes ) );
+    d1   = CF::Data::Adopt( data );
+    
+    ASSERT_TRUE(  d1.IsValid() );
+    ASSERT_FALSE( d2.IsValid() );
+    ASSERT_TRUE(  d1.GetCFObject() == data );
+    ASSERT_EQ(    d1.GetRetainCount(), 1 );
+    ASSERT_TRUE(  d1[ 0 ] == 0xDE );
+    
+    d1.GetMutableBytePtr()[ 0 ] = 0x42;
+    
+    ASSERT_TRUE(  d1[ 0 ] == 0x42 );
+    ASSERT_EQ(    d1.GetLength(), 4 );
+}
+
+TEST( CFPP_Data, NoCopy )
+{
+    CF::Data d1( CF::Data::NoCopy( __bytes, sizeof( __bytes ) ) );
+    CF::Data d2( CF::Data::NoCopy( nullptr, 0 ) );
+    
+    ASSERT_TRUE( d1.IsValid() );
+    ASSERT_TRUE( d2.IsValid() );
+    ASSERT_TRUE( d1.GetBytePtr() == __bytes );
+    ASSERT_EQ(   d1.GetLength(), 4 );
+    ASSERT_EQ(   d2.GetLength(), 0 );
+    
+    d1.GetMutableBytePtr()[ 0 ] = 0x42;
+    
+    ASSERT_TRUE( d1.GetBytePtr() != __bytes );
+    ASSERT_TRUE( d1[ 0 ] == 0x42 );
+    ASSERT_TRUE( __bytes[ 0 ] == 0xDE );
+}
+
+TEST( CFPP_Data, NoCopy_Deallocator )
+{
+    CF::Data::Byte       * bytes;
+    const CF::Data::Byte * released;
+    CFIndex                length;
+    
+    bytes    = new CF::Data::Byte[ 4 ] { 0xDE, 0xAD, 0xBE, 0xEF };
+    released = nullptr;
+    length   = 0;
+    
+    {
+        CF::Data d
+        (
+            CF::Data::NoCopy
+            (
+                bytes,
+                4,
+                [ & ]( const CF::Data::Byte * p, CFIndex n )
+                {
+                    released = p;
+                    length   = n;
+                    
+                    delete[] p;
+                }
+            )
+        );
+        
+        ASSERT_TRUE( d.IsValid() );
+        ASSERT_TRUE( d[ 3 ] == 0xEF );
+    }
+    
+    ASSERT_TRUE( released == bytes );
+    ASSERT_EQ(   length, 4 );
+}
+
+TEST( CFPP_Data, NoCopy_STDVector )
+{
+    std::vector< CF::Data::Byte > v( __bytes, __bytes + sizeof( __bytes ) );
+    const CF::Data::Byte        * p( v.data() );
+    CF::Data                      d1( CF::Data::NoCopy( std::move( v ) ) );
+    CF::Data                      d2( CF::Data::NoCopy( std::vector< CF::Data::Byte >() ) );
+    
+    ASSERT_TRUE( d1.IsValid() );
+    ASSERT_TRUE( d2.IsValid() );
+    ASSERT_TRUE( d1.GetBytePtr() == p );
+    ASSERT_EQ(   d1.GetLength(), 4 );
+    ASSERT_EQ(   d2.GetLength(), 0 );
+    ASSERT_TRUE( d1[ 1 ] == 0xAD );
+}
+
+TEST( CFPP_Data, MapFile )
+{
+    CF::WriteStream s( std::string( "/tmp/com.xs-labs.cfpp-map" ) );
+    CF::Data        d1;
+    CF::Data        d2;
+    CF::Data        d3;
+    CF::Data        d4;
+    
+    ASSERT_TRUE( s.Open() );
+    ASSERT_EQ(   s.Write( __bytes, sizeof( __bytes ) ), 4 );
+    
+    s.Close();
+    
+    d1 = CF::Data::MapFile( "/tmp/com.xs-labs.cfpp-map" );
+    d2 = CF::Data::MapFile( "/tmp/com.xs-labs.cfpp-map", CF::Data::AccessRandom );
+    d3 = CF::Data::MapFile( "/foo/bar" );
+    d4 = CF::Data::MapFile( "" );
+    
+    ASSERT_TRUE(  d1.IsValid() );
+    ASSERT_TRUE(  d2.IsValid() );
+    ASSERT_FALSE( d3.IsValid() );
+    ASSERT_FALSE( d4.IsValid() );
+    ASSERT_EQ(    d1.GetLength(), 4 );
+    ASSERT_TRUE(  d1[ 0 ] == 0xDE );
+    ASSERT_TRUE(  d2[ 3 ] == 0xEF );
+    
+    d1 += static_cast< CF::Data::Byte >( 0x42 );
+    
+    ASSERT_EQ( d1.GetLength(), 5 );
+    ASSERT_EQ( d2.GetLength(), 4 );
+}
+
+TEST( CFPP_Data, MapFile_URL )
+{
+    CF::Data d1( CF::Data::MapFile( CF::URL::FileSystemURL( "/System/Library/Frameworks/CoreFoundation.framework/Versions/A/Resources/Info.plist" ), CF::Data::AccessSequential ) );
+    CF::Data d2( CF::Data::MapFile( CF::URL() ) );
+    
+    ASSERT_TRUE(  d1.IsValid() );
+    ASSERT_FALSE( d2.IsValid() );
+    ASSERT_GT(    d1.GetLength(), 0 );
+    ASSERT_TRUE(  CF::Dictionary::FromPropertyListData( d1 ).IsValid() );
+}
+
+TEST( CFPP_Data, FromHex )
+{
+    CF::Data d1( CF::Data::FromHex( CF::String( "00deadBEEF7f" ) ) );
+    CF::Data d2( CF::Data::FromHex( CF::String( "abc" ) ) );
+    CF::Data d3( CF::Data::FromHex( CF::String( "0g" ) ) );
+    CF::Data d4( CF::Data::FromHex( CF::String( nullptr ) ) );
+    CF::Data d5( CF::Data::FromHex( CF::String( "" ) ) );
+    
+    ASSERT_TRUE(  d1 == CF::Data( { 0x00, 0xDE, 0xAD, 0xBE, 0xEF, 0x7F } ) );
+    ASSERT_FALSE( d2.IsValid() );
+    ASSERT_FALSE( d3.IsValid() );
+    ASSERT_FALSE( d4.IsValid() );
+    ASSERT_TRUE(  d5.IsValid() );
+    ASSERT_EQ(    d5.GetLength(), 0 );
+}
+
+TEST( CFPP_Data, FromHex_STDString )
+{
+    std::string s;
+    CF::Data    d;
+    
+    for( int i = 0; i < 200; i++ )
+    {
+        s += "0123456789abcdefABCDEF"[ i % 22 ];
+    }
+    
+    d = CF::Data::FromHex( s );
+    
+    ASSERT_TRUE( d.IsValid() );
+    ASSERT_EQ(   d.GetLength(), 100 );
+    ASSERT_EQ(   d.GetBytePtr()[ 0 ],  0x01 );
+    ASSERT_EQ(   d.GetBytePtr()[ 10 ], 0xEF );
+    ASSERT_EQ(   d.GetBytePtr()[ 99 ], 0x01 );
+    
+    /* Invalid digit past the first vector blocks */
+    s[ 150 ] = 'x';
+    
+    ASSERT_FALSE( CF::Data::FromHex( s ).IsValid() );
+}
+
+TEST( CFPP_Data, FromHex_CChar )
+{
+    CF::Data d1( CF::Data::FromHex( "0102" ) );
+    CF::Data d2( CF::Data::FromHex( static_cast< const char * >( nullptr ) ) );
+    
+    ASSERT_TRUE(  d1 == CF::Data( { 0x01, 0x02 } ) );
+    ASSERT_FALSE( d2.IsValid() );
+}
+
+TEST( CFPP_Data, FromBase64 )
+{
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "" ) )         == CF::Data( std::string( "" ) ) );
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "Zg==" ) )     == CF::Data( std::string( "f" ) ) );
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "Zm8=" ) )     == CF::Data( std::string( "fo" ) ) );
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "Zm9v" ) )     == CF::Data( std::string( "foo" ) ) );
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "Zm9vYg==" ) ) == CF::Data( std::string( "foob" ) ) );
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "Zm9vYmE=" ) ) == CF::Data( std::string( "fooba" ) ) );
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "Zm9vYmFy" ) ) == CF::Data( std::string( "foobar" ) ) );
+    ASSERT_TRUE(  CF::Data::FromBase64( CF::String( "Zm9vYg" ) )   == CF::Data( std::string( "foob" ) ) );
+    ASSERT_FALSE( CF::Data::FromBase64( CF::String( "Zm9vY" ) ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromBase64( CF::String( "Zg=" ) ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromBase64( CF::String( "Zg==Zg==" ) ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromBase64( CF::String( "Zm9v-mFy" ) ).IsValid() );
+    ASSERT_FALSE( CF::Data::FromBase64( CF::String( nullptr ) ).IsValid() );
+}
+
+TEST( CFPP_Data, FromBase64_STDString )
+{
+    std::string s;
+    CF::Data    d;
+    
+    /* Plist-style <data> block */
+    s = "\n\tTG9yZW0gaXBzdW0gZG9sb3Igc2l0IGFtZXQsIGNvbnNlY3RldHVyIGFkaXBpc2Np\n\tbmcgZWxpdC4=\n";
+    d = CF::Data::FromBase64( s );
+    
+    ASSERT_TRUE( d == CF::Data( std::string( "Lorem ipsum dolor sit amet, consectetur adipiscing elit." ) ) );
+    
+    s[ 40 ] = '*';
+    
+    ASSERT_FALSE( CF::Data::FromBase64( s ).IsValid() );
+}
+
+TEST( CFPP_Data, FromBase64_CChar )
+{
+    CF::Data d1( CF::Data::FromBase64( "AQI=" ) );
+    CF::Data d2( CF::Data::FromBase64( static_cast< const char * >( nullptr ) ) );
+    
+    ASSERT_TRUE(  d1 == CF::Data( { 0x01, 0x02 } ) );
+    ASSERT_FALSE( d2.IsValid() );
+}
+
 TEST( CFPP_Data, OperatorAssignData )
 {
     CF::Data d1( __bytes, sizeof( __bytes ) );
@@ -328,6 +569,42 @@ TEST( CFPP_Data, CastToSTDString )
     ASSERT_TRUE( static_cast< std::string >( d3 ) == "" );
 }
 
+TEST( CFPP_Data, CastToCFMutableDataRef )
+{
+    CF::WriteStream s( std::string( "/tmp/com.xs-labs.cfpp-map-cast" ) );
+    CF::Data        d1( __bytes, sizeof( __bytes ) );
+    CF::Data        d2( d1 );
+    CF::Data        d3( d1 );
+    CF::Data        d4( static_cast< CFDataRef >( nullptr ) );
+    CF::Data        d5;
+    CF::Type      & t( d3 );
+    
+    CFDataAppendBytes( d2, __bytes, sizeof( __bytes ) );
+    CFDataSetLength( static_cast< CFMutableDataRef >( t ), 0 );
+    
+    ASSERT_TRUE( d1.GetCFObject() != d2.GetCFObject() );
+    ASSERT_TRUE( d1.GetCFObject() != d3.GetCFObject() );
+    ASSERT_EQ(   d1.GetLength(), 4 );
+    ASSERT_EQ(   d2.GetLength(), 8 );
+    ASSERT_EQ(   d3.GetLength(), 0 );
+    ASSERT_TRUE( d1[ 0 ] == 0xDE );
+    ASSERT_TRUE( static_cast< CFMutableDataRef >( d4 ) == nullptr );
+    
+    ASSERT_TRUE( s.Open() );
+    ASSERT_EQ(   s.Write( __bytes, sizeof( __bytes ) ), 4 );
+    
+    s.Close();
+    
+    d5 = CF::Data::MapFile( "/tmp/com.xs-labs.cfpp-map-cast" );
+    
+    ASSERT_TRUE( d5.IsValid() );
+    
+    CFDataGetMutableBytePtr( d5 )[ 0 ] = 0x42;
+    
+    ASSERT_TRUE( d5[ 0 ] == 0x42 );
+    ASSERT_TRUE( CF::Data::MapFile( "/tmp/com.xs-labs.cfpp-map-cast" )[ 0 ] == 0xDE );
+}
+
 TEST( CFPP_Data, OperatorSubscript )
 {
     CF::Data d1;
@@ -725,6 +1002,266 @@ TEST( CFPP_Data, Find )
     ASSERT_TRUE( r.location == kCFNotFound );
 }
 
+TEST( CFPP_Data, Find_Offset )
+{
+    CFRange  r;
+    CF::Data d1( std::string( "hello, world, hello, universe" ) );
+    CF::Data d2( static_cast< CFDataRef >( nullptr ) );
+    
+    r = d1.Find( std::string( "hello" ) );
+    
+    ASSERT_EQ( r.location, 0 );
+    ASSERT_EQ( r.length,   5 );
+    
+    r = d1.Find( std::string( "hello" ), 1 );
+    
+    ASSERT_EQ( r.location, 14 );
+    ASSERT_EQ( r.length,   5 );
+    
+    ASSERT_EQ( d1.Find( std::string( "verse" ) ).location, 24 );
+    ASSERT_EQ( d1.Find( std::string( "foo" ) ).location,   kCFNotFound );
+    ASSERT_EQ( d1.Find( std::string( "" ) ).location,      kCFNotFound );
+    ASSERT_EQ( d1.Find( std::string( "hello" ), 100 ).location, kCFNotFound );
+    ASSERT_EQ( d2.Find( std::string( "hello" ) ).location,      kCFNotFound );
+}
+
+TEST( CFPP_Data, Find_BytePtr )
+{
+    CF::Data       d( std::string( 1000, 'a' ) + "needle" + std::string( 1000, 'a' ) );
+    CF::Data::Byte b[] = { 'n', 'e', 'e', 'd', 'l', 'e' };
+    
+    ASSERT_EQ( d.Find( b, sizeof( b ) ).location,       1000 );
+    ASSERT_EQ( d.Find( b, sizeof( b ) ).length,         6 );
+    ASSERT_EQ( d.Find( b, sizeof( b ), 1001 ).location, kCFNotFound );
+    ASSERT_EQ( d.Find( b, 1 ).location,                 1000 );
+    ASSERT_EQ( d.Find( nullptr, 1 ).location,           kCFNotFound );
+}
+
+TEST( CFPP_Data, FindAll )
+{
+    CF::Data               d1( std::string( "aaaa, aa" ) );
+    CF::Data               d2( static_cast< CFDataRef >( nullptr ) );
+    std::vector< CFIndex > r;
+    
+    r = d1.FindAll( std::string( "aa" ) );
+    
+    ASSERT_EQ( r.size(), 3 );
+    ASSERT_EQ( r[ 0 ], 0 );
+    ASSERT_EQ( r[ 1 ], 2 );
+    ASSERT_EQ( r[ 2 ], 6 );
+    
+    r = d1.FindAll( std::string( "aa" ), true );
+    
+    ASSERT_EQ( r.size(), 4 );
+    ASSERT_EQ( r[ 1 ], 1 );
+    
+    ASSERT_EQ( d1.FindAll( std::string( "" ) ).size(),    0 );
+    ASSERT_EQ( d2.FindAll( std::string( "aa" ) ).size(),  0 );
+}
+
+TEST( CFPP_Data, FindAll_BytePtr )
+{
+    CF::Data               d( { 0xDE, 0xAD, 0xBE, 0xEF, 0xDE, 0xAD } );
+    CF::Data::Byte         b[] = { 0xDE, 0xAD };
+    std::vector< CFIndex > r;
+    
+    r = d.FindAll( b, sizeof( b ) );
+    
+    ASSERT_EQ( r.size(), 2 );
+    ASSERT_EQ( r[ 0 ], 0 );
+    ASSERT_EQ( r[ 1 ], 4 );
+}
+
+TEST( CFPP_Data, ToHex )
+{
+    CF::Data    d1( { 0x00, 0xDE, 0xAD, 0xBE, 0xEF, 0x7F } );
+    CF::Data    d2;
+    CF::Data    d3( static_cast< CFDataRef >( nullptr ) );
+    CF::Data    d4;
+    std::string s;
+    
+    ASSERT_EQ( d1.ToHex(),       "00deadbeef7f" );
+    ASSERT_EQ( d1.ToHex( true ), "00DEADBEEF7F" );
+    ASSERT_EQ( d2.ToHex(),       "" );
+    ASSERT_EQ( d3.ToHex(),       "" );
+    
+    /* Long enough for the vectorized paths, with a scalar tail */
+    for( int i = 0; i < 100; i++ )
+    {
+        d4 += static_cast< CF::Data::Byte >( i * 37 );
+    }
+    
+    s = d4.ToHex();
+    
+    ASSERT_EQ(   s.length(), 200 );
+    ASSERT_EQ(   s.substr( 0, 8 ), "00254a6f" );
+    ASSERT_TRUE( CF::Data::FromHex( s ) == d4 );
+}
+
+TEST( CFPP_Data, ToBase64 )
+{
+    CF::Data    d1( std::string( "foobar" ) );
+    CF::Data    d2( std::string( "fooba" ) );
+    CF::Data    d3( std::string( "foob" ) );
+    CF::Data    d4;
+    CF::Data    d5;
+    std::string s;
+    
+    ASSERT_EQ( d1.ToBase64(), "Zm9vYmFy" );
+    ASSERT_EQ( d2.ToBase64(), "Zm9vYmE=" );
+    ASSERT_EQ( d3.ToBase64(), "Zm9vYg==" );
+    ASSERT_EQ( d4.ToBase64(), "" );
+    
+    for( int i = 0; i < 100; i++ )
+    {
+        d5 += static_cast< CF::Data::Byte >( i * 37 );
+    }
+    
+    s = d5.ToBase64();
+    
+    ASSERT_EQ(   s.length(), 136 );
+    ASSERT_EQ(   s.substr( 0, 8 ), "ACVKb5S5" );
+    ASSERT_EQ(   s.substr( 132 ), "Tw==" );
+    ASSERT_TRUE( CF::Data::FromBase64( s ) == d5 );
+}
+
+TEST( CFPP_Data, Compress )
+{
+    CF::Data d1( std::string( "hello, world" ) );
+    CF::Data d2;
+    CF::Data d3( nullptr );
+    
+    for( int i = 0; i < 65536; i++ )
+    {
+        d2 += static_cast< CF::Data::Byte >( i % 7 );
+    }
+    
+    #ifdef CFPP_ZLIB
+    
+    ASSERT_TRUE(  d1.Compress().IsValid() );
+    ASSERT_EQ(    d1.Compress()[ 0 ], 0x78 );
+    ASSERT_EQ(    d1.Compress( CF::Data::CompressionGzip )[ 0 ], 0x1F );
+    ASSERT_EQ(    d1.Compress( CF::Data::CompressionGzip )[ 1 ], 0x8B );
+    ASSERT_TRUE(  d1.Compress().Decompress() == d1 );
+    ASSERT_TRUE(  d1.Compress( CF::Data::CompressionGzip ).Decompress() == d1 );
+    ASSERT_TRUE(  d1.Compress( CF::Data::CompressionDeflate ).Decompress( CF::Data::CompressionDeflate ) == d1 );
+    ASSERT_TRUE(  d2.Compress( CF::Data::CompressionZlib, 9 ).GetLength() < d2.GetLength() / 10 );
+    ASSERT_TRUE(  d2.Compress( CF::Data::CompressionZlib, 0 ).GetLength() > d2.GetLength() );
+    ASSERT_TRUE(  d2.Compress( CF::Data::CompressionZlib, 1 ).Decompress() == d2 );
+    ASSERT_TRUE(  CF::Data().Compress().Decompress().IsValid() );
+    ASSERT_EQ(    CF::Data().Compress().Decompress().GetLength(), 0 );
+    ASSERT_FALSE( d1.Compress( CF::Data::CompressionZlib, 42 ).IsValid() );
+    ASSERT_FALSE( d3.Compress().IsValid() );
+    
+    #else
+    
+    ASSERT_FALSE( d1.Compress().IsValid() );
+    ASSERT_FALSE( d2.Compress().IsValid() );
+    
+    #endif
+}
+
+TEST( CFPP_Data, Decompress )
+{
+    CF::Data s( std::string( "hello, world" ) );
+    CF::Data d1( { 0x78, 0x9C, 0xCB, 0x48, 0xCD, 0xC9, 0xC9, 0xD7, 0x51, 0x28, 0xCF, 0x2F, 0xCA, 0x49, 0x01, 0x00, 0x1D, 0x54, 0x04, 0x89 } );
+    CF::Data d2( { 0xCB, 0x48, 0xCD, 0xC9, 0xC9, 0xD7, 0x51, 0x28, 0xCF, 0x2F, 0xCA, 0x49, 0x01, 0x00 } );
+    CF::Data d3
+    (
+        {
+            0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCB, 0x48, 0xCD, 0xC9, 0xC9, 0xD7,
+            0x51, 0x00, 0x00, 0x99, 0x56, 0xEA, 0x11, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0x08, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x02, 0x03, 0x2B, 0xCF, 0x2F, 0xCA, 0x49, 0x01, 0x00, 0x43, 0x11, 0x77, 0x3A,
+            0x05, 0x00, 0x00, 0x00
+        }
+    );
+    CF::Data d4( d1.GetBytePtr(), d1.GetLength() - 4 );
+    CF::Data d5( d1 );
+    CF::Data d6( d1 );
+    
+    d5.GetMutableBytePtr()[ 17 ] ^= 0xFF;
+    d6                           += s;
+    
+    #ifdef CFPP_ZLIB
+    
+    ASSERT_TRUE(  d1.Decompress() == s );
+    ASSERT_TRUE(  d1.Decompress( CF::Data::CompressionGzip ) == s );
+    ASSERT_TRUE(  d2.Decompress( CF::Data::CompressionDeflate ) == s );
+    ASSERT_TRUE(  d3.Decompress( CF::Data::CompressionGzip ) == s );
+    ASSERT_TRUE(  d3.Decompress() == s );
+    ASSERT_FALSE( d2.Decompress().IsValid() );
+    ASSERT_FALSE( d4.Decompress().IsValid() );
+    ASSERT_FALSE( d5.Decompress().IsValid() );
+    ASSERT_FALSE( d6.Decompress().IsValid() );
+    ASSERT_FALSE( d6.Decompress( CF::Data::CompressionGzip ).IsValid() );
+    ASSERT_FALSE( s.Decompress().IsValid() );
+    ASSERT_FALSE( CF::Data().Decompress().IsValid() );
+    
+    #else
+    
+    ASSERT_FALSE( d1.Decompress().IsValid() );
+    ASSERT_FALSE( d2.Decompress( CF::Data::CompressionDeflate ).IsValid() );
+    
+    #endif
+}
+
+#ifdef __cpp_lib_span
+
+TEST( CFPP_Data, AsSpan )
+{
+    CF::Data                          d1( __bytes, sizeof( __bytes ) );
+    CF::Data                          d2( static_cast< CFDataRef >( nullptr ) );
+    std::span< const CF::Data::Byte > s1( d1.AsSpan() );
+    std::span< const CF::Data::Byte > s2( d2.AsSpan() );
+    
+    ASSERT_EQ(   s1.size(), 4 );
+    ASSERT_EQ(   s2.size(), 0 );
+    ASSERT_TRUE( s1.data() == d1.GetBytePtr() );
+    ASSERT_TRUE( s1[ 3 ] == 0xEF );
+}
+
+TEST( CFPP_Data, AsMutableSpan )
+{
+    CF::Data                    d1( __bytes, sizeof( __bytes ) );
+    CF::Data                    d2( d1 );
+    std::span< CF::Data::Byte > s( d2.AsMutableSpan() );
+    
+    ASSERT_EQ( s.size(), 4 );
+    
+    s[ 0 ] = 0x42;
+    
+    ASSERT_TRUE( d1[ 0 ] == 0xDE );
+    ASSERT_TRUE( d2[ 0 ] == 0x42 );
+}
+
+#endif
+
+TEST( CFPP_Data, CopyOnWrite )
+{
+    CF::Data d1( __bytes, sizeof( __bytes ) );
+    CF::Data d2( d1 );
+    CF::Data d3( d1 );
+    
+    ASSERT_TRUE( d1.GetCFObject() == d2.GetCFObject() );
+    ASSERT_TRUE( d1.GetCFObject() == d3.GetCFObject() );
+    
+    d2.AppendBytes( __bytes, sizeof( __bytes ) );
+    d3.GetMutableBytePtr()[ 0 ] = 0x42;
+    
+    ASSERT_TRUE( d1.GetCFObject() != d2.GetCFObject() );
+    ASSERT_TRUE( d1.GetCFObject() != d3.GetCFObject() );
+    ASSERT_EQ(   d1.GetLength(), 4 );
+    ASSERT_EQ(   d2.GetLength(), 8 );
+    ASSERT_EQ(   d3.GetLength(), 4 );
+    ASSERT_TRUE( d1[ 0 ] == 0xDE );
+    ASSERT_TRUE( d3[ 0 ] == 0x42 );
+    
+    d1 += d1;
+    
+    ASSERT_EQ(   d1.GetLength(), 8 );
+    ASSERT_TRUE( d1[ 4 ] == 0xDE );
+}
+
 TEST( CFPP_Data, Swap )
 {
     CF::Data d1;
@@ -0,0 +1,379 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-DataReader.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::DataReader
+ */
+
+#include <CF++.hpp>
+#include <limits>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Data::Byte __bytes[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+TEST( CFPP_DataReader, CTOR )
+{
+    CF::DataReader r;
+    
+    ASSERT_EQ(    r.GetLength(), 0 );
+    ASSERT_TRUE(  r.IsAtEnd() );
+    ASSERT_FALSE( r.HasFailed() );
+}
+
+TEST( CFPP_DataReader, CTOR_Data )
+{
+    CF::DataReader r1( CF::Data( __bytes, sizeof( __bytes ) ) );
+    CF::DataReader r2( CF::Data( static_cast< CFDataRef >( nullptr ) ) );
+    
+    ASSERT_EQ(    r1.GetLength(), 8 );
+    ASSERT_FALSE( r1.IsAtEnd() );
+    ASSERT_EQ(    r2.GetLength(), 0 );
+    ASSERT_TRUE(  r2.IsAtEnd() );
+}
+
+TEST( CFPP_DataReader, CCTOR )
+{
+    CF::DataReader r1( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    r1.GetU8();
+    
+    {
+        CF::DataReader r2( r1 );
+        
+        ASSERT_EQ( r2.GetPosition(), 1 );
+        ASSERT_EQ( r2.GetU8(),       0x02 );
+        ASSERT_EQ( r1.GetPosition(), 1 );
+    }
+}
+
+TEST( CFPP_DataReader, MCTOR )
+{
+    CF::DataReader r1( CF::Data( __bytes, sizeof( __bytes ) ) );
+    CF::DataReader r2( std::move( r1 ) );
+    
+    ASSERT_EQ( r1.GetLength(), 0 );
+    ASSERT_EQ( r2.GetLength(), 8 );
+}
+
+TEST( CFPP_DataReader, OperatorAssign )
+{
+    CF::DataReader r1( CF::Data( __bytes, sizeof( __bytes ) ) );
+    CF::DataReader r2;
+    
+    r2 = r1;
+    
+    ASSERT_EQ( r2.GetLength(), 8 );
+    ASSERT_EQ( r2.GetU8(),     0x01 );
+}
+
+TEST( CFPP_DataReader, GetLength )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_EQ( r.GetLength(), 8 );
+    
+    r.GetU32();
+    
+    ASSERT_EQ( r.GetLength(), 8 );
+}
+
+TEST( CFPP_DataReader, GetPosition )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_EQ( r.GetPosition(), 0 );
+    
+    r.GetU16();
+    
+    ASSERT_EQ( r.GetPosition(), 2 );
+}
+
+TEST( CFPP_DataReader, GetRemaining )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    r.GetU16();
+    
+    ASSERT_EQ( r.GetRemaining(), 6 );
+}
+
+TEST( CFPP_DataReader, GetBytePtr )
+{
+    CF::Data       d( __bytes, sizeof( __bytes ) );
+    CF::DataReader r1( d );
+    CF::DataReader r2;
+    
+    r1.GetU8();
+    
+    ASSERT_TRUE( r1.GetBytePtr() == d.GetBytePtr() + 1 );
+    ASSERT_TRUE( r2.GetBytePtr() == nullptr );
+}
+
+TEST( CFPP_DataReader, GetByteOrder )
+{
+    CF::DataReader r1( CF::Data( __bytes, sizeof( __bytes ) ) );
+    CF::DataReader r2( CF::Data( __bytes, sizeof( __bytes ) ), CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( r1.GetByteOrder(), CF::Data::ByteOrderLittleEndian );
+    ASSERT_EQ( r2.GetByteOrder(), CF::Data::ByteOrderBigEndian );
+}
+
+TEST( CFPP_DataReader, HasFailed )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    r.GetU32();
+    
+    ASSERT_FALSE( r.HasFailed() );
+    ASSERT_EQ(    r.GetU64(), 0 );
+    ASSERT_TRUE(  r.HasFailed() );
+    ASSERT_EQ(    r.GetPosition(), 4 );
+    ASSERT_EQ(    r.GetU32(), 0x08070605 );
+    ASSERT_TRUE(  r.HasFailed() );
+}
+
+TEST( CFPP_DataReader, IsAtEnd )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_FALSE( r.IsAtEnd() );
+    
+    r.GetU64();
+    
+    ASSERT_TRUE( r.IsAtEnd() );
+}
+
+TEST( CFPP_DataReader, SetByteOrder )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    r.SetByteOrder( CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( r.GetByteOrder(), CF::Data::ByteOrderBigEndian );
+    ASSERT_EQ( r.GetU16(),       0x0102 );
+}
+
+TEST( CFPP_DataReader, SetPosition )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_TRUE(  r.SetPosition( 7 ) );
+    ASSERT_EQ(    r.GetU8(), 0x08 );
+    ASSERT_TRUE(  r.SetPosition( 8 ) );
+    ASSERT_FALSE( r.HasFailed() );
+    ASSERT_FALSE( r.SetPosition( 9 ) );
+    ASSERT_TRUE(  r.HasFailed() );
+}
+
+TEST( CFPP_DataReader, Skip )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_TRUE(  r.Skip( 3 ) );
+    ASSERT_EQ(    r.GetU8(), 0x04 );
+    ASSERT_FALSE( r.Skip( 5 ) );
+    ASSERT_EQ(    r.GetPosition(), 4 );
+}
+
+TEST( CFPP_DataReader, Require )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_TRUE(  r.Require( 8 ) );
+    ASSERT_FALSE( r.HasFailed() );
+    ASSERT_FALSE( r.Require( 9 ) );
+    ASSERT_TRUE(  r.HasFailed() );
+    ASSERT_EQ(    r.GetPosition(), 0 );
+}
+
+TEST( CFPP_DataReader, GetU8 )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_EQ( r.GetU8(), 0x01 );
+    ASSERT_EQ( r.GetU8(), 0x02 );
+}
+
+TEST( CFPP_DataReader, GetU16 )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_EQ( r.GetU16(), 0x0201 );
+    
+    r.SetByteOrder( CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( r.GetU16(), 0x0304 );
+}
+
+TEST( CFPP_DataReader, GetU32 )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    
+    ASSERT_EQ( r.GetU32(), 0x04030201 );
+    
+    r.SetByteOrder( CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( r.GetU32(), 0x05060708 );
+}
+
+TEST( CFPP_DataReader, GetU64 )
+{
+    CF::DataReader r1( CF::Data( __bytes, sizeof( __bytes ) ) );
+    CF::DataReader r2( CF::Data( __bytes, sizeof( __bytes ) ), CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( r1.GetU64(), 0x0807060504030201ULL );
+    ASSERT_EQ( r2.GetU64(), 0x0102030405060708ULL );
+}
+
+TEST( CFPP_DataReader, GetF32 )
+{
+    CF::DataReader r( CF::Data( { 0x3F, 0x80, 0x00, 0x00 } ), CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( r.GetF32(), 1.0f );
+}
+
+TEST( CFPP_DataReader, GetF64 )
+{
+    CF::DataReader r( CF::Data( { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F } ) );
+    
+    ASSERT_EQ( r.GetF64(), 1.0 );
+}
+
+TEST( CFPP_DataReader, GetVarUInt )
+{
+    CF::DataReader r1( CF::Data( { 0x00, 0x7F, 0xAC, 0x02 } ) );
+    CF::DataReader r2( CF::Data( { 0x80, 0x80 } ) );
+    
+    ASSERT_EQ(    r1.GetVarUInt(), 0 );
+    ASSERT_EQ(    r1.GetVarUInt(), 127 );
+    ASSERT_EQ(    r1.GetVarUInt(), 300 );
+    ASSERT_FALSE( r1.HasFailed() );
+    ASSERT_EQ(    r2.GetVarUInt(), 0 );
+    ASSERT_TRUE(  r2.HasFailed() );
+}
+
+TEST( CFPP_DataReader, GetVarInt )
+{
+    CF::DataReader r( CF::Data( { 0x3F, 0xC0, 0x00, 0x40, 0xBF, 0x7F, 0xC0, 0xBB, 0x78 } ) );
+    
+    ASSERT_EQ(    r.GetVarInt(), 63 );
+    ASSERT_EQ(    r.GetVarInt(), 64 );
+    ASSERT_EQ(    r.GetVarInt(), -64 );
+    ASSERT_EQ(    r.GetVarInt(), -65 );
+    ASSERT_EQ(    r.GetVarInt(), -123456 );
+    ASSERT_FALSE( r.HasFailed() );
+}
+
+TEST( CFPP_DataReader, GetVarUInt_Overflow )
+{
+    CF::DataReader r1( CF::Data( { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 } ) );
+    CF::DataReader r2( CF::Data( { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02 } ) );
+    
+    ASSERT_EQ(    r1.GetVarUInt(), 0xFFFFFFFFFFFFFFFFULL );
+    ASSERT_FALSE( r1.HasFailed() );
+    ASSERT_EQ(    r2.GetVarUInt(), 0 );
+    ASSERT_TRUE(  r2.HasFailed() );
+}
+
+TEST( CFPP_DataReader, GetVarInt_Overflow )
+{
+    CF::DataReader r1( CF::Data( { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F } ) );
+    CF::DataReader r2( CF::Data( { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 } ) );
+    CF::DataReader r3( CF::Data( { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 } ) );
+    CF::DataReader r4( CF::Data( { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F } ) );
+    
+    ASSERT_EQ(    r1.GetVarInt(), std::numeric_limits< SInt64 >::min() );
+    ASSERT_EQ(    r2.GetVarInt(), std::numeric_limits< SInt64 >::max() );
+    ASSERT_FALSE( r1.HasFailed() );
+    ASSERT_FALSE( r2.HasFailed() );
+    ASSERT_EQ(    r3.GetVarInt(), 0 );
+    ASSERT_EQ(    r4.GetVarInt(), 0 );
+    ASSERT_TRUE(  r3.HasFailed() );
+    ASSERT_TRUE(  r4.HasFailed() );
+}
+
+TEST( CFPP_DataReader, GetBytes )
+{
+    CF::DataReader r( CF::Data( __bytes, sizeof( __bytes ) ) );
+    CF::Data::Byte b[ 4 ];
+    
+    ASSERT_TRUE(  r.GetBytes( b, 4 ) );
+    ASSERT_EQ(    b[ 3 ], 0x04 );
+    ASSERT_FALSE( r.GetBytes( b, 5 ) );
+    ASSERT_FALSE( r.GetBytes( nullptr, 1 ) );
+}
+
+TEST( CFPP_DataReader, GetSlice )
+{
+    CF::Data       d( __bytes, sizeof( __bytes ) );
+    CF::DataReader r( d );
+    CF::DataReader s;
+    
+    r.GetU8();
+    
+    s = r.GetSlice( 4 );
+    
+    ASSERT_FALSE( s.HasFailed() );
+    ASSERT_EQ(    s.GetLength(), 4 );
+    ASSERT_TRUE(  s.GetBytePtr() == d.GetBytePtr() + 1 );
+    ASSERT_EQ(    s.GetU32(), 0x05040302 );
+    ASSERT_TRUE(  s.IsAtEnd() );
+    ASSERT_EQ(    r.GetPosition(), 5 );
+    
+    s = r.GetSlice( 4 );
+    
+    ASSERT_TRUE( s.HasFailed() );
+    ASSERT_TRUE( r.HasFailed() );
+}
+
+TEST( CFPP_DataReader, GetVarSlice )
+{
+    CF::DataReader r( CF::Data( { 0x02, 0xDE, 0xAD, 0x05, 0xBE } ) );
+    CF::DataReader s;
+    
+    s = r.GetVarSlice();
+    
+    ASSERT_EQ( s.GetLength(), 2 );
+    ASSERT_EQ( s.GetU16(),    0xADDE );
+    
+    s = r.GetVarSlice();
+    
+    ASSERT_TRUE( s.HasFailed() );
+    ASSERT_TRUE( r.HasFailed() );
+}
+
+TEST( CFPP_DataReader, Swap )
+{
+    CF::DataReader r1( CF::Data( __bytes, sizeof( __bytes ) ) );
+    CF::DataReader r2;
+    
+    swap( r1, r2 );
+    
+    ASSERT_EQ( r1.GetLength(), 0 );
+    ASSERT_EQ( r2.GetLength(), 8 );
+}
@@ -0,0 +1,375 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-DataWriter.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::DataWriter
+ */
+
+#include <CF++.hpp>
+#include <limits>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_DataWriter, CTOR )
+{
+    CF::DataWriter w1;
+    CF::DataWriter w2( CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( w1.GetLength(),    0 );
+    ASSERT_EQ( w1.GetByteOrder(), CF::Data::ByteOrderLittleEndian );
+    ASSERT_EQ( w2.GetByteOrder(), CF::Data::ByteOrderBigEndian );
+}
+
+TEST( CFPP_DataWriter, CTOR_CFIndex )
+{
+    CF::DataWriter w( 1024 );
+    
+    ASSERT_EQ( w.GetLength(), 0 );
+    ASSERT_GE( w.GetCapacity(), 1024 );
+}
+
+TEST( CFPP_DataWriter, CCTOR )
+{
+    CF::DataWriter w1;
+    
+    w1.PutU32( 42 );
+    
+    {
+        CF::DataWriter w2( w1 );
+        
+        ASSERT_EQ( w1.GetLength(), 4 );
+        ASSERT_EQ( w2.GetLength(), 4 );
+    }
+}
+
+TEST( CFPP_DataWriter, MCTOR )
+{
+    CF::DataWriter w1;
+    
+    w1.PutU32( 42 );
+    
+    {
+        CF::DataWriter w2( std::move( w1 ) );
+        
+        ASSERT_EQ( w1.GetLength(), 0 );
+        ASSERT_EQ( w2.GetLength(), 4 );
+    }
+}
+
+TEST( CFPP_DataWriter, OperatorAssign )
+{
+    CF::DataWriter w1;
+    CF::DataWriter w2;
+    
+    w1.PutU16( 42 );
+    
+    w2 = w1;
+    
+    ASSERT_EQ( w1.GetLength(), 2 );
+    ASSERT_EQ( w2.GetLength(), 2 );
+}
+
+TEST( CFPP_DataWriter, GetLength )
+{
+    CF::DataWriter w;
+    
+    ASSERT_EQ( w.GetLength(), 0 );
+    
+    w.PutU8( 1 );
+    w.PutU64( 1 );
+    
+    ASSERT_EQ( w.GetLength(), 9 );
+}
+
+TEST( CFPP_DataWriter, GetCapacity )
+{
+    CF::DataWriter w;
+    
+    w.PutU8( 1 );
+    
+    ASSERT_GE( w.GetCapacity(), 1 );
+}
+
+TEST( CFPP_DataWriter, GetByteOrder )
+{
+    CF::DataWriter w;
+    
+    ASSERT_EQ( w.GetByteOrder(), CF::Data::ByteOrderLittleEndian );
+}
+
+TEST( CFPP_DataWriter, SetByteOrder )
+{
+    CF::DataWriter w;
+    
+    w.SetByteOrder( CF::Data::ByteOrderBigEndian );
+    
+    ASSERT_EQ( w.GetByteOrder(), CF::Data::ByteOrderBigEndian );
+}
+
+TEST( CFPP_DataWriter, Reserve )
+{
+    CF::DataWriter w;
+    
+    w.Reserve( 4096 );
+    
+    ASSERT_GE( w.GetCapacity(), 4096 );
+    ASSERT_EQ( w.GetLength(),   0 );
+}
+
+TEST( CFPP_DataWriter, Clear )
+{
+    CF::DataWriter w;
+    
+    w.PutU32( 1 );
+    w.Clear();
+    
+    ASSERT_EQ( w.GetLength(), 0 );
+}
+
+TEST( CFPP_DataWriter, PutU8 )
+{
+    CF::DataWriter w;
+    CF::Data       d;
+    
+    w.PutU8( 0xDE );
+    w.PutU8( 0xAD );
+    
+    d = w.Commit();
+    
+    ASSERT_EQ( d.GetLength(), 2 );
+    ASSERT_TRUE( d[ 0 ] == 0xDE );
+    ASSERT_TRUE( d[ 1 ] == 0xAD );
+}
+
+TEST( CFPP_DataWriter, PutU16 )
+{
+    CF::DataWriter w;
+    CF::Data       d;
+    
+    w.PutU16( 0x0102 );
+    w.SetByteOrder( CF::Data::ByteOrderBigEndian );
+    w.PutU16( 0x0102 );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( { 0x02, 0x01, 0x01, 0x02 } ) );
+}
+
+TEST( CFPP_DataWriter, PutU32 )
+{
+    CF::DataWriter w;
+    CF::Data       d;
+    
+    w.PutU32( 0x01020304 );
+    w.SetByteOrder( CF::Data::ByteOrderBigEndian );
+    w.PutU32( 0x01020304 );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( { 0x04, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x04 } ) );
+}
+
+TEST( CFPP_DataWriter, PutU64 )
+{
+    CF::DataWriter w( CF::Data::ByteOrderBigEndian );
+    CF::Data       d;
+    
+    w.PutU64( 0x0102030405060708ULL );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 } ) );
+}
+
+TEST( CFPP_DataWriter, PutF32 )
+{
+    CF::DataWriter w( CF::Data::ByteOrderBigEndian );
+    CF::Data       d;
+    
+    w.PutF32( 1.0f );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( { 0x3F, 0x80, 0x00, 0x00 } ) );
+}
+
+TEST( CFPP_DataWriter, PutF64 )
+{
+    CF::DataWriter w;
+    CF::Data       d;
+    
+    w.PutF64( 1.0 );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F } ) );
+}
+
+TEST( CFPP_DataWriter, PutBytes )
+{
+    CF::DataWriter w;
+    CF::Data::Byte b[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+    CF::Data       d;
+    
+    w.PutBytes( b, sizeof( b ) );
+    w.PutBytes( nullptr, 4 );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( b, sizeof( b ) ) );
+}
+
+TEST( CFPP_DataWriter, PutData )
+{
+    CF::DataWriter w;
+    CF::Data       d;
+    
+    w.PutData( CF::Data( std::string( "hello" ) ) );
+    w.PutData( CF::Data( static_cast< CFDataRef >( nullptr ) ) );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( std::string( d ) == "hello" );
+}
+
+TEST( CFPP_DataWriter, PutVarUInt )
+{
+    CF::DataWriter w;
+    CF::Data       d;
+    
+    w.PutVarUInt( 0 );
+    w.PutVarUInt( 127 );
+    w.PutVarUInt( 300 );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( { 0x00, 0x7F, 0xAC, 0x02 } ) );
+    
+    w.PutVarUInt( 0xFFFFFFFFFFFFFFFFULL );
+    
+    ASSERT_EQ( w.GetLength(), 10 );
+}
+
+TEST( CFPP_DataWriter, PutVarInt )
+{
+    CF::DataWriter w;
+    CF::Data       d;
+    
+    w.PutVarInt( 63 );
+    w.PutVarInt( 64 );
+    w.PutVarInt( -64 );
+    w.PutVarInt( -65 );
+    w.PutVarInt( -123456 );
+    
+    d = w.Commit();
+    
+    ASSERT_TRUE( d == CF::Data( { 0x3F, 0xC0, 0x00, 0x40, 0xBF, 0x7F, 0xC0, 0xBB, 0x78 } ) );
+}
+
+TEST( CFPP_DataWriter, Commit )
+{
+    CF::DataWriter w;
+    CF::Data       d1;
+    CF::Data       d2;
+    
+    for( int i = 0; i < 10000; i++ )
+    {
+        w.PutU8( static_cast< UInt8 >( i ) );
+    }
+    
+    d1 = w.Commit();
+    d2 = w.Commit();
+    
+    ASSERT_EQ(   w.GetLength(),  0 );
+    ASSERT_EQ(   d1.GetLength(), 10000 );
+    ASSERT_TRUE( d1[ 9999 ] == static_cast< UInt8 >( 9999 ) );
+    ASSERT_TRUE( d2.IsValid() );
+    ASSERT_EQ(   d2.GetLength(), 0 );
+    
+    d1 += static_cast< CF::Data::Byte >( 0 );
+    
+    ASSERT_EQ( d1.GetLength(), 10001 );
+}
+
+TEST( CFPP_DataWriter, CommitTo )
+{
+    CF::DataWriter w;
+    CF::Data       d( std::string( "ab" ) );
+    
+    w.PutU16( 0x6463 );
+    w.CommitTo( d );
+    
+    ASSERT_EQ(   w.GetLength(), 0 );
+    ASSERT_TRUE( std::string( d ) == "abcd" );
+}
+
+TEST( CFPP_DataWriter, HasFailed )
+{
+    CF::DataWriter w;
+    CF::Data       d( std::string( "ab" ) );
+    CF::Data::Byte b[ 1 ] = { 0 };
+    
+    w.PutU8( 1 );
+    
+    ASSERT_FALSE( w.HasFailed() );
+    
+    w.PutBytes( b, std::numeric_limits< CFIndex >::max() );
+    w.PutU8( 2 );
+    
+    ASSERT_TRUE( w.HasFailed() );
+    ASSERT_EQ(   w.GetLength(), 2 );
+    ASSERT_TRUE( CF::DataWriter( w ).HasFailed() );
+    
+    w.CommitTo( d );
+    
+    ASSERT_FALSE( w.HasFailed() );
+    ASSERT_TRUE(  std::string( d ) == "ab" );
+    
+    w.PutU8( 1 );
+    w.PutBytes( b, std::numeric_limits< CFIndex >::max() );
+    
+    ASSERT_FALSE( w.Commit().IsValid() );
+    ASSERT_FALSE( w.HasFailed() );
+    
+    w.PutU8( 3 );
+    
+    ASSERT_EQ( w.Commit().GetLength(), 1 );
+}
+
+TEST( CFPP_DataWriter, Swap )
+{
+    CF::DataWriter w1;
+    CF::DataWriter w2( CF::Data::ByteOrderBigEndian );
+    
+    w1.PutU8( 1 );
+    
+    swap( w1, w2 );
+    
+    ASSERT_EQ( w1.GetLength(),    0 );
+    ASSERT_EQ( w2.GetLength(),    1 );
+    ASSERT_EQ( w1.GetByteOrder(), CF::Data::ByteOrderBigEndian );
+}
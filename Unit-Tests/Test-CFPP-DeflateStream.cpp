@@ -0,0 +1,317 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-DeflateStream.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::DeflateStream
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Data __Payload()
+{
+    std::vector< CF::Data::Byte > v( 200000 );
+    UInt32                        x;
+    
+    x = 42;
+    
+    for( size_t i = 0; i < v.size(); i++ )
+    {
+        x      = x * 1103515245 + 12345;
+        v[ i ] = static_cast< CF::Data::Byte >( ( i % 3 == 0 ) ? x >> 24 : i % 5 );
+    }
+    
+    return CF::Data( &( v[ 0 ] ), static_cast< CFIndex >( v.size() ) );
+}
+
+static CF::WriteStream __Stream( const std::string & path )
+{
+    CF::WriteStream s( path );
+    
+    s.Open();
+    
+    return s;
+}
+
+static CF::ReadStream __Open( const std::string & path )
+{
+    CF::ReadStream s( path );
+    
+    s.Open();
+    
+    return s;
+}
+
+static CF::Data __Contents( const std::string & path )
+{
+    CF::ReadStream s( __Open( path ) );
+    CF::Data       d;
+    
+    d = s.Read();
+    
+    s.Close();
+    
+    return d;
+}
+
+TEST( CFPP_DeflateStream, CTOR )
+{
+    CF::DeflateStream d1( __Stream( "/tmp/com.xs-labs.cfpp-deflate-1" ) );
+    CF::DeflateStream d2( __Stream( "/tmp/com.xs-labs.cfpp-deflate-2" ), CF::Data::CompressionGzip, 9 );
+    CF::DeflateStream d3( __Stream( "/tmp/com.xs-labs.cfpp-deflate-3" ), CF::Data::CompressionZlib, 42 );
+    CF::DeflateStream d4( CF::WriteStream( nullptr ) );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  d1.IsValid() );
+    ASSERT_TRUE(  d2.IsValid() );
+    #else
+    ASSERT_FALSE( d1.IsValid() );
+    ASSERT_FALSE( d2.IsValid() );
+    #endif
+    ASSERT_FALSE( d3.IsValid() );
+    ASSERT_FALSE( d4.IsValid() );
+    ASSERT_FALSE( d1.IsFinished() );
+    ASSERT_FALSE( d1.HasFailed() );
+}
+
+TEST( CFPP_DeflateStream, MCTOR )
+{
+    CF::WriteStream   s( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    CF::DeflateStream d1( s );
+    
+    {
+        CF::DeflateStream d2( std::move( d1 ) );
+        
+        ASSERT_FALSE( d1.IsValid() );
+        
+        #ifdef CFPP_ZLIB
+        ASSERT_TRUE(  d2.IsValid() );
+        ASSERT_EQ(    d2.Write( __Payload() ), __Payload().GetLength() );
+        #else
+        ASSERT_FALSE( d2.IsValid() );
+        #endif
+    }
+    
+    s.Close();
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE( __Contents( "/tmp/com.xs-labs.cfpp-deflate" ).Decompress() == __Payload() );
+    #endif
+}
+
+TEST( CFPP_DeflateStream, OperatorAssign )
+{
+    CF::DeflateStream d1( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    CF::DeflateStream d2( CF::WriteStream( nullptr ) );
+    
+    d2 = std::move( d1 );
+    
+    ASSERT_FALSE( d1.IsValid() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  d2.IsValid() );
+    #else
+    ASSERT_FALSE( d2.IsValid() );
+    #endif
+}
+
+TEST( CFPP_DeflateStream, IsValid )
+{
+    CF::WriteStream   s;
+    CF::DeflateStream d1( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    CF::DeflateStream d2( s );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  d1.IsValid() );
+    #else
+    ASSERT_FALSE( d1.IsValid() );
+    #endif
+    ASSERT_FALSE( d2.IsValid() );
+}
+
+TEST( CFPP_DeflateStream, IsFinished )
+{
+    CF::DeflateStream d( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    
+    ASSERT_FALSE( d.IsFinished() );
+    
+    d.Finish();
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  d.IsFinished() );
+    #else
+    ASSERT_FALSE( d.IsFinished() );
+    #endif
+}
+
+TEST( CFPP_DeflateStream, HasFailed )
+{
+    CF::WriteStream   s( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    CF::DeflateStream d( s );
+    
+    s.Close();
+    
+    ASSERT_FALSE( d.HasFailed() );
+    ASSERT_FALSE( d.Finish() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  d.HasFailed() );
+    #else
+    ASSERT_FALSE( d.HasFailed() );
+    #endif
+}
+
+TEST( CFPP_DeflateStream, Write_BytePtr_CFIndex )
+{
+    CF::Data        p( __Payload() );
+    CF::WriteStream s( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    
+    {
+        CF::DeflateStream d( s, CF::Data::CompressionGzip );
+        
+        #ifdef CFPP_ZLIB
+        
+        for( CFIndex i = 0; i < p.GetLength(); i += 1000 )
+        {
+            ASSERT_EQ( d.Write( p.GetBytePtr() + i, std::min< CFIndex >( 1000, p.GetLength() - i ) ), std::min< CFIndex >( 1000, p.GetLength() - i ) );
+        }
+        
+        ASSERT_EQ( d.Write( nullptr, 1 ), -1 );
+        ASSERT_EQ( d.Write( p.GetBytePtr(), 0 ), -1 );
+        
+        #else
+        
+        ASSERT_EQ( d.Write( p.GetBytePtr(), p.GetLength() ), -1 );
+        
+        #endif
+    }
+    
+    s.Close();
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE( __Contents( "/tmp/com.xs-labs.cfpp-deflate" ).Decompress( CF::Data::CompressionGzip ) == p );
+    #endif
+}
+
+TEST( CFPP_DeflateStream, Write_Data )
+{
+    CF::Data        p( __Payload() );
+    CF::WriteStream s( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    
+    {
+        CF::DeflateStream d( s, CF::Data::CompressionDeflate );
+        
+        #ifdef CFPP_ZLIB
+        ASSERT_EQ( d.Write( p ), p.GetLength() );
+        ASSERT_EQ( d.Write( CF::Data() ), -1 );
+        #else
+        ASSERT_EQ( d.Write( p ), -1 );
+        #endif
+    }
+    
+    s.Close();
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE( __Contents( "/tmp/com.xs-labs.cfpp-deflate" ).Decompress( CF::Data::CompressionDeflate ) == p );
+    #endif
+}
+
+TEST( CFPP_DeflateStream, Flush )
+{
+    CF::Data          p( std::string( "hello, world" ) );
+    CF::WriteStream   s( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    CF::DeflateStream d( s, CF::Data::CompressionDeflate );
+    
+    #ifdef CFPP_ZLIB
+    
+    CF::Data::Byte buffer[ 100 ];
+    
+    ASSERT_EQ(   d.Write( p ), p.GetLength() );
+    ASSERT_TRUE( d.Flush() );
+    
+    {
+        /* Everything written so far can be read back */
+        CF::InflateStream i( __Open( "/tmp/com.xs-labs.cfpp-deflate" ), CF::Data::CompressionDeflate );
+        
+        ASSERT_EQ(   i.Read( buffer, 100 ), p.GetLength() );
+        ASSERT_TRUE( CF::Data( buffer, p.GetLength() ) == p );
+    }
+    
+    ASSERT_TRUE(  d.Finish() );
+    ASSERT_FALSE( d.Flush() );
+    
+    #else
+    
+    ASSERT_FALSE( d.Flush() );
+    
+    #endif
+    
+    s.Close();
+}
+
+TEST( CFPP_DeflateStream, Finish )
+{
+    CF::Data          p( __Payload() );
+    CF::WriteStream   s( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    CF::DeflateStream d( s );
+    
+    #ifdef CFPP_ZLIB
+    
+    ASSERT_EQ(   d.Write( p ), p.GetLength() );
+    ASSERT_TRUE( d.Finish() );
+    ASSERT_TRUE( d.Finish() );
+    ASSERT_EQ(   d.Write( p ), -1 );
+    
+    s.Close();
+    
+    ASSERT_TRUE( __Contents( "/tmp/com.xs-labs.cfpp-deflate" ).Decompress() == p );
+    
+    #else
+    
+    ASSERT_FALSE( d.Finish() );
+    
+    s.Close();
+    
+    #endif
+}
+
+TEST( CFPP_DeflateStream, Swap )
+{
+    CF::DeflateStream d1( __Stream( "/tmp/com.xs-labs.cfpp-deflate" ) );
+    CF::DeflateStream d2( CF::WriteStream( nullptr ) );
+    
+    swap( d1, d2 );
+    
+    ASSERT_FALSE( d1.IsValid() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  d2.IsValid() );
+    #else
+    ASSERT_FALSE( d2.IsValid() );
+    #endif
+}
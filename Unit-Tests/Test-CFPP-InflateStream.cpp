@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-InflateStream.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::InflateStream
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+/* Poorly compressible, so the compressed data spans several reads */
+static CF::Data __Payload()
+{
+    std::vector< CF::Data::Byte > v( 200000 );
+    UInt32                        x;
+    
+    x = 42;
+    
+    for( size_t i = 0; i < v.size(); i++ )
+    {
+        x      = x * 1103515245 + 12345;
+        v[ i ] = static_cast< CF::Data::Byte >( ( i % 3 == 0 ) ? x >> 24 : i % 5 );
+    }
+    
+    return CF::Data( &( v[ 0 ] ), static_cast< CFIndex >( v.size() ) );
+}
+
+/* Each stream gets its own file, as several may be open at once */
+static CF::ReadStream __Stream( const CF::Data & contents )
+{
+    static int      n = 0;
+    std::string     path( "/tmp/com.xs-labs.cfpp-inflate-" + std::to_string( n++ ) );
+    CF::WriteStream w( path );
+    CF::ReadStream  r( path );
+    
+    if( w.Open() )
+    {
+        w.WriteAll( contents );
+        w.Close();
+    }
+    
+    r.Open();
+    
+    return r;
+}
+
+TEST( CFPP_InflateStream, CTOR )
+{
+    CF::InflateStream i1( __Stream( __Payload().Compress() ) );
+    CF::InflateStream i2( __Stream( __Payload().Compress() ), CF::Data::CompressionDeflate );
+    CF::InflateStream i3( CF::ReadStream( nullptr ) );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  i1.IsValid() );
+    ASSERT_TRUE(  i2.IsValid() );
+    #else
+    ASSERT_FALSE( i1.IsValid() );
+    ASSERT_FALSE( i2.IsValid() );
+    #endif
+    ASSERT_FALSE( i3.IsValid() );
+    ASSERT_FALSE( i1.IsAtEnd() );
+    ASSERT_FALSE( i1.HasFailed() );
+}
+
+TEST( CFPP_InflateStream, MCTOR )
+{
+    CF::InflateStream i1( __Stream( __Payload().Compress() ) );
+    CF::InflateStream i2( std::move( i1 ) );
+    
+    ASSERT_FALSE( i1.IsValid() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  i2.IsValid() );
+    ASSERT_TRUE(  i2.Read() == __Payload() );
+    #else
+    ASSERT_FALSE( i2.IsValid() );
+    #endif
+}
+
+TEST( CFPP_InflateStream, OperatorAssign )
+{
+    CF::InflateStream i1( __Stream( __Payload().Compress() ) );
+    CF::InflateStream i2( CF::ReadStream( nullptr ) );
+    
+    i2 = std::move( i1 );
+    
+    ASSERT_FALSE( i1.IsValid() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  i2.IsValid() );
+    ASSERT_TRUE(  i2.Read() == __Payload() );
+    #else
+    ASSERT_FALSE( i2.IsValid() );
+    #endif
+}
+
+TEST( CFPP_InflateStream, IsValid )
+{
+    CF::ReadStream    s;
+    CF::InflateStream i1( __Stream( __Payload().Compress() ) );
+    CF::InflateStream i2( s );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  i1.IsValid() );
+    #else
+    ASSERT_FALSE( i1.IsValid() );
+    #endif
+    ASSERT_FALSE( i2.IsValid() );
+}
+
+TEST( CFPP_InflateStream, IsAtEnd )
+{
+    CF::InflateStream i( __Stream( __Payload().Compress() ) );
+    
+    ASSERT_FALSE( i.IsAtEnd() );
+    
+    i.Read();
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  i.IsAtEnd() );
+    #else
+    ASSERT_FALSE( i.IsAtEnd() );
+    #endif
+}
+
+TEST( CFPP_InflateStream, HasFailed )
+{
+    CF::Data          d( __Payload().Compress() );
+    CF::InflateStream i1( __Stream( CF::Data( d.GetBytePtr(), d.GetLength() / 2 ) ) );
+    CF::InflateStream i2( __Stream( __Payload() ) );
+    
+    ASSERT_FALSE( i1.HasFailed() );
+    ASSERT_FALSE( i2.HasFailed() );
+    
+    i1.Read();
+    i2.Read();
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  i1.HasFailed() );
+    ASSERT_TRUE(  i2.HasFailed() );
+    #else
+    ASSERT_FALSE( i1.HasFailed() );
+    ASSERT_FALSE( i2.HasFailed() );
+    #endif
+}
+
+TEST( CFPP_InflateStream, Read_BytePtr_CFIndex )
+{
+    CF::Data       p( __Payload() );
+    CF::Data       d;
+    CF::Data       gz;
+    CF::Data::Byte buffer[ 1000 ];
+    
+    /* Two gzip members */
+    gz  = CF::Data( p.GetBytePtr(), 50000 ).Compress( CF::Data::CompressionGzip );
+    gz += CF::Data( p.GetBytePtr() + 50000, p.GetLength() - 50000 ).Compress( CF::Data::CompressionGzip );
+    
+    {
+        CF::InflateStream i( __Stream( gz ), CF::Data::CompressionGzip );
+        
+        #ifdef CFPP_ZLIB
+        
+        CFIndex n;
+        
+        while( ( n = i.Read( buffer, 1000 ) ) > 0 )
+        {
+            d.AppendBytes( buffer, n );
+        }
+        
+        ASSERT_EQ(   n, 0 );
+        ASSERT_TRUE( d == p );
+        ASSERT_EQ(   i.Read( buffer, 1000 ), 0 );
+        ASSERT_EQ(   i.Read( nullptr, 1 ), -1 );
+        ASSERT_EQ(   i.Read( buffer, 0 ), -1 );
+        
+        #else
+        
+        ASSERT_EQ( i.Read( buffer, 1000 ), -1 );
+        
+        #endif
+    }
+    
+    {
+        CF::InflateStream i( __Stream( p.Compress( CF::Data::CompressionDeflate ) ), CF::Data::CompressionDeflate );
+        
+        #ifdef CFPP_ZLIB
+        ASSERT_EQ(   i.Read( buffer, 1000 ), 1000 );
+        ASSERT_TRUE( CF::Data( buffer, 1000 ) == CF::Data( p.GetBytePtr(), 1000 ) );
+        #else
+        ASSERT_EQ(   i.Read( buffer, 1000 ), -1 );
+        #endif
+    }
+}
+
+TEST( CFPP_InflateStream, Read_CFIndex )
+{
+    CF::Data          p( __Payload() );
+    CF::InflateStream i1( __Stream( p.Compress() ) );
+    CF::InflateStream i2( __Stream( p.Compress() ) );
+    CF::InflateStream i3( __Stream( CF::Data( std::string( "hello, world" ) ).Compress() ) );
+    CF::Data          gz( p.Compress( CF::Data::CompressionGzip ) );
+    CF::Data          z( p.Compress() );
+    CF::Data          d;
+    
+    #ifdef CFPP_ZLIB
+    
+    d = i1.Read( 100 );
+    
+    ASSERT_EQ(    d.GetLength(), 100 );
+    ASSERT_TRUE(  d == CF::Data( p.GetBytePtr(), 100 ) );
+    
+    d += i1.Read();
+    
+    ASSERT_TRUE(  d == p );
+    ASSERT_TRUE(  i2.Read() == p );
+    ASSERT_EQ(    i2.Read().GetLength(), 0 );
+    ASSERT_TRUE(  i3.Read( 1000 ) == CF::Data( std::string( "hello, world" ) ) );
+    
+    /* Two gzip members, with the default format */
+    gz += p.Compress( CF::Data::CompressionGzip );
+    d   = p;
+    d  += p;
+    
+    {
+        CF::InflateStream i( __Stream( gz ) );
+        
+        ASSERT_TRUE( i.Read() == d );
+    }
+    
+    /* Data after a zlib stream */
+    z += CF::Data( std::string( "hello, world" ) );
+    
+    {
+        CF::InflateStream i( __Stream( z ) );
+        
+        ASSERT_FALSE( i.Read().IsValid() );
+        ASSERT_TRUE(  i.HasFailed() );
+    }
+    
+    #else
+    
+    ASSERT_FALSE( i1.Read().IsValid() );
+    ASSERT_FALSE( i3.Read( 1000 ).IsValid() );
+    
+    #endif
+}
+
+TEST( CFPP_InflateStream, Swap )
+{
+    CF::InflateStream i1( __Stream( __Payload().Compress() ) );
+    CF::InflateStream i2( CF::ReadStream( nullptr ) );
+    
+    swap( i1, i2 );
+    
+    ASSERT_FALSE( i1.IsValid() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  i2.IsValid() );
+    ASSERT_TRUE(  i2.Read() == __Payload() );
+    #else
+    ASSERT_FALSE( i2.IsValid() );
+    #endif
+}
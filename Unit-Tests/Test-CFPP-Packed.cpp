@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-Packed.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::Packed
+ */
+
+#include <CF++.hpp>
+#include <limits>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static std::vector< double > __Doubles( size_t count );
+static std::vector< double > __Doubles( size_t count )
+{
+    std::vector< double > v;
+    
+    for( size_t i = 0; i < count; i++ )
+    {
+        v.push_back( static_cast< double >( ( i * 7919 ) % 101 ) - 50.5 );
+    }
+    
+    return v;
+}
+
+static std::vector< SInt64 > __Int64( size_t count );
+static std::vector< SInt64 > __Int64( size_t count )
+{
+    std::vector< SInt64 > v;
+    
+    for( size_t i = 0; i < count; i++ )
+    {
+        v.push_back( static_cast< SInt64 >( ( i * 7919 ) % 101 ) * 10000000000LL - 500000000000LL );
+    }
+    
+    return v;
+}
+
+TEST( CFPP_Packed, Sum )
+{
+    for( size_t n = 0; n < 40; n++ )
+    {
+        std::vector< double > d( __Doubles( n ) );
+        std::vector< SInt64 > i( __Int64( n ) );
+        double                sd( 0 );
+        SInt64                si( 0 );
+        
+        for( double v: d )
+        {
+            sd += v;
+        }
+        
+        for( SInt64 v: i )
+        {
+            si += v;
+        }
+        
+        ASSERT_EQ( CF::Packed::Sum( d ), sd );
+        ASSERT_EQ( CF::Packed::Sum( i ), si );
+    }
+    
+    ASSERT_EQ( CF::Packed::Sum( static_cast< const double * >( nullptr ), 10 ), 0 );
+    ASSERT_EQ( CF::Packed::Sum( static_cast< const SInt64 * >( nullptr ), 10 ), 0 );
+}
+
+TEST( CFPP_Packed, Min )
+{
+    for( size_t n = 1; n < 40; n++ )
+    {
+        std::vector< double > d( __Doubles( n ) );
+        std::vector< SInt64 > i( __Int64( n ) );
+        
+        ASSERT_EQ( CF::Packed::Min( d ), *( std::min_element( d.begin(), d.end() ) ) );
+        ASSERT_EQ( CF::Packed::Min( i ), *( std::min_element( i.begin(), i.end() ) ) );
+    }
+    
+    ASSERT_EQ( CF::Packed::Min( std::vector< double >() ), 0 );
+    ASSERT_EQ( CF::Packed::Min( std::vector< SInt64 >() ), 0 );
+}
+
+TEST( CFPP_Packed, Max )
+{
+    for( size_t n = 1; n < 40; n++ )
+    {
+        std::vector< double > d( __Doubles( n ) );
+        std::vector< SInt64 > i( __Int64( n ) );
+        
+        ASSERT_EQ( CF::Packed::Max( d ), *( std::max_element( d.begin(), d.end() ) ) );
+        ASSERT_EQ( CF::Packed::Max( i ), *( std::max_element( i.begin(), i.end() ) ) );
+    }
+    
+    ASSERT_EQ( CF::Packed::Max( std::vector< double >() ), 0 );
+    ASSERT_EQ( CF::Packed::Max( std::vector< SInt64 >() ), 0 );
+}
+
+TEST( CFPP_Packed, Mean )
+{
+    std::vector< double > d( { 1.0, 2.0, 3.0, 4.0, 5.0 } );
+    std::vector< SInt64 > i( { 1, 2, 3, 4, 5, 6 } );
+    
+    ASSERT_EQ( CF::Packed::Mean( d ), 3.0 );
+    ASSERT_EQ( CF::Packed::Mean( i ), 3.5 );
+    ASSERT_EQ( CF::Packed::Mean( std::vector< double >() ), 0 );
+    ASSERT_EQ( CF::Packed::Mean( std::vector< SInt64 >() ), 0 );
+}
+
+TEST( CFPP_Packed, Mean_Overflow )
+{
+    std::vector< SInt64 > i1( 10, std::numeric_limits< SInt64 >::max() );
+    std::vector< SInt64 > i2( 10, std::numeric_limits< SInt64 >::min() );
+    std::vector< SInt64 > i3( { std::numeric_limits< SInt64 >::max(), std::numeric_limits< SInt64 >::max(), -1, -3 } );
+    std::vector< SInt64 > i4( { -1, -2, -3, -6 } );
+    
+    ASSERT_EQ( CF::Packed::Mean( i1 ), static_cast< double >( std::numeric_limits< SInt64 >::max() ) );
+    ASSERT_EQ( CF::Packed::Mean( i2 ), static_cast< double >( std::numeric_limits< SInt64 >::min() ) );
+    ASSERT_EQ( CF::Packed::Mean( i3 ), static_cast< double >( std::numeric_limits< SInt64 >::max() ) / 2 );
+    ASSERT_EQ( CF::Packed::Mean( i4 ), -3.0 );
+}
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-Parallel.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::Parallel
+ */
+
+#include <CF++.hpp>
+#include <atomic>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Array __Numbers( int count );
+static CF::Array __Numbers( int count )
+{
+    std::vector< int > v;
+    
+    for( int i = 0; i < count; i++ )
+    {
+        v.push_back( i );
+    }
+    
+    return CF::Array( v );
+}
+
+TEST( CFPP_Parallel, Run )
+{
+    std::vector< int >     v( 100000 );
+    std::atomic< CFIndex > n( 0 );
+    std::atomic< bool >    empty( false );
+    
+    CF::Parallel::Run
+    (
+        static_cast< CFIndex >( v.size() ),
+        [ & ]( CFIndex begin, CFIndex end )
+        {
+            if( begin >= end )
+            {
+                empty = true;
+            }
+            
+            for( CFIndex i = begin; i < end; i++ )
+            {
+                v[ static_cast< size_t >( i ) ]++;
+            }
+            
+            n += end - begin;
+        }
+    );
+    
+    ASSERT_FALSE( empty );
+    ASSERT_EQ( n, 100000 );
+    ASSERT_EQ( std::count( v.begin(), v.end(), 1 ), 100000 );
+    
+    n = 0;
+    
+    CF::Parallel::Run( 0,  [ & ]( CFIndex begin, CFIndex end ) { n += end - begin + 1; } );
+    CF::Parallel::Run( -1, [ & ]( CFIndex begin, CFIndex end ) { n += end - begin + 1; } );
+    CF::Parallel::Run( 10, [ & ]( CFIndex begin, CFIndex end ) { n += end - begin; }, 1 );
+    
+    ASSERT_EQ( n, 10 );
+}
+
+TEST( CFPP_Parallel, Run_Nested )
+{
+    std::atomic< CFIndex > n( 0 );
+    
+    CF::Parallel::Run
+    (
+        100,
+        [ & ]( CFIndex begin, CFIndex end )
+        {
+            for( CFIndex i = begin; i < end; i++ )
+            {
+                CF::Parallel::Run( 1000, [ & ]( CFIndex b, CFIndex e ) { n += e - b; }, 1 );
+            }
+        },
+        1
+    );
+    
+    ASSERT_EQ( n, 100000 );
+}
+
+TEST( CFPP_Parallel, Sort )
+{
+    CF::Array a1( std::vector< int >( { 5, 3, 9, 1, 7 } ) );
+    CF::Array a2( __Numbers( 50000 ) );
+    CF::Array a3( static_cast< CFArrayRef >( nullptr ) );
+    CF::Array a4( a2 );
+    
+    CF::Parallel::Sort( a1, CF::Array::CompareNumbers );
+    CF::Parallel::Sort( a2, []( const void * v1, const void * v2, void * ) { return CF::Array::CompareNumbers( v2, v1, nullptr ); } );
+    CF::Parallel::Sort( a3, CF::Array::CompareNumbers );
+    
+    ASSERT_TRUE( a1.ToVector< int >() == std::vector< int >( { 1, 3, 5, 7, 9 } ) );
+    ASSERT_EQ( a2.GetCount(), 50000 );
+    ASSERT_EQ( a4.GetCount(), 50000 );
+    ASSERT_FALSE( a3.IsValid() );
+    
+    {
+        std::vector< int > v( a2.ToVector< int >() );
+        
+        for( size_t i = 0; i < v.size(); i++ )
+        {
+            ASSERT_EQ( v[ i ], 49999 - static_cast< int >( i ) );
+        }
+    }
+    
+    ASSERT_EQ( CF::Number( a4[ 0 ] ).GetSignedIntValue(), 0 );
+}
+
+TEST( CFPP_Parallel, ForEach )
+{
+    CF::Array              a( __Numbers( 20000 ) );
+    std::atomic< int64_t > n( 0 );
+    
+    CF::Parallel::ForEach( a, [ & ]( CFTypeRef value ) { n += CF::Number( value ).GetSignedIntValue(); } );
+    
+    ASSERT_EQ( n, static_cast< int64_t >( 19999 ) * 20000 / 2 );
+    
+    n = 0;
+    
+    CF::Parallel::ForEach( CF::ArrayView< CFNumberRef >( a ), [ & ]( CFNumberRef value ) { n += ( CF::Number( value ) > 9999 ) ? 1 : 0; } );
+    
+    ASSERT_EQ( n, 10000 );
+}
+
+TEST( CFPP_Parallel, Map )
+{
+    CF::Array a1( __Numbers( 20000 ) );
+    CF::Array a2( CF::Parallel::Map( a1, []( CFTypeRef value ) { return CF::Number( value ).GetSignedIntValue() * 2; } ) );
+    CF::Array a3( CF::Parallel::Map( CF::ArrayView< CFNumberRef >( a1 ), []( CFNumberRef value ) { return std::to_string( CF::Number( value ).GetSignedIntValue() ); } ) );
+    CF::Array a4( CF::Parallel::Map( a1, []( CFTypeRef ) -> CFTypeRef { return nullptr; } ) );
+    
+    ASSERT_EQ( a2.GetCount(), 20000 );
+    ASSERT_EQ( a3.GetCount(), 20000 );
+    ASSERT_EQ( a4.GetCount(), 0 );
+    ASSERT_TRUE( a4.IsValid() );
+    
+    ASSERT_EQ( CF::Number( a2[ 12345 ] ).GetSignedIntValue(), 24690 );
+    ASSERT_TRUE( CF::String( a3[ 12345 ] ) == "12345" );
+}
+
+TEST( CFPP_Parallel, Filter )
+{
+    CF::Array a1( __Numbers( 20000 ) );
+    CF::Array a2( CF::Parallel::Filter( a1, []( CFTypeRef value ) { return CF::Number( value ).GetSignedIntValue() % 2 == 0; } ) );
+    CF::Array a3( CF::Parallel::Filter( CF::ArrayView< CFNumberRef >( a1 ), []( CFNumberRef ) { return false; } ) );
+    
+    ASSERT_EQ( a2.GetCount(), 10000 );
+    ASSERT_EQ( a3.GetCount(), 0 );
+    
+    ASSERT_TRUE( a2[ 5 ] == a1[ 10 ] );
+    ASSERT_EQ( CF::Number( a2[ 9999 ] ).GetSignedIntValue(), 19998 );
+}
+
+TEST( CFPP_Parallel, Reduce )
+{
+    CF::Array a1( __Numbers( 20000 ) );
+    CF::Array a2( std::vector< std::string >( { "a", "b", "c" } ) );
+    CF::Array a3( static_cast< CFArrayRef >( nullptr ) );
+    
+    ASSERT_EQ( CF::Parallel::Reduce( a1, static_cast< int64_t >( 0 ), std::plus< int64_t >() ), static_cast< int64_t >( 19999 ) * 20000 / 2 );
+    ASSERT_EQ( CF::Parallel::Reduce( a2, std::string( ">" ), std::plus< std::string >() ), ">abc" );
+    ASSERT_EQ( CF::Parallel::Reduce( a3, 42, std::plus< int >() ), 42 );
+    
+    ASSERT_EQ
+    (
+        CF::Parallel::Reduce
+        (
+            CF::ArrayView< CFNumberRef >( a1 ),
+            static_cast< CFIndex >( 0 ),
+            []( CFIndex v1, CFIndex v2 ) { return std::max( v1, v2 ); },
+            []( CFNumberRef value ) { return static_cast< CFIndex >( CF::Number( value ).GetSignedLongValue() ); }
+        ),
+        19999
+    );
+}
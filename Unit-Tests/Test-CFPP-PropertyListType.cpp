@@ -52,6 +52,11 @@ TEST( CFPP_PropertyListType, FromPropertyList )
     ASSERT_GT( d.GetCount(), 0 );
     ASSERT_EQ( CF::String( d[ "CFBundleIdentifier" ] ), "com.apple.CoreFoundation" );
     
+    d = CF::Dictionary::FromPropertyList( "/System/Library/Frameworks/CoreFoundation.framework/Versions/A/Resources/Info.plist", true );
+    
+    ASSERT_TRUE( d.IsValid() );
+    ASSERT_EQ( CF::String( d[ "CFBundleIdentifier" ] ), "com.apple.CoreFoundation" );
+    
     d = CF::Dictionary::FromPropertyList( "" );
     
     ASSERT_FALSE( d.IsValid() );
@@ -61,6 +66,29 @@ TEST( CFPP_PropertyListType, FromPropertyList )
     ASSERT_FALSE( d.IsValid() );
 }
 
+TEST( CFPP_PropertyListType, FromPropertyList_GZip )
+{
+    CF::Dictionary  d;
+    CF::WriteStream s( std::string( "/tmp/com.xs-labs.cfpp.plist.gz" ) );
+    
+    ASSERT_TRUE( s.Open() );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE( s.WriteAll( CF::Data( std::string( __plist ) ).Compress( CF::Data::CompressionGzip ) ) );
+    #endif
+    
+    s.Close();
+    
+    d = CF::Dictionary::FromPropertyList( "/tmp/com.xs-labs.cfpp.plist.gz" );
+    
+    #ifdef CFPP_ZLIB
+    ASSERT_TRUE(  d.IsValid() );
+    ASSERT_EQ(    CF::String( d[ "hello" ] ), "world" );
+    #else
+    ASSERT_FALSE( d.IsValid() );
+    #endif
+}
+
 TEST( CFPP_PropertyListType, FromPropertyListString )
 {
     CF::Dictionary d;
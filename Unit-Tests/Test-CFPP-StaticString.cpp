@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-StaticString.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::StaticString
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+using namespace CF::Literals;
+
+TEST( CFPP_StaticString, CTOR )
+{
+    static const CF::StaticString s( "hello, world" );
+    
+    ASSERT_TRUE( s.GetStringView() == "hello, world" );
+    ASSERT_TRUE( CF::String( s.GetCFObject() ) == "hello, world" );
+}
+
+TEST( CFPP_StaticString, CTOR_Length )
+{
+    CF::StaticString s( "hello, world", 5 );
+    
+    ASSERT_TRUE( s.GetStringView() == "hello" );
+    ASSERT_TRUE( CF::String( s.GetCFObject() ) == "hello" );
+}
+
+TEST( CFPP_StaticString, CCTOR )
+{
+    CF::StaticString s1( "hello, world" );
+    CF::StaticString s2( s1 );
+    
+    ASSERT_TRUE( s2.GetStringView() == "hello, world" );
+    ASSERT_TRUE( s1.GetCFObject() == s2.GetCFObject() );
+}
+
+TEST( CFPP_StaticString, OperatorAssign )
+{
+    CF::StaticString s1( "hello, world" );
+    CF::StaticString s2( "hello, universe" );
+    
+    s2 = s1;
+    
+    ASSERT_TRUE( s2.GetStringView() == "hello, world" );
+    ASSERT_TRUE( s1.GetCFObject() == s2.GetCFObject() );
+}
+
+TEST( CFPP_StaticString, OperatorCastToCFString )
+{
+    CF::StaticString s( "hello, world" );
+    CFStringRef      cf;
+    
+    cf = s;
+    
+    ASSERT_TRUE( cf != nullptr );
+    ASSERT_TRUE( cf == s.GetCFObject() );
+}
+
+TEST( CFPP_StaticString, GetCFObject )
+{
+    CF::StaticString s1( "hello, world" );
+    CF::StaticString s2( "hello, world" );
+    CF::StaticString s3( "hello, universe" );
+    
+    ASSERT_TRUE( s1.GetCFObject() != nullptr );
+    ASSERT_TRUE( s1.GetCFObject() == s1.GetCFObject() );
+    ASSERT_TRUE( s1.GetCFObject() == s2.GetCFObject() );
+    ASSERT_TRUE( s1.GetCFObject() != s3.GetCFObject() );
+    ASSERT_TRUE( s1.GetCFObject() == CF::String::GetInterned( "hello, world" ) );
+}
+
+TEST( CFPP_StaticString, GetStringView )
+{
+    CF::StaticString s1( "hello, world" );
+    CF::StaticString s2( "" );
+    
+    ASSERT_TRUE( s1.GetStringView() == "hello, world" );
+    ASSERT_TRUE( s2.GetStringView().length() == 0 );
+}
+
+TEST( CFPP_StaticString, Literal )
+{
+    CF::Dictionary d;
+    
+    d.SetValue( "key"_cfs, CF::String( "value" ) );
+    
+    ASSERT_TRUE( "key"_cfs.GetCFObject() == CF::String::Intern( "key" ) );
+    ASSERT_TRUE( CF::String( d[ "key"_cfs ] ) == "value" );
+    ASSERT_TRUE( CF::String( d[ "key" ] )     == "value" );
+    ASSERT_TRUE( d.ContainsKey( "key"_cfs ) );
+}
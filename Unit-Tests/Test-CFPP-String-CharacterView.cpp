@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-String-CharacterView.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::String::CharacterView
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_String_CharacterView, CTOR )
+{
+    CF::String::CharacterView v;
+    
+    ASSERT_EQ( v.GetLength(), 0 );
+    ASSERT_EQ( v[ 0 ], 0 );
+}
+
+TEST( CFPP_String_CharacterView, CTOR_String )
+{
+    CF::String                s1( "hello" );
+    CF::String                s2( static_cast< CFStringRef >( nullptr ) );
+    CF::String::CharacterView v1( s1 );
+    CF::String::CharacterView v2( s2 );
+    
+    ASSERT_EQ( v1.GetLength(), 5 );
+    ASSERT_EQ( v2.GetLength(), 0 );
+    ASSERT_EQ( v1[ 0 ], 'h' );
+    ASSERT_EQ( v2[ 0 ], 0 );
+}
+
+TEST( CFPP_String_CharacterView, CCTOR )
+{
+    CF::String                s( "hello" );
+    CF::String::CharacterView v1( s );
+    CF::String::CharacterView v2( v1 );
+    
+    ASSERT_EQ( v1.GetLength(), 5 );
+    ASSERT_EQ( v2.GetLength(), 5 );
+    ASSERT_EQ( v1[ 4 ], 'o' );
+    ASSERT_EQ( v2[ 4 ], 'o' );
+}
+
+TEST( CFPP_String_CharacterView, MCTOR )
+{
+    CF::String                s( "hello" );
+    CF::String::CharacterView v1( s );
+    CF::String::CharacterView v2( std::move( v1 ) );
+    
+    ASSERT_EQ( v1.GetLength(), 0 );
+    ASSERT_EQ( v2.GetLength(), 5 );
+    ASSERT_EQ( v1[ 4 ], 0 );
+    ASSERT_EQ( v2[ 4 ], 'o' );
+}
+
+TEST( CFPP_String_CharacterView, OperatorAssign )
+{
+    CF::String                s( "hello" );
+    CF::String::CharacterView v1( s );
+    CF::String::CharacterView v2;
+    
+    ASSERT_EQ( v2.GetLength(), 0 );
+    
+    v2 = v1;
+    
+    ASSERT_EQ( v2.GetLength(), 5 );
+    ASSERT_EQ( v2[ 1 ], 'e' );
+}
+
+TEST( CFPP_String_CharacterView, OperatorSubscript )
+{
+    CF::String                s1( "hello, world" );
+    CF::String                s2( std::string( 200, 'a' ) + "\xC3\xA9" );
+    CF::String::CharacterView v1( s1 );
+    CF::String::CharacterView v2( s2 );
+    CFIndex                   i;
+    
+    ASSERT_EQ( v1[  0 ], 'h' );
+    ASSERT_EQ( v1[ 11 ], 'd' );
+    ASSERT_EQ( v1[ 12 ], 0 );
+    ASSERT_EQ( v1[ -1 ], 0 );
+    
+    for( i = 0; i < 200; i++ )
+    {
+        ASSERT_EQ( v2[ i ], 'a' );
+    }
+    
+    ASSERT_EQ( v2[ 200 ], 0xE9 );
+    ASSERT_EQ( v2[   0 ], 'a' );
+    ASSERT_EQ( v2[ 201 ], 0 );
+}
+
+TEST( CFPP_String_CharacterView, GetLength )
+{
+    CF::String s1( "hello" );
+    CF::String s2( "\xF0\x9F\x98\x80" );
+    CF::String s3;
+    
+    ASSERT_EQ( CF::String::CharacterView( s1 ).GetLength(), 5 );
+    ASSERT_EQ( CF::String::CharacterView( s2 ).GetLength(), 2 );
+    ASSERT_EQ( CF::String::CharacterView( s3 ).GetLength(), 0 );
+}
+
+TEST( CFPP_String_CharacterView, GetCharactersPtr )
+{
+    UniChar                   c[ 3 ] = { 'a', 'b', 'c' };
+    CF::AutoPointer           p( CFStringCreateWithCharactersNoCopy( nullptr, c, 3, kCFAllocatorNull ) );
+    CF::String                s1( p );
+    CF::String                s2;
+    CF::String::CharacterView v1( s1 );
+    CF::String::CharacterView v2( s2 );
+    
+    if( v1.GetCharactersPtr() != nullptr )
+    {
+        ASSERT_EQ( v1.GetCharactersPtr()[ 2 ], 'c' );
+    }
+    
+    ASSERT_EQ( v1[ 2 ], 'c' );
+    ASSERT_TRUE( v2.GetCharactersPtr() == nullptr );
+}
+
+TEST( CFPP_String_CharacterView, Swap )
+{
+    CF::String                s1( "abc" );
+    CF::String                s2( "hello" );
+    CF::String::CharacterView v1( s1 );
+    CF::String::CharacterView v2( s2 );
+    
+    swap( v1, v2 );
+    
+    ASSERT_EQ( v1.GetLength(), 5 );
+    ASSERT_EQ( v2.GetLength(), 3 );
+    ASSERT_EQ( v1[ 0 ], 'h' );
+    ASSERT_EQ( v2[ 0 ], 'a' );
+}
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-String-CodePointIterator.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::String::CodePointIterator
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_String_CodePointIterator, CTOR )
+{
+    CF::String::CodePointIterator i;
+    
+    ASSERT_TRUE( *( i ) == 0 );
+    ASSERT_EQ( i.GetIndex(), 0 );
+    ASSERT_TRUE( i == CF::String::CodePointIterator() );
+}
+
+TEST( CFPP_String_CodePointIterator, CCTOR )
+{
+    CF::String                    s( "abc" );
+    CF::String::CodePointIterator i1( s.GetCodePoints().begin() );
+    CF::String::CodePointIterator i2( i1 );
+    
+    ASSERT_TRUE( *( i1 ) == 'a' );
+    ASSERT_TRUE( *( i2 ) == 'a' );
+    ASSERT_TRUE( i1 == i2 );
+}
+
+TEST( CFPP_String_CodePointIterator, MCTOR )
+{
+    CF::String                    s( "abc" );
+    CF::String::CodePointIterator i1( s.GetCodePoints().begin() );
+    CF::String::CodePointIterator i2( std::move( i1 ) );
+    
+    ASSERT_TRUE( *( i1 ) == 0 );
+    ASSERT_TRUE( *( i2 ) == 'a' );
+}
+
+TEST( CFPP_String_CodePointIterator, OperatorAssign )
+{
+    CF::String                    s( "abc" );
+    CF::String::CodePointIterator i1( s.GetCodePoints().begin() );
+    CF::String::CodePointIterator i2;
+    
+    i2 = i1;
+    
+    ASSERT_TRUE( *( i2 ) == 'a' );
+    ASSERT_TRUE( i1 == i2 );
+}
+
+TEST( CFPP_String_CodePointIterator, OperatorPrefixIncrement )
+{
+    CF::String                    s( "a\xF0\x9F\x98\x80" "b" );
+    CF::String::CodePointView     v( s );
+    CF::String::CodePointIterator i( v.begin() );
+    
+    ASSERT_TRUE( *( i ) == 'a' );
+    ASSERT_TRUE( *( ++i ) == 0x1F600 );
+    ASSERT_TRUE( *( ++i ) == 'b' );
+    ASSERT_TRUE( ++i == v.end() );
+    ASSERT_TRUE( ++i == v.end() );
+}
+
+TEST( CFPP_String_CodePointIterator, OperatorPostfixIncrement )
+{
+    CF::String                    s( "ab" );
+    CF::String::CodePointView     v( s );
+    CF::String::CodePointIterator i( v.begin() );
+    
+    ASSERT_TRUE( *( i++ ) == 'a' );
+    ASSERT_TRUE( *( i++ ) == 'b' );
+    ASSERT_TRUE( i == v.end() );
+}
+
+TEST( CFPP_String_CodePointIterator, OperatorEqual )
+{
+    CF::String                s1( "ab" );
+    CF::String                s2( "ab" );
+    CF::String::CodePointView v1( s1 );
+    CF::String::CodePointView v2( s2 );
+    
+    ASSERT_TRUE(  v1.begin() == v1.begin() );
+    ASSERT_TRUE(  v1.end()   == v1.end() );
+    ASSERT_FALSE( v1.begin() == v1.end() );
+    ASSERT_FALSE( v1.begin() == v2.begin() );
+}
+
+TEST( CFPP_String_CodePointIterator, OperatorNotEqual )
+{
+    CF::String                s1( "ab" );
+    CF::String                s2( "ab" );
+    CF::String::CodePointView v1( s1 );
+    CF::String::CodePointView v2( s2 );
+    
+    ASSERT_FALSE( v1.begin() != v1.begin() );
+    ASSERT_FALSE( v1.end()   != v1.end() );
+    ASSERT_TRUE(  v1.begin() != v1.end() );
+    ASSERT_TRUE(  v1.begin() != v2.begin() );
+}
+
+TEST( CFPP_String_CodePointIterator, OperatorDereference )
+{
+    UniChar                       c[ 3 ] = { 0xD83D, 'a', 0xDE00 };
+    CF::String                    s( CF::AutoPointer( CFStringCreateWithCharacters( nullptr, c, 3 ) ) );
+    CF::String::CodePointView     v( s );
+    CF::String::CodePointIterator i( v.begin() );
+    
+    ASSERT_TRUE( *( i++ ) == 0xFFFD );
+    ASSERT_TRUE( *( i++ ) == 'a' );
+    ASSERT_TRUE( *( i++ ) == 0xFFFD );
+    ASSERT_TRUE( *( i )   == 0 );
+    ASSERT_TRUE( i == v.end() );
+}
+
+TEST( CFPP_String_CodePointIterator, GetIndex )
+{
+    CF::String                    s( "a\xF0\x9F\x98\x80" "b" );
+    CF::String::CodePointView     v( s );
+    CF::String::CodePointIterator i( v.begin() );
+    
+    ASSERT_EQ( ( i++ ).GetIndex(), 0 );
+    ASSERT_EQ( ( i++ ).GetIndex(), 1 );
+    ASSERT_EQ( ( i++ ).GetIndex(), 3 );
+    ASSERT_EQ( i.GetIndex(), 4 );
+}
+
+TEST( CFPP_String_CodePointIterator, Swap )
+{
+    CF::String                    s1( "a" );
+    CF::String                    s2( "b" );
+    CF::String::CodePointIterator i1( s1.GetCodePoints().begin() );
+    CF::String::CodePointIterator i2( s2.GetCodePoints().begin() );
+    
+    swap( i1, i2 );
+    
+    ASSERT_TRUE( *( i1 ) == 'b' );
+    ASSERT_TRUE( *( i2 ) == 'a' );
+}
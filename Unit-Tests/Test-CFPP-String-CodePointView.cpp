@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-String-CodePointView.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::String::CodePointView
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_String_CodePointView, CTOR )
+{
+    CF::String::CodePointView v;
+    
+    ASSERT_TRUE( v.begin() == v.end() );
+}
+
+TEST( CFPP_String_CodePointView, CTOR_String )
+{
+    CF::String                s1( "abc" );
+    CF::String                s2( static_cast< CFStringRef >( nullptr ) );
+    CF::String                s3( "" );
+    CF::String::CodePointView v1( s1 );
+    CF::String::CodePointView v2( s2 );
+    CF::String::CodePointView v3( s3 );
+    
+    ASSERT_TRUE( v1.begin() != v1.end() );
+    ASSERT_TRUE( v2.begin() == v2.end() );
+    ASSERT_TRUE( v3.begin() == v3.end() );
+}
+
+TEST( CFPP_String_CodePointView, CCTOR )
+{
+    CF::String                s( "abc" );
+    CF::String::CodePointView v1( s );
+    CF::String::CodePointView v2( v1 );
+    
+    ASSERT_TRUE( *( v1.begin() ) == 'a' );
+    ASSERT_TRUE( *( v2.begin() ) == 'a' );
+}
+
+TEST( CFPP_String_CodePointView, MCTOR )
+{
+    CF::String                s( "abc" );
+    CF::String::CodePointView v1( s );
+    CF::String::CodePointView v2( std::move( v1 ) );
+    
+    ASSERT_TRUE( v1.begin() == v1.end() );
+    ASSERT_TRUE( *( v2.begin() ) == 'a' );
+}
+
+TEST( CFPP_String_CodePointView, OperatorAssign )
+{
+    CF::String                s( "abc" );
+    CF::String::CodePointView v1( s );
+    CF::String::CodePointView v2;
+    
+    v2 = v1;
+    
+    ASSERT_TRUE( *( v2.begin() ) == 'a' );
+}
+
+TEST( CFPP_String_CodePointView, Begin )
+{
+    CF::String                s( "\xF0\x9F\x98\x80" );
+    CF::String::CodePointView v( s );
+    
+    ASSERT_TRUE( *( v.begin() ) == 0x1F600 );
+    ASSERT_EQ( v.begin().GetIndex(), 0 );
+}
+
+TEST( CFPP_String_CodePointView, End )
+{
+    CF::String                s( "\xF0\x9F\x98\x80" );
+    CF::String::CodePointView v( s );
+    
+    ASSERT_TRUE( *( v.end() ) == 0 );
+    ASSERT_EQ( v.end().GetIndex(), 2 );
+}
+
+TEST( CFPP_String_CodePointView, RangeFor )
+{
+    CF::String               s( "h\xC3\xA9llo \xF0\x9F\x98\x80" );
+    std::vector< UTF32Char > v;
+    
+    for( UTF32Char c: s.GetCodePoints() )
+    {
+        v.push_back( c );
+    }
+    
+    ASSERT_TRUE( v.size() == 7 );
+    ASSERT_TRUE( v[ 1 ] == 0xE9 );
+    ASSERT_TRUE( v[ 6 ] == 0x1F600 );
+}
+
+TEST( CFPP_String_CodePointView, Swap )
+{
+    CF::String                s1( "a" );
+    CF::String                s2( "b" );
+    CF::String::CodePointView v1( s1 );
+    CF::String::CodePointView v2( s2 );
+    
+    swap( v1, v2 );
+    
+    ASSERT_TRUE( *( v1.begin() ) == 'b' );
+    ASSERT_TRUE( *( v2.begin() ) == 'a' );
+}
@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-String-Encoder.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::String::Encoder
+ */
+
+#include <CF++.hpp>
+#include <cstring>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_String_Encoder, CTOR )
+{
+    CF::String::Encoder e;
+    UInt8               b[ 4 ];
+    
+    ASSERT_TRUE(  e.IsAtEnd() );
+    ASSERT_FALSE( e.HasFailed() );
+    ASSERT_EQ(    e.GetLocation(), 0 );
+    ASSERT_EQ(    e.Read( b, sizeof( b ) ), 0 );
+}
+
+TEST( CFPP_String_Encoder, CTOR_String )
+{
+    CF::String          s( "hello" );
+    CF::String::Encoder e( s );
+    UInt8               b[ 8 ];
+    
+    ASSERT_FALSE( e.IsAtEnd() );
+    ASSERT_EQ( e.Read( b, sizeof( b ) ), 5 );
+    ASSERT_TRUE( e.IsAtEnd() );
+    ASSERT_TRUE( memcmp( b, "hello", 5 ) == 0 );
+}
+
+TEST( CFPP_String_Encoder, CTOR_String_LossByte )
+{
+    CF::String          s( "h\xC3\xA9llo" );
+    CF::String::Encoder e1( s, kCFStringEncodingASCII );
+    CF::String::Encoder e2( s, kCFStringEncodingASCII, '?' );
+    UInt8               b[ 8 ];
+    
+    ASSERT_EQ( e1.Read( b, sizeof( b ) ), 1 );
+    ASSERT_EQ( e1.Read( b, sizeof( b ) ), 0 );
+    ASSERT_TRUE(  e1.HasFailed() );
+    ASSERT_FALSE( e1.IsAtEnd() );
+    
+    ASSERT_EQ( e2.Read( b, sizeof( b ) ), 5 );
+    ASSERT_TRUE(  e2.IsAtEnd() );
+    ASSERT_FALSE( e2.HasFailed() );
+    ASSERT_TRUE( memcmp( b, "h?llo", 5 ) == 0 );
+}
+
+TEST( CFPP_String_Encoder, CTOR_String_BOM )
+{
+    CF::String          s1( "a" );
+    CF::String          s2( "" );
+    CF::String::Encoder e1( s1, kCFStringEncodingUTF8,    0, true );
+    CF::String::Encoder e2( s1, kCFStringEncodingUTF16BE, 0, true );
+    CF::String::Encoder e3( s2, kCFStringEncodingUTF16LE, 0, true );
+    UInt8               b[ 8 ];
+    
+    ASSERT_EQ( e1.Read( b, sizeof( b ) ), 4 );
+    ASSERT_TRUE( b[ 0 ] == 0xEF && b[ 1 ] == 0xBB && b[ 2 ] == 0xBF && b[ 3 ] == 'a' );
+    
+    ASSERT_EQ( e2.Read( b, sizeof( b ) ), 4 );
+    ASSERT_TRUE( b[ 0 ] == 0xFE && b[ 1 ] == 0xFF && b[ 2 ] == 0x00 && b[ 3 ] == 'a' );
+    
+    ASSERT_FALSE( e3.IsAtEnd() );
+    ASSERT_EQ( e3.Read( b, sizeof( b ) ), 2 );
+    ASSERT_TRUE( b[ 0 ] == 0xFF && b[ 1 ] == 0xFE );
+    ASSERT_TRUE( e3.IsAtEnd() );
+}
+
+TEST( CFPP_String_Encoder, CCTOR )
+{
+    CF::String          s( "hello" );
+    CF::String::Encoder e1( s );
+    UInt8               b[ 8 ];
+    
+    ASSERT_EQ( e1.Read( b, 2 ), 2 );
+    
+    {
+        CF::String::Encoder e2( e1 );
+        
+        ASSERT_EQ( e2.GetLocation(), 2 );
+        ASSERT_EQ( e2.Read( b, sizeof( b ) ), 3 );
+        ASSERT_TRUE( memcmp( b, "llo", 3 ) == 0 );
+    }
+    
+    ASSERT_EQ( e1.GetLocation(), 2 );
+}
+
+TEST( CFPP_String_Encoder, MCTOR )
+{
+    CF::String          s( "hello" );
+    CF::String::Encoder e1( s );
+    CF::String::Encoder e2( std::move( e1 ) );
+    
+    ASSERT_TRUE(  e1.IsAtEnd() );
+    ASSERT_FALSE( e2.IsAtEnd() );
+}
+
+TEST( CFPP_String_Encoder, OperatorAssign )
+{
+    CF::String          s( "hello" );
+    CF::String::Encoder e1( s );
+    CF::String::Encoder e2;
+    
+    e2 = e1;
+    
+    ASSERT_FALSE( e2.IsAtEnd() );
+    ASSERT_EQ( e2.GetLocation(), 0 );
+}
+
+TEST( CFPP_String_Encoder, Read )
+{
+    CF::String          s( std::string( 1000, 'a' ) + "\xC3\xA9" );
+    CF::String::Encoder e( s );
+    UInt8               b[ 64 ];
+    std::string         v;
+    CFIndex             n;
+    
+    while( e.IsAtEnd() == false )
+    {
+        n = e.Read( b, sizeof( b ) );
+        
+        ASSERT_TRUE( n > 0 );
+        
+        v.append( reinterpret_cast< char * >( b ), static_cast< std::size_t >( n ) );
+    }
+    
+    ASSERT_TRUE( v == s.GetValue() );
+    ASSERT_EQ( e.Read( b, sizeof( b ) ), 0 );
+}
+
+TEST( CFPP_String_Encoder, Read_SmallBuffer )
+{
+    CF::String          s( "\xC3\xA9" );
+    CF::String::Encoder e( s );
+    UInt8               b[ 2 ];
+    
+    ASSERT_EQ( e.Read( b, 1 ), 0 );
+    ASSERT_FALSE( e.HasFailed() );
+    ASSERT_EQ( e.Read( b, 2 ), 2 );
+    ASSERT_TRUE( e.IsAtEnd() );
+    ASSERT_EQ( e.Read( nullptr, 2 ), 0 );
+}
+
+TEST( CFPP_String_Encoder, IsAtEnd )
+{
+    CF::String          s1( "a" );
+    CF::String          s2( "" );
+    CF::String::Encoder e1( s1 );
+    CF::String::Encoder e2( s2 );
+    UInt8               b[ 2 ];
+    
+    ASSERT_FALSE( e1.IsAtEnd() );
+    ASSERT_TRUE(  e2.IsAtEnd() );
+    
+    e1.Read( b, sizeof( b ) );
+    
+    ASSERT_TRUE( e1.IsAtEnd() );
+}
+
+TEST( CFPP_String_Encoder, HasFailed )
+{
+    CF::String          s( "\xC3\xA9" );
+    CF::String::Encoder e( s, kCFStringEncodingASCII );
+    UInt8               b[ 2 ];
+    
+    ASSERT_FALSE( e.HasFailed() );
+    ASSERT_EQ( e.Read( b, sizeof( b ) ), 0 );
+    ASSERT_TRUE( e.HasFailed() );
+}
+
+TEST( CFPP_String_Encoder, GetLocation )
+{
+    CF::String          s( "a\xF0\x9F\x98\x80" "b" );
+    CF::String::Encoder e( s );
+    UInt8               b[ 5 ];
+    
+    ASSERT_EQ( e.GetLocation(), 0 );
+    ASSERT_EQ( e.Read( b, 3 ), 1 );
+    ASSERT_EQ( e.GetLocation(), 1 );
+    ASSERT_EQ( e.Read( b, 5 ), 5 );
+    ASSERT_EQ( e.GetLocation(), 4 );
+}
+
+TEST( CFPP_String_Encoder, Swap )
+{
+    CF::String          s1( "a" );
+    CF::String          s2( "" );
+    CF::String::Encoder e1( s1 );
+    CF::String::Encoder e2( s2 );
+    
+    swap( e1, e2 );
+    
+    ASSERT_TRUE(  e1.IsAtEnd() );
+    ASSERT_FALSE( e2.IsAtEnd() );
+}
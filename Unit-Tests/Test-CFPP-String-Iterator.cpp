@@ -551,3 +551,102 @@ TEST( CFPP_String_Iterator, TestIterateCPP11 )
         ASSERT_EQ( i, 5 );
     }
 }
+
+TEST( CFPP_String_Iterator, TestIterateUTF8 )
+{
+    CF::String           s( std::string( 100, 'a' ) + "\xC3\xA9" + std::string( 100, 'b' ) );
+    CF::String::Iterator it;
+    std::string          v;
+    
+    for( it = s.begin(); it != s.end(); ++it )
+    {
+        v += *( it );
+    }
+    
+    ASSERT_TRUE( v == s.GetValue() );
+    ASSERT_TRUE( v.length() == 202 );
+    
+    it = s.end();
+    
+    ASSERT_EQ( *( --it ), 'b' );
+    ASSERT_EQ( *( it -= 100 ), static_cast< char >( 0xA9 ) );
+    ASSERT_EQ( *( --it ), static_cast< char >( 0xC3 ) );
+    ASSERT_EQ( *( --it ), 'a' );
+}
+
+TEST( CFPP_String_Iterator, TestIterateUTF16 )
+{
+    CF::String           s( "ab" );
+    CF::String::Iterator it;
+    CFIndex              i;
+    
+    i = 0;
+    
+    for( it = s.begin( kCFStringEncodingUTF16 ); it != s.end( kCFStringEncodingUTF16 ); ++it )
+    {
+        i++;
+    }
+    
+    ASSERT_EQ( i, 4 );
+    ASSERT_TRUE( s.begin( kCFStringEncodingUTF16 ) != s.begin( kCFStringEncodingUTF8 ) );
+}
+
+TEST( CFPP_String_Iterator, OperatorMinusIterator )
+{
+    CF::String s( "hello" );
+    
+    ASSERT_EQ( s.end() - s.begin(), 5 );
+    ASSERT_EQ( s.begin() - s.end(), -5 );
+    ASSERT_EQ( ( s.begin() + static_cast< CFIndex >( 2 ) ) - s.begin(), 2 );
+    ASSERT_EQ( s.end() - ( s.end() - static_cast< CFIndex >( 1 ) ), 1 );
+    ASSERT_EQ( ( static_cast< CFIndex >( 2 ) + s.begin() ) - s.begin(), 2 );
+}
+
+TEST( CFPP_String_Iterator, OperatorSubscript )
+{
+    CF::String           s( "hello" );
+    CF::String::Iterator i;
+    
+    i = s.begin() + static_cast< CFIndex >( 1 );
+    
+    ASSERT_EQ( i[ -1 ], 'h' );
+    ASSERT_EQ( i[ 0 ], 'e' );
+    ASSERT_EQ( i[ 3 ], 'o' );
+    ASSERT_EQ( i[ 4 ], 0 );
+    ASSERT_EQ( s.end()[ -1 ], 'o' );
+    ASSERT_EQ( CF::String::Iterator()[ 0 ], 0 );
+}
+
+TEST( CFPP_String_Iterator, OperatorRelational )
+{
+    CF::String           s( "hello" );
+    CF::String::Iterator i;
+    
+    i = s.begin() + static_cast< CFIndex >( 4 );
+    
+    ASSERT_TRUE(  s.begin() <  s.end() );
+    ASSERT_FALSE( s.end()   <  s.begin() );
+    ASSERT_TRUE(  s.end()   >  i );
+    ASSERT_TRUE(  i         <= s.end() );
+    ASSERT_FALSE( i         >= s.end() );
+    ASSERT_TRUE(  s.end()   >= s.end() );
+    ASSERT_TRUE(  s.begin() <= s.begin() );
+}
+
+TEST( CFPP_String_Iterator, TestReverseUTF8 )
+{
+    CF::String           s( std::string( 300, 'a' ) + "\xC3\xA9" + std::string( 300, 'b' ) );
+    std::string          v;
+    CF::String::Iterator it;
+    
+    for( it = s.end(); it != s.begin(); )
+    {
+        v.insert( v.begin(), *( --it ) );
+    }
+    
+    ASSERT_TRUE( v == s.GetValue() );
+    ASSERT_EQ( s.end() - s.begin(), 602 );
+    ASSERT_EQ( ( s.end() - static_cast< CFIndex >( 1 ) )[ -601 ], 'a' );
+    ASSERT_EQ( ( s.end() - static_cast< CFIndex >( 1 ) )[ -301 ], static_cast< char >( 0xC3 ) );
+    ASSERT_EQ( ( s.begin() + static_cast< CFIndex >( 500 ) )[ -200 ], static_cast< char >( 0xC3 ) );
+}
@@ -29,6 +29,8 @@
  */
 
 #include <CF++.hpp>
+#include <map>
+#include <unordered_map>
 
 #define XSTEST_GTEST_COMPAT
 #include <XSTest/XSTest.hpp>
@@ -135,6 +137,25 @@ TEST( CFPP_String, CTOR_STDString_Encoding )
     ASSERT_TRUE( s1.GetValue() == "hello, world" );
 }
 
+TEST( CFPP_String, CTOR_STDStringView_Encoding )
+{
+    const char buf[] = { 'h', 'e', 'l', 'l', 'o', 0, 'w', 'o', 'r', 'l', 'd' };
+    CF::String s1( std::string_view( "hello, world" ), kCFStringEncodingASCII );
+    CF::String s2( std::string_view( "hello, world" ).substr( 0, 5 ) );
+    CF::String s3( std::string_view( buf, sizeof( buf ) ) );
+    CF::String s4( std::string_view{} );
+    
+    ASSERT_TRUE( s1.IsValid() );
+    ASSERT_TRUE( s2.IsValid() );
+    ASSERT_TRUE( s3.IsValid() );
+    ASSERT_TRUE( s4.IsValid() );
+    ASSERT_TRUE( s1.GetValue() == "hello, world" );
+    ASSERT_TRUE( s2.GetValue() == "hello" );
+    ASSERT_TRUE( s3.GetValue() == std::string( buf, sizeof( buf ) ) );
+    ASSERT_TRUE( s4.GetValue() == "" );
+    ASSERT_EQ(   s3.GetLength(), 11 );
+}
+
 TEST( CFPP_String, CTOR_Char_Encoding )
 {
     CF::String s1( const_cast< char * >( "hello, world" ), kCFStringEncodingASCII );
@@ -175,6 +196,79 @@ TEST( CFPP_String, MCTOR )
     ASSERT_TRUE(  s2.GetValue() == "hello, world" );
 }
 
+TEST( CFPP_String, NoCopy )
+{
+    char       buf[] = "hello, world";
+    CF::String s1( CF::String::NoCopy( std::string_view( buf, 5 ) ) );
+    CF::String s2( CF::String::NoCopy( buf, kCFStringEncodingASCII ) );
+    CF::String s3( CF::String::NoCopy( std::string_view() ) );
+    
+    ASSERT_TRUE( s1.IsValid() );
+    ASSERT_TRUE( s2.IsValid() );
+    ASSERT_TRUE( s3.IsValid() );
+    ASSERT_TRUE( s1 == "hello" );
+    ASSERT_TRUE( s2 == "hello, world" );
+    ASSERT_TRUE( s3 == "" );
+}
+
+TEST( CFPP_String, NoCopy_Deallocator )
+{
+    char * buf;
+    
+    buf = static_cast< char * >( CFAllocatorAllocate( nullptr, 12, 0 ) );
+    
+    memcpy( buf, "hello, world", 12 );
+    
+    {
+        CF::String s( CF::String::NoCopy( std::string_view( buf, 12 ), static_cast< CFAllocatorRef >( nullptr ) ) );
+        
+        ASSERT_TRUE( s.IsValid() );
+        ASSERT_TRUE( s == "hello, world" );
+    }
+}
+
+TEST( CFPP_String, Intern )
+{
+    CFStringRef s1 = CF::String::Intern( "hello, world" );
+    CFStringRef s2 = CF::String::Intern( std::string( "hello, world" ) );
+    CFStringRef s3 = CF::String::Intern( "hello, universe" );
+    CFStringRef s4 = CF::String::Intern( std::string_view( "\xFF", 1 ) );
+    
+    ASSERT_TRUE( s1 != nullptr );
+    ASSERT_TRUE( s1 == s2 );
+    ASSERT_TRUE( s1 != s3 );
+    ASSERT_TRUE( s4 == nullptr );
+    ASSERT_TRUE( CF::String( s1 ) == "hello, world" );
+}
+
+TEST( CFPP_String, GetInterned )
+{
+    ASSERT_TRUE( CF::String::GetInterned( "CFPP_String_GetInterned" ) == nullptr );
+    
+    CF::String::Intern( "CFPP_String_GetInterned" );
+    
+    ASSERT_TRUE( CF::String::GetInterned( "CFPP_String_GetInterned" ) != nullptr );
+    ASSERT_TRUE( CF::String::GetInterned( "CFPP_String_GetInterned" ) == CF::String::Intern( "CFPP_String_GetInterned" ) );
+}
+
+TEST( CFPP_String, GetInterned_Many )
+{
+    std::vector< CFStringRef > strings;
+    
+    for( int i = 0; i < 1000; i++ )
+    {
+        strings.push_back( CF::String::Intern( "CFPP_String_GetInterned_Many_" + std::to_string( i ) ) );
+    }
+    
+    for( int i = 0; i < 1000; i++ )
+    {
+        ASSERT_TRUE( CF::String::GetInterned( "CFPP_String_GetInterned_Many_" + std::to_string( i ) ) == strings[ static_cast< std::size_t >( i ) ] );
+        ASSERT_TRUE( CF::String( strings[ static_cast< std::size_t >( i ) ] ) == "CFPP_String_GetInterned_Many_" + std::to_string( i ) );
+    }
+    
+    ASSERT_TRUE( CF::String::GetInterned( "CFPP_String_GetInterned_Many_1000" ) == nullptr );
+}
+
 TEST( CFPP_String, OperatorAssignString )
 {
     CF::String s( "hello, world" );
@@ -335,6 +429,17 @@ TEST( CFPP_String, OperatorEqualSTDString )
     ASSERT_TRUE(  CF::String()                 == std::string() );
 }
 
+TEST( CFPP_String, OperatorEqualSTDStringView )
+{
+    ASSERT_TRUE(  CF::String( "hello, world" ) == std::string_view( "hello, world" ) );
+    ASSERT_FALSE( CF::String( "hello, world" ) == std::string_view( "hello, universe" ) );
+    ASSERT_FALSE( CF::String( "hello, world" ) == std::string_view( "hello" ) );
+    ASSERT_FALSE( CF::String( "hello, world" ) == std::string_view() );
+    ASSERT_TRUE(  CF::String()                 == std::string_view() );
+    ASSERT_TRUE(  CF::String( "h\xC3\xA9llo" ) == std::string_view( "h\xC3\xA9llo" ) );
+    ASSERT_FALSE( CF::String( "h\xC3\xA9llo" ) == std::string_view( "hello" ) );
+}
+
 TEST( CFPP_String, OperatorEqualChar )
 {
     ASSERT_TRUE(  CF::String( "hello, world" ) == const_cast< char * >( "hello, world" ) );
@@ -387,6 +492,14 @@ TEST( CFPP_String, OperatorNotEqualSTDString )
     ASSERT_FALSE( CF::String()                 != std::string() );
 }
 
+TEST( CFPP_String, OperatorNotEqualSTDStringView )
+{
+    ASSERT_FALSE( CF::String( "hello, world" ) != std::string_view( "hello, world" ) );
+    ASSERT_TRUE(  CF::String( "hello, world" ) != std::string_view( "hello, universe" ) );
+    ASSERT_TRUE(  CF::String( "hello, world" ) != std::string_view() );
+    ASSERT_FALSE( CF::String()                 != std::string_view() );
+}
+
 TEST( CFPP_String, OperatorNotEqualChar )
 {
     ASSERT_FALSE( CF::String( "hello, world" ) != const_cast< char * >( "hello, world" ) );
@@ -579,6 +692,34 @@ TEST( CFPP_String, HasPrefix_STDString )
     ASSERT_FALSE( s2.HasPrefix( std::string( "world" ) ) );
 }
 
+TEST( CFPP_String, HasPrefix_STDStringView )
+{
+    CF::String s1;
+    CF::String s2( "hello, world" );
+    CF::String s3( "h\xC3\xA9llo" );
+    
+    ASSERT_FALSE( s1.HasPrefix( std::string_view( "hello" ) ) );
+    ASSERT_FALSE( s1.HasPrefix( std::string_view( "" ) ) );
+    ASSERT_TRUE(  s2.HasPrefix( std::string_view( "hello" ) ) );
+    ASSERT_FALSE( s2.HasPrefix( std::string_view( "" ) ) );
+    ASSERT_FALSE( s2.HasPrefix( std::string_view( "world" ) ) );
+    ASSERT_TRUE(  s3.HasPrefix( std::string_view( "h\xC3\xA9" ) ) );
+    ASSERT_FALSE( s3.HasPrefix( std::string_view( "h\xC3" ) ) );
+}
+
+TEST( CFPP_String, HasPrefix_CChar )
+{
+    CF::String s1;
+    CF::String s2( "hello, world" );
+    
+    ASSERT_FALSE( s1.HasPrefix( "hello" ) );
+    ASSERT_FALSE( s1.HasPrefix( "" ) );
+    ASSERT_TRUE(  s2.HasPrefix( "hello" ) );
+    ASSERT_FALSE( s2.HasPrefix( "" ) );
+    ASSERT_FALSE( s2.HasPrefix( "world" ) );
+    ASSERT_FALSE( s2.HasPrefix( static_cast< const char * >( nullptr ) ) );
+}
+
 TEST( CFPP_String, HasSuffix_String )
 {
     CF::String s1;
@@ -617,6 +758,101 @@ TEST( CFPP_String, HasSuffix_STDString )
     ASSERT_FALSE( s2.HasSuffix( std::string( "universe" ) ) );
 }
 
+TEST( CFPP_String, HasSuffix_STDStringView )
+{
+    CF::String s1;
+    CF::String s2( "hello, world" );
+    CF::String s3( "h\xC3\xA9llo" );
+    
+    ASSERT_FALSE( s1.HasSuffix( std::string_view( "world" ) ) );
+    ASSERT_FALSE( s1.HasSuffix( std::string_view( "" ) ) );
+    ASSERT_TRUE(  s2.HasSuffix( std::string_view( "world" ) ) );
+    ASSERT_FALSE( s2.HasSuffix( std::string_view( "" ) ) );
+    ASSERT_FALSE( s2.HasSuffix( std::string_view( "hello" ) ) );
+    ASSERT_TRUE(  s3.HasSuffix( std::string_view( "\xC3\xA9llo" ) ) );
+    ASSERT_FALSE( s3.HasSuffix( std::string_view( "\xA9llo" ) ) );
+}
+
+TEST( CFPP_String, HasSuffix_CChar )
+{
+    CF::String s1;
+    CF::String s2( "hello, world" );
+    
+    ASSERT_FALSE( s1.HasSuffix( "world" ) );
+    ASSERT_FALSE( s1.HasSuffix( "" ) );
+    ASSERT_TRUE(  s2.HasSuffix( "world" ) );
+    ASSERT_FALSE( s2.HasSuffix( "" ) );
+    ASSERT_FALSE( s2.HasSuffix( "hello" ) );
+    ASSERT_FALSE( s2.HasSuffix( static_cast< const char * >( nullptr ) ) );
+}
+
+TEST( CFPP_String, Compare_String )
+{
+    CF::String s1( "abc" );
+    CF::String s2( static_cast< CFStringRef >( nullptr ) );
+    
+    ASSERT_EQ( s1.Compare( CF::String( "abc" ) ), kCFCompareEqualTo );
+    ASSERT_EQ( s1.Compare( CF::String( "abd" ) ), kCFCompareLessThan );
+    ASSERT_EQ( s1.Compare( CF::String( "ab" ) ),  kCFCompareGreaterThan );
+    ASSERT_EQ( s1.Compare( CF::String( "ABC" ), kCFCompareCaseInsensitive ), kCFCompareEqualTo );
+    ASSERT_EQ( s2.Compare( CF::String( "" ) ),    kCFCompareEqualTo );
+    ASSERT_EQ( s2.Compare( CF::String( "abc" ) ), kCFCompareLessThan );
+}
+
+TEST( CFPP_String, Compare_CFString )
+{
+    CF::String s( "file10" );
+    
+    ASSERT_EQ( s.Compare( CFSTR( "file10" ) ), kCFCompareEqualTo );
+    ASSERT_EQ( s.Compare( CFSTR( "file9" ) ),  kCFCompareLessThan );
+    ASSERT_EQ( s.Compare( CFSTR( "file9" ), kCFCompareNumerically ), kCFCompareGreaterThan );
+    ASSERT_EQ( s.Compare( static_cast< CFStringRef >( nullptr ) ), kCFCompareGreaterThan );
+}
+
+TEST( CFPP_String, Compare_STDString )
+{
+    CF::String s( "abc" );
+    
+    ASSERT_EQ( s.Compare( std::string( "abc" ) ), kCFCompareEqualTo );
+    ASSERT_EQ( s.Compare( std::string( "abd" ) ), kCFCompareLessThan );
+    ASSERT_EQ( s.Compare( std::string( "ABC" ), kCFCompareCaseInsensitive ), kCFCompareEqualTo );
+}
+
+TEST( CFPP_String, Compare_STDStringView )
+{
+    CF::String s1( "h\xC3\xA9llo" );
+    CF::String s2( "\xEF\xBF\xBD" );
+    
+    ASSERT_EQ( s1.Compare( std::string_view( "h\xC3\xA9llo" ) ),      kCFCompareEqualTo );
+    ASSERT_EQ( s1.Compare( std::string_view( "h\xC3\xA9ll" ) ),        kCFCompareGreaterThan );
+    ASSERT_EQ( s1.Compare( std::string_view( "h\xC3\xA9llo!" ) ),      kCFCompareLessThan );
+    ASSERT_EQ( s1.Compare( std::string_view( "hello" ) ),              kCFCompareGreaterThan );
+    ASSERT_EQ( s1.Compare( std::string_view( "H\xC3\x89LLO" ), kCFCompareCaseInsensitive ), kCFCompareEqualTo );
+    ASSERT_EQ( s2.Compare( std::string_view( "\xF0\x9F\x98\x80" ) ), kCFCompareGreaterThan );
+}
+
+TEST( CFPP_String, Compare_STDStringView_Invalid )
+{
+    CF::String s1( "abc" );
+    CF::String s2( "\xEF\xBF\xBD" );
+    CF::String s3( "" );
+    
+    ASSERT_EQ( s1.Compare( std::string_view( "ab\xFF" ), kCFCompareCaseInsensitive ), kCFCompareLessThan );
+    ASSERT_EQ( s2.Compare( std::string_view( "\xFF" ),   kCFCompareCaseInsensitive ), kCFCompareLessThan );
+    ASSERT_EQ( s3.Compare( std::string_view( "\xFF" ),   kCFCompareCaseInsensitive ), kCFCompareLessThan );
+}
+
+TEST( CFPP_String, Compare_CChar )
+{
+    CF::String s( "abc" );
+    
+    ASSERT_EQ( s.Compare( "abc" ), kCFCompareEqualTo );
+    ASSERT_EQ( s.Compare( "abd" ), kCFCompareLessThan );
+    ASSERT_EQ( s.Compare( "ab" ),  kCFCompareGreaterThan );
+    ASSERT_EQ( s.Compare( "ABC", kCFCompareCaseInsensitive ), kCFCompareEqualTo );
+    ASSERT_EQ( s.Compare( static_cast< const char * >( nullptr ) ), kCFCompareGreaterThan );
+}
+
 TEST( CFPP_String, GetLength )
 {
     CF::String s;
@@ -637,6 +873,38 @@ TEST( CFPP_String, GetLength )
     ASSERT_EQ( s.GetLength(), 0 );
 }
 
+TEST( CFPP_String, GetHash )
+{
+    CF::String s1( "hello, world" );
+    CF::String s2( std::string( "hello, world" ) );
+    CF::String s3( "hello, universe" );
+    CF::String s4( "h\xC3\xA9llo, w\xE4\xB8\x96rld" );
+    CF::String s5( static_cast< CFStringRef >( nullptr ) );
+    
+    ASSERT_NE( s1.GetHash(), 0 );
+    ASSERT_EQ( s1.GetHash(), s1.GetHash() );
+    ASSERT_EQ( s1.GetHash(), s2.GetHash() );
+    ASSERT_NE( s1.GetHash(), s3.GetHash() );
+    ASSERT_EQ( s4.GetHash(), CF::String::GetHash( "h\xC3\xA9llo, w\xE4\xB8\x96rld" ) );
+    ASSERT_EQ( s5.GetHash(), CF::String( "" ).GetHash() );
+    
+    s3 = "hello, world";
+    
+    ASSERT_EQ( s1.GetHash(), s3.GetHash() );
+    
+    s3 += "!";
+    
+    ASSERT_NE( s1.GetHash(), s3.GetHash() );
+    ASSERT_EQ( s3.GetHash(), CF::String::GetHash( "hello, world!" ) );
+}
+
+TEST( CFPP_String, GetHash_STDStringView )
+{
+    ASSERT_NE( CF::String::GetHash( std::string_view() ), 0 );
+    ASSERT_EQ( CF::String::GetHash( std::string_view( "hello, world" ) ), CF::String( "hello, world" ).GetHash() );
+    ASSERT_NE( CF::String::GetHash( std::string_view( "hello, world" ) ), CF::String::GetHash( std::string_view( "hello, world" ).substr( 1 ) ) );
+}
+
 TEST( CFPP_String, GetValue )
 {
     CF::String  s( "hello, world" );
@@ -668,6 +936,55 @@ TEST( CFPP_String, GetCStringValue )
     ASSERT_TRUE( s.GetCStringValue() == nullptr );
 }
 
+TEST( CFPP_String, GetStringView )
+{
+    CF::String s( "hello, world" );
+    
+    ASSERT_EQ(   s.GetStringView(),                             "hello, world" );
+    ASSERT_EQ(   s.GetStringView( kCFStringEncodingISOLatin1 ), "hello, world" );
+    ASSERT_TRUE( s.GetStringView( kCFStringEncodingUTF16 ).length() == 24 );
+    ASSERT_TRUE( s.GetStringView( kCFStringEncodingUTF16 ).data() != nullptr );
+    
+    s = "h\xC3\xA9llo, w\xC3\xB6rld";
+    
+    ASSERT_EQ(   s.GetStringView(),                             "h\xC3\xA9llo, w\xC3\xB6rld" );
+    ASSERT_EQ(   s.GetStringView( kCFStringEncodingISOLatin1 ), "h\xE9llo, w\xF6rld" );
+    ASSERT_TRUE( s.GetStringView( kCFStringEncodingASCII ).length() == 0 );
+    ASSERT_TRUE( s.GetStringView( kCFStringEncodingASCII ).data() == nullptr );
+    
+    s = CF::String( std::string( 100000, 'a' ) + "\xC3\xA9" );
+    
+    ASSERT_TRUE( s.GetStringView().length() == 100002 );
+    
+    s = "h\xC3\xA9llo";
+    
+    ASSERT_EQ( s.GetStringView(), "h\xC3\xA9llo" );
+    
+    s = static_cast< CFStringRef >( nullptr );
+    
+    ASSERT_FALSE( s.IsValid() );
+    ASSERT_TRUE(  s.GetStringView().length() == 0 );
+    ASSERT_TRUE(  s.GetStringView().data() == nullptr );
+}
+
+TEST( CFPP_String, GetStringView_Buffer )
+{
+    char       buf[ 32 ];
+    char       small[ 4 ];
+    CF::String s( "h\xC3\xA9llo, w\xC3\xB6rld" );
+    
+    ASSERT_EQ(   s.GetStringView( buf, sizeof( buf ) ),                             "h\xC3\xA9llo, w\xC3\xB6rld" );
+    ASSERT_EQ(   s.GetStringView( buf, sizeof( buf ), kCFStringEncodingISOLatin1 ), "h\xE9llo, w\xF6rld" );
+    ASSERT_TRUE( s.GetStringView( small, sizeof( small ) ).data() == nullptr );
+    ASSERT_TRUE( s.GetStringView( nullptr, 0 ).data()             == nullptr );
+    ASSERT_TRUE( CF::String( "" ).GetStringView( buf, sizeof( buf ) ).length() == 0 );
+    
+    s = static_cast< CFStringRef >( nullptr );
+    
+    ASSERT_FALSE( s.IsValid() );
+    ASSERT_TRUE(  s.GetStringView( buf, sizeof( buf ) ).data() == nullptr );
+}
+
 TEST( CFPP_String, SetValue )
 {
     CF::String s( "hello, world" );
@@ -677,6 +994,141 @@ TEST( CFPP_String, SetValue )
     s.SetValue( "hello, universe" );
     
     ASSERT_EQ( s.GetValue(), "hello, universe" );
+    
+    s.SetValue( std::string( "hello\0world", 11 ) );
+    
+    ASSERT_EQ( s.GetLength(), 11 );
+    ASSERT_EQ( s.GetValue(), std::string( "hello\0world", 11 ) );
+}
+
+TEST( CFPP_String, WriteTo )
+{
+    CF::String      s1( std::string( 10000, 'a' ) + "\xC3\xA9" );
+    CF::String      s2( "\xC3\xA9" );
+    CF::WriteStream w1( CF::AutoPointer( CFWriteStreamCreateWithAllocatedBuffers( nullptr, nullptr ) ) );
+    CF::WriteStream w2( CF::AutoPointer( CFWriteStreamCreateWithAllocatedBuffers( nullptr, nullptr ) ) );
+    CF::Data        d;
+    
+    ASSERT_TRUE( w1.Open() );
+    ASSERT_TRUE( w2.Open() );
+    ASSERT_TRUE(  s1.WriteTo( w1 ) );
+    ASSERT_FALSE( s2.WriteTo( w2, kCFStringEncodingASCII ) );
+    
+    d = w1.GetProperty( kCFStreamPropertyDataWritten );
+    
+    ASSERT_EQ( d.GetLength(), 10002 );
+    ASSERT_TRUE( std::string( d ) == s1.GetValue() );
+}
+
+TEST( CFPP_String, AppendTo )
+{
+    CF::String s1( std::string( 40000, 'a' ) );
+    CF::String s2( "\xC3\xA9" );
+    CF::Data   d1( std::string( "x" ) );
+    CF::Data   d2;
+    CF::Data   d3;
+    
+    ASSERT_TRUE(  s1.AppendTo( d1 ) );
+    ASSERT_TRUE(  s2.AppendTo( d2, kCFStringEncodingUTF16BE, 0, true ) );
+    ASSERT_FALSE( s2.AppendTo( d3, kCFStringEncodingASCII ) );
+    ASSERT_TRUE(  s2.AppendTo( d3, kCFStringEncodingASCII, '?' ) );
+    
+    ASSERT_EQ( d1.GetLength(), 40001 );
+    ASSERT_EQ( d1[ 0 ], 'x' );
+    ASSERT_EQ( d1[ 40000 ], 'a' );
+    ASSERT_EQ( d2.GetLength(), 4 );
+    ASSERT_TRUE( d2[ 0 ] == 0xFE && d2[ 1 ] == 0xFF && d2[ 2 ] == 0x00 && d2[ 3 ] == 0xE9 );
+    ASSERT_EQ( d3.GetLength(), 1 );
+    ASSERT_EQ( d3[ 0 ], '?' );
+}
+
+TEST( CFPP_String, GetCharacters )
+{
+    CF::String s1( "h\xC3\xA9llo" );
+    CF::String s2;
+    
+    ASSERT_EQ( s1.GetCharacters().GetLength(), 5 );
+    ASSERT_EQ( s2.GetCharacters().GetLength(), 0 );
+    ASSERT_EQ( s1.GetCharacters()[ 1 ], 0xE9 );
+    ASSERT_EQ( s2.GetCharacters()[ 1 ], 0 );
+}
+
+TEST( CFPP_String, GetCodePoints )
+{
+    CF::String s1( "\xF0\x9F\x98\x80" );
+    CF::String s2;
+    
+    ASSERT_TRUE( *( s1.GetCodePoints().begin() ) == 0x1F600 );
+    ASSERT_TRUE( s2.GetCodePoints().begin() == s2.GetCodePoints().end() );
+}
+
+TEST( CFPP_String, Hasher )
+{
+    CF::String::Hasher h;
+    
+    ASSERT_EQ( h( CF::String( "hello, world" ) ), h( std::string_view( "hello, world" ) ) );
+    ASSERT_EQ( h( CF::String( "hello, world" ) ), std::hash< CF::String >()( CF::String( "hello, world" ) ) );
+    ASSERT_NE( h( CF::String( "hello, world" ) ), h( std::string_view( "hello, universe" ) ) );
+}
+
+TEST( CFPP_String, EqualTo )
+{
+    CF::String::EqualTo eq;
+    CF::String          s1( "hello, world" );
+    CF::String          s2( "hello, world" );
+    CF::String          s3( "hello, universe" );
+    CF::String          s4( static_cast< CFStringRef >( nullptr ) );
+    CF::String          s5( static_cast< CFStringRef >( nullptr ) );
+    
+    ASSERT_TRUE(  eq( s1, s2 ) );
+    ASSERT_FALSE( eq( s1, s3 ) );
+    ASSERT_FALSE( eq( s1, s4 ) );
+    ASSERT_TRUE(  eq( s4, s5 ) );
+    ASSERT_TRUE(  eq( s1, std::string_view( "hello, world" ) ) );
+    ASSERT_TRUE(  eq( std::string_view( "hello, world" ), s1 ) );
+    ASSERT_FALSE( eq( s3, std::string_view( "hello, world" ) ) );
+    ASSERT_TRUE(  eq( std::string_view( "hello" ), std::string_view( "hello" ) ) );
+    
+    s1.GetHash();
+    s3.GetHash();
+    
+    ASSERT_FALSE( eq( s1, s3 ) );
+    ASSERT_TRUE(  std::equal_to< CF::String >()( s1, s2 ) );
+}
+
+TEST( CFPP_String, Less )
+{
+    CF::String::Less lt;
+    
+    ASSERT_TRUE(  lt( CF::String( "abc" ), CF::String( "abd" ) ) );
+    ASSERT_FALSE( lt( CF::String( "abd" ), CF::String( "abc" ) ) );
+    ASSERT_FALSE( lt( CF::String( "abc" ), CF::String( "abc" ) ) );
+    ASSERT_TRUE(  lt( CF::String( "ab" ),  std::string_view( "abc" ) ) );
+    ASSERT_FALSE( lt( CF::String( "abc" ), std::string_view( "ab" ) ) );
+    ASSERT_TRUE(  lt( std::string_view( "ab" ), CF::String( "abc" ) ) );
+    ASSERT_FALSE( lt( std::string_view( "abc" ), CF::String( "abc" ) ) );
+    ASSERT_TRUE(  lt( std::string_view( "ab" ), std::string_view( "abc" ) ) );
+    ASSERT_FALSE( lt( std::string_view( "abc" ), std::string_view( "abc" ) ) );
+    
+    /* UTF-16 order: U+FFFD sorts after U+1F600 */
+    ASSERT_TRUE(  lt( std::string_view( "\xF0\x9F\x98\x80" ), std::string_view( "\xEF\xBF\xBD" ) ) );
+    ASSERT_TRUE(  lt( CF::String( "\xF0\x9F\x98\x80" ), std::string_view( "\xEF\xBF\xBD" ) ) );
+    ASSERT_TRUE(  lt( CF::String( "\xF0\x9F\x98\x80" ), CF::String( "\xEF\xBF\xBD" ) ) );
+}
+
+TEST( CFPP_String, HeterogeneousLookup )
+{
+    std::unordered_map< CF::String, int, CF::String::Hasher, CF::String::EqualTo > m1;
+    std::map< CF::String, int, CF::String::Less >                                  m2;
+    
+    m1[ "foo" ] = 1;
+    m1[ "bar" ] = 2;
+    m2[ "foo" ] = 1;
+    m2[ "bar" ] = 2;
+    
+    ASSERT_EQ( m1.find( CF::String( "foo" ) )->second, 1 );
+    ASSERT_EQ( m2.find( std::string_view( "bar" ) )->second, 2 );
+    ASSERT_TRUE( m2.find( std::string_view( "baz" ) ) == m2.end() );
 }
 
 TEST( CFPP_String, Swap )
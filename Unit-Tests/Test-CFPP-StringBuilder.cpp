@@ -0,0 +1,363 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-StringBuilder.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::StringBuilder
+ */
+
+#include <CF++.hpp>
+#include <clocale>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+TEST( CFPP_StringBuilder, CTOR )
+{
+    CF::StringBuilder b;
+    
+    ASSERT_TRUE( b.IsValid() );
+    ASSERT_EQ(   b.GetLength(), 0 );
+}
+
+TEST( CFPP_StringBuilder, CTOR_Capacity )
+{
+    CF::StringBuilder b( 64 );
+    
+    ASSERT_TRUE( b.IsValid() );
+    ASSERT_EQ(   b.GetLength(), 0 );
+    
+    b << "hello, world";
+    
+    ASSERT_TRUE( b.Freeze() == "hello, world" );
+}
+
+TEST( CFPP_StringBuilder, CTOR_String )
+{
+    CF::StringBuilder b( CF::String( "hello" ) );
+    
+    ASSERT_TRUE( b.IsValid() );
+    ASSERT_EQ(   b.GetLength(), 5 );
+    
+    b << ", world";
+    
+    ASSERT_TRUE( b.Freeze() == "hello, world" );
+}
+
+TEST( CFPP_StringBuilder, CCTOR )
+{
+    CF::StringBuilder b1( CF::String( "hello" ) );
+    CF::StringBuilder b2( b1 );
+    
+    b2 << ", world";
+    
+    ASSERT_TRUE( b1.Freeze() == "hello" );
+    ASSERT_TRUE( b2.Freeze() == "hello, world" );
+}
+
+TEST( CFPP_StringBuilder, MCTOR )
+{
+    CF::StringBuilder b1( CF::String( "hello" ) );
+    CF::StringBuilder b2( std::move( b1 ) );
+    
+    ASSERT_FALSE( b1.IsValid() );
+    ASSERT_TRUE(  b2.IsValid() );
+    ASSERT_TRUE(  b2.Freeze() == "hello" );
+}
+
+TEST( CFPP_StringBuilder, OperatorAssign )
+{
+    CF::StringBuilder b1( CF::String( "hello" ) );
+    CF::StringBuilder b2;
+    
+    b2 = b1;
+    
+    ASSERT_TRUE( b2.Freeze() == "hello" );
+    ASSERT_TRUE( b1.Freeze() == "hello" );
+}
+
+TEST( CFPP_StringBuilder, OperatorShiftLeft )
+{
+    CF::StringBuilder b;
+    
+    b << CF::String( "a" )
+      << CFSTR( "b" )
+      << std::string_view( "cd" ).substr( 0, 1 )
+      << std::string( "d" )
+      << "e"
+      << 'f'
+      << static_cast< signed short >( -1 )
+      << -2
+      << -3L
+      << -4LL
+      << static_cast< unsigned short >( 1 )
+      << 2U
+      << 3UL
+      << 4ULL
+      << 0.5F
+      << 0.25;
+    
+    ASSERT_TRUE( b.Freeze() == "abcdef-1-2-3-412340.50.25" );
+}
+
+TEST( CFPP_StringBuilder, GetTypeID )
+{
+    CF::StringBuilder b;
+    
+    ASSERT_EQ( b.GetTypeID(), CFStringGetTypeID() );
+}
+
+TEST( CFPP_StringBuilder, GetCFObject )
+{
+    CF::StringBuilder b;
+    
+    ASSERT_TRUE( b.GetCFObject() != nullptr );
+    ASSERT_EQ(   CFGetTypeID( b.GetCFObject() ), CFStringGetTypeID() );
+}
+
+TEST( CFPP_StringBuilder, GetLength )
+{
+    CF::StringBuilder b;
+    
+    ASSERT_EQ( b.GetLength(), 0 );
+    
+    b << "hello";
+    
+    ASSERT_EQ( b.GetLength(), 5 );
+    
+    b << "\xC3\xA9";
+    
+    ASSERT_EQ( b.GetLength(), 6 );
+}
+
+TEST( CFPP_StringBuilder, Reserve )
+{
+    CF::StringBuilder b;
+    
+    b << "hello";
+    
+    ASSERT_NO_THROW(         b.Reserve( 1024 ) );
+    ASSERT_NO_FATAL_FAILURE( b.Reserve( 2 ) );
+    ASSERT_NO_FATAL_FAILURE( b.Reserve( -1 ) );
+    ASSERT_EQ(               b.GetLength(), 5 );
+    
+    for( int i = 0; i < 1000; i++ )
+    {
+        b << 'x';
+    }
+    
+    ASSERT_EQ(   b.GetLength(), 1005 );
+    ASSERT_TRUE( b.Freeze().HasPrefix( CF::String( "helloxxx" ) ) );
+}
+
+TEST( CFPP_StringBuilder, Clear )
+{
+    CF::StringBuilder b( CF::String( "hello" ) );
+    
+    b.Clear();
+    
+    ASSERT_EQ(   b.GetLength(), 0 );
+    ASSERT_TRUE( b.Freeze() == "" );
+}
+
+TEST( CFPP_StringBuilder, Append_String )
+{
+    CF::StringBuilder b;
+    
+    b.Append( CF::String( "hello" ) );
+    b.Append( CF::String( static_cast< CFStringRef >( nullptr ) ) );
+    
+    ASSERT_TRUE( b.Freeze() == "hello" );
+}
+
+TEST( CFPP_StringBuilder, Append_CFString )
+{
+    CF::StringBuilder b;
+    
+    b.Append( CFSTR( "hello" ) );
+    
+    ASSERT_NO_THROW(         b.Append( static_cast< CFStringRef >( nullptr ) ) );
+    ASSERT_NO_FATAL_FAILURE( b.Append( static_cast< CFStringRef >( CF::Boolean().GetCFObject() ) ) );
+    
+    ASSERT_TRUE( b.Freeze() == "hello" );
+}
+
+TEST( CFPP_StringBuilder, Append_STDStringView_Encoding )
+{
+    CF::StringBuilder b;
+    
+    b.Append( std::string_view( "hello, world" ).substr( 0, 5 ) );
+    b.Append( std::string_view( ", w\xC3\xB6rld" ) );
+    b.Append( std::string_view( "\xE9", 1 ), kCFStringEncodingISOLatin1 );
+    b.Append( std::string_view() );
+    
+    ASSERT_TRUE( b.Freeze() == "hello, w\xC3\xB6rld\xC3\xA9" );
+}
+
+TEST( CFPP_StringBuilder, Append_STDString_Encoding )
+{
+    CF::StringBuilder b;
+    
+    b.Append( std::string( "hello" ) );
+    b.Append( std::string( "\xE9" ), kCFStringEncodingISOLatin1 );
+    
+    ASSERT_TRUE( b.Freeze() == "hello\xC3\xA9" );
+}
+
+TEST( CFPP_StringBuilder, Append_CChar_Encoding )
+{
+    CF::StringBuilder b;
+    
+    b.Append( "hello" );
+    b.Append( "\xE9", kCFStringEncodingISOLatin1 );
+    
+    ASSERT_NO_THROW(         b.Append( static_cast< const char * >( nullptr ) ) );
+    ASSERT_NO_FATAL_FAILURE( b.Append( static_cast< const char * >( nullptr ) ) );
+    
+    ASSERT_TRUE( b.Freeze() == "hello\xC3\xA9" );
+}
+
+TEST( CFPP_StringBuilder, Append_Char )
+{
+    CF::StringBuilder b;
+    
+    b.Append( 'a' );
+    b.Append( 'b' );
+    
+    ASSERT_TRUE( b.Freeze() == "ab" );
+}
+
+TEST( CFPP_StringBuilder, Append_Integers )
+{
+    CF::StringBuilder b;
+    
+    b.Append( static_cast< signed short >( -32768 ) );
+    b.Append( ' ' );
+    b.Append( static_cast< signed int >( 0 ) );
+    b.Append( ' ' );
+    b.Append( static_cast< signed long >( 42 ) );
+    b.Append( ' ' );
+    b.Append( static_cast< signed long long >( -9223372036854775807LL - 1 ) );
+    b.Append( ' ' );
+    b.Append( static_cast< unsigned short >( 65535 ) );
+    b.Append( ' ' );
+    b.Append( static_cast< unsigned int >( 42 ) );
+    b.Append( ' ' );
+    b.Append( static_cast< unsigned long >( 42 ) );
+    b.Append( ' ' );
+    b.Append( static_cast< unsigned long long >( 18446744073709551615ULL ) );
+    
+    ASSERT_TRUE( b.Freeze() == "-32768 0 42 -9223372036854775808 65535 42 42 18446744073709551615" );
+}
+
+TEST( CFPP_StringBuilder, Append_Float )
+{
+    CF::StringBuilder b;
+    
+    b.Append( 1.5F );
+    b.Append( ' ' );
+    b.Append( -0.25F );
+    
+    ASSERT_TRUE( b.Freeze() == "1.5 -0.25" );
+}
+
+TEST( CFPP_StringBuilder, Append_Double )
+{
+    CF::StringBuilder b;
+    
+    b.Append( 0.1 );
+    b.Append( ' ' );
+    b.Append( 42.0 );
+    b.Append( ' ' );
+    b.Append( 1e100 );
+    b.Append( ' ' );
+    b.Append( 0.30000000000000004 );
+    
+    ASSERT_TRUE( b.Freeze() == "0.1 42 1e+100 0.30000000000000004" );
+}
+
+TEST( CFPP_StringBuilder, Append_Double_Locale )
+{
+    CF::StringBuilder b;
+    std::string       locale( setlocale( LC_NUMERIC, nullptr ) );
+    
+    if( setlocale( LC_NUMERIC, "de_DE.UTF-8" ) == nullptr && setlocale( LC_NUMERIC, "fr_FR.UTF-8" ) == nullptr )
+    {
+        return;
+    }
+    
+    b.Append( 3.5 );
+    b.Append( ' ' );
+    b.Append( -0.1 );
+    
+    setlocale( LC_NUMERIC, locale.c_str() );
+    
+    ASSERT_TRUE( b.Freeze() == "3.5 -0.1" );
+}
+
+TEST( CFPP_StringBuilder, AppendCharacters )
+{
+    CF::StringBuilder b;
+    UniChar           c[] = { 'h', 0xE9, 'l', 'l', 'o' };
+    
+    b.AppendCharacters( c, 5 );
+    
+    ASSERT_NO_THROW(         b.AppendCharacters( nullptr, 5 ) );
+    ASSERT_NO_FATAL_FAILURE( b.AppendCharacters( c, 0 ) );
+    
+    ASSERT_TRUE( b.Freeze() == "h\xC3\xA9llo" );
+}
+
+TEST( CFPP_StringBuilder, Freeze )
+{
+    CF::StringBuilder b;
+    CF::String        s1;
+    CF::String        s2;
+    
+    b << "hello";
+    
+    s1 = b.Freeze();
+    
+    ASSERT_TRUE( b.IsValid() );
+    ASSERT_EQ(   b.GetLength(), 0 );
+    
+    b << "world";
+    
+    s2 = b.Freeze();
+    
+    ASSERT_TRUE( s1 == "hello" );
+    ASSERT_TRUE( s2 == "world" );
+}
+
+TEST( CFPP_StringBuilder, Swap )
+{
+    CF::StringBuilder b1( CF::String( "hello" ) );
+    CF::StringBuilder b2( CF::String( "world" ) );
+    
+    swap( b1, b2 );
+    
+    ASSERT_TRUE( b1.Freeze() == "world" );
+    ASSERT_TRUE( b2.Freeze() == "hello" );
+}
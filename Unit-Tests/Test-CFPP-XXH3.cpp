@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        Test-CFPP-XXH3.cpp
+ * @copyright   (c) 2026 - Jean-David Gadina - www.xs-labs.com / www.digidna.net
+ * @abstract    Unit tests for CF::XXH3
+ */
+
+#include <CF++.hpp>
+
+#define XSTEST_GTEST_COMPAT
+#include <XSTest/XSTest.hpp>
+
+static CF::Data __Bytes()
+{
+    CF::Data d;
+    int      i;
+    
+    for( i = 0; i < 1000; i++ )
+    {
+        d += static_cast< CF::Data::Byte >( i );
+    }
+    
+    return d;
+}
+
+TEST( CFPP_XXH3, CTOR )
+{
+    CF::XXH3 h1;
+    CF::XXH3 h2( 42 );
+    
+    ASSERT_EQ( h1.GetSeed(),  0 );
+    ASSERT_EQ( h1.GetValue(), 0x2D06800538D394C2ULL );
+    ASSERT_EQ( h2.GetSeed(),  42 );
+}
+
+TEST( CFPP_XXH3, CCTOR )
+{
+    CF::XXH3 h1;
+    
+    h1.Update( __Bytes() );
+    
+    {
+        CF::XXH3 h2( h1 );
+        
+        ASSERT_EQ( h2.GetValue(), 0xD33DD80B46F60E50ULL );
+    }
+}
+
+TEST( CFPP_XXH3, MCTOR )
+{
+    CF::XXH3 h1( 42 );
+    
+    h1.Update( __Bytes() );
+    
+    {
+        CF::XXH3 h2( std::move( h1 ) );
+        
+        ASSERT_EQ( h2.GetSeed(),  42 );
+        ASSERT_EQ( h2.GetValue(), 0x1BA5B309DF6F67D3ULL );
+    }
+}
+
+TEST( CFPP_XXH3, OperatorAssign )
+{
+    CF::XXH3 h1( 42 );
+    CF::XXH3 h2;
+    
+    h1.Update( __Bytes() );
+    
+    h2 = h1;
+    
+    ASSERT_EQ( h2.GetSeed(),  42 );
+    ASSERT_EQ( h2.GetValue(), 0x1BA5B309DF6F67D3ULL );
+}
+
+TEST( CFPP_XXH3, Compute )
+{
+    ASSERT_EQ( CF::XXH3::Compute( CF::Data() ),                          0x2D06800538D394C2ULL );
+    ASSERT_EQ( CF::XXH3::Compute( CF::Data( std::string( "a" ) ) ),      0xE6C632B61E964E1FULL );
+    ASSERT_EQ( CF::XXH3::Compute( CF::Data( std::string( "abc" ) ) ),    0x78AF5F94892F3950ULL );
+    ASSERT_EQ( CF::XXH3::Compute( CF::Data( std::string( "abc" ) ), 42 ), 0xD8438DEF21BBDCC3ULL );
+    ASSERT_EQ( CF::XXH3::Compute( __Bytes() ),                           0xD33DD80B46F60E50ULL );
+    ASSERT_EQ( CF::XXH3::Compute( __Bytes(), 42 ),                       0x1BA5B309DF6F67D3ULL );
+}
+
+TEST( CFPP_XXH3, Compute_BytePtr )
+{
+    CF::Data d( __Bytes() );
+    
+    ASSERT_EQ( CF::XXH3::Compute( d.GetBytePtr(), 3 ),              CF::XXH3::Compute( CF::Data( { 0x00, 0x01, 0x02 } ) ) );
+    ASSERT_EQ( CF::XXH3::Compute( d.GetBytePtr(), d.GetLength() ),  0xD33DD80B46F60E50ULL );
+    ASSERT_EQ( CF::XXH3::Compute( nullptr, 10 ),                    0x2D06800538D394C2ULL );
+}
+
+TEST( CFPP_XXH3, GetSeed )
+{
+    CF::XXH3 h( 0xFFFFFFFFFFFFFFFFULL );
+    
+    ASSERT_EQ( h.GetSeed(), 0xFFFFFFFFFFFFFFFFULL );
+}
+
+TEST( CFPP_XXH3, GetValue )
+{
+    CF::XXH3 h;
+    
+    h.Update( __Bytes() );
+    
+    ASSERT_EQ( h.GetValue(), 0xD33DD80B46F60E50ULL );
+    ASSERT_EQ( h.GetValue(), 0xD33DD80B46F60E50ULL );
+}
+
+TEST( CFPP_XXH3, Reset )
+{
+    CF::XXH3 h( 42 );
+    
+    h.Update( __Bytes() );
+    h.Reset();
+    
+    ASSERT_EQ( h.GetSeed(),  42 );
+    ASSERT_EQ( h.GetValue(), CF::XXH3::Compute( CF::Data(), 42 ) );
+    
+    h.Update( __Bytes() );
+    
+    ASSERT_EQ( h.GetValue(), 0x1BA5B309DF6F67D3ULL );
+}
+
+TEST( CFPP_XXH3, Update )
+{
+    CF::XXH3 h;
+    
+    h.Update( CF::Data( std::string( "a" ) ) );
+    h.Update( CF::Data() );
+    h.Update( CF::Data( std::string( "bc" ) ) );
+    
+    ASSERT_EQ( h.GetValue(), 0x78AF5F94892F3950ULL );
+}
+
+TEST( CFPP_XXH3, Update_BytePtr )
+{
+    CF::Data d;
+    CFIndex  n;
+    CFIndex  i;
+    
+    for( i = 0; i < 5000; i++ )
+    {
+        d += static_cast< CF::Data::Byte >( i * 7 );
+    }
+    
+    /* Chunk sizes around the 256-byte buffer and 1024-byte block sizes */
+    for( n = 1; n < 1500; n += 37 )
+    {
+        CF::XXH3 h( static_cast< UInt64 >( n ) );
+        
+        for( i = 0; i < d.GetLength(); i += n )
+        {
+            h.Update( d.GetBytePtr() + i, std::min( n, d.GetLength() - i ) );
+        }
+        
+        ASSERT_EQ( h.GetValue(), CF::XXH3::Compute( d, static_cast< UInt64 >( n ) ) );
+    }
+}
+
+TEST( CFPP_XXH3, Update_ReadStream )
+{
+    CF::ReadStream s1( "/etc/hosts" );
+    CF::ReadStream s2( "/etc/hosts" );
+    CF::ReadStream s3;
+    CF::XXH3       h;
+    
+    ASSERT_TRUE(  s1.Open() );
+    ASSERT_TRUE(  h.Update( s1 ) );
+    ASSERT_TRUE(  s2.Open() );
+    ASSERT_EQ(    h.GetValue(), CF::XXH3::Compute( s2.Read() ) );
+    ASSERT_FALSE( h.Update( s3 ) );
+    
+    s1.Close();
+    s2.Close();
+}
+
+TEST( CFPP_XXH3, Swap )
+{
+    CF::XXH3 h1( 42 );
+    CF::XXH3 h2;
+    
+    h1.Update( __Bytes() );
+    
+    swap( h1, h2 );
+    
+    ASSERT_EQ( h1.GetSeed(),  0 );
+    ASSERT_EQ( h1.GetValue(), 0x2D06800538D394C2ULL );
+    ASSERT_EQ( h2.GetSeed(),  42 );
+    ASSERT_EQ( h2.GetValue(), 0x1BA5B309DF6F67D3ULL );
+}